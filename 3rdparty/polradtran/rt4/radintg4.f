@@ -146,6 +146,7 @@ C      two layer properties and the radiance incident on the top and bottom.
       REAL*8    S(MAXV), V(MAXV)
       REAL*8    X(MAXM), Y(MAXM)
       COMMON /SCRATCH1/ X, Y
+!$OMP THREADPRIVATE(/SCRATCH1/)
 
 
 C               Compute gamma plus
@@ -216,6 +217,7 @@ C      T_REFLECT, T_TRANS, and T_SOURCE.
       REAL*8   GAMMA(MAXM)
       COMMON /SCRATCH1/ X, Y
       COMMON /SCRATCH2/ GAMMA
+!$OMP THREADPRIVATE(/SCRATCH1/, /SCRATCH2/)
       PARAMETER (ZERO=0.0D0)
 
 
@@ -347,6 +349,7 @@ C      thus layer 1 is put on top of layer 2.
       REAL*8   GAMMA(MAXM)
       COMMON /SCRATCH1/ X, Y
       COMMON /SCRATCH2/ GAMMA
+!$OMP THREADPRIVATE(/SCRATCH1/, /SCRATCH2/)
 
 C           GAMMAp = inv[1 - R1p * R2m]     (p for +,  m for -)
       CALL MMULT (N, N, N, REFLECT1(1,1,1), REFLECT2(1,1,2), X)
@@ -191,8 +191,9 @@ c      REAL*8    EXTINCT_MATRIX(16*2*MAXV), EMIS_VECTOR(4*2*MAXV)
       REAL*8    REFLECT1(2*MAXM),UPREFLECT(2*MAXM),DOWNREFLECT(2*MAXM)
       REAL*8    TRANS1(2*MAXM),  UPTRANS(2*MAXM),  DOWNTRANS(2*MAXM)
       REAL*8    SOURCE1(2*MAXV), UPSOURCE(2*MAXV), DOWNSOURCE(2*MAXV)
-      REAL*8    REFLECT(2*MAXLM)
-      REAL*8    TRANS(2*MAXLM)
+C     The layer matrices are allocated on the heap, so that the routine
+C     is reentrant without requiring a huge stack.
+      REAL*8, ALLOCATABLE :: REFLECT(:), TRANS(:)
       REAL*8    SOURCE(2*MAXV*(MAXLAY+1))
 c      REAL*8    GND_RADIANCE(MAXV), SKY_RADIANCE(2*MAXV)
       REAL*8    SKY_RADIANCE(2*MAXV)
@@ -238,6 +239,8 @@ c      NSTOKES = MIN(NSTOKES,2)
      .     ')^2 = ', (NUM_LAYERS+1)*N*N
           STOP
       ENDIF
+      ALLOCATE (REFLECT(2*(NUM_LAYERS+1)*N*N))
+      ALLOCATE (TRANS(2*(NUM_LAYERS+1)*N*N))
 
 
 C           Make the desired quadrature abscissas and weights
@@ -20,6 +20,9 @@
 /* Threadprivate support */
 #cmakedefine THREADPRIVATE_SUPPORTED
 
+/* Define if the Fortran code is compiled with OpenMP */
+#cmakedefine FORTRAN_OPENMP
+
 /* Define to compile with DISORT support */
 #cmakedefine ENABLE_DISORT
 
@@ -2,8 +2,6 @@ import ctypes as c
 from collections.abc import Sized
 from pyarts.workspace.api import arts_api as lib
 
-from pyarts.classes.BasicTypes import ArrayOfIndex
-from pyarts.classes.Vector import Vector
 from pyarts.classes.io import correct_save_arguments, correct_read_arguments
 from pyarts.classes.ArrayBase import array_base
 
@@ -13,18 +11,20 @@ class GridPosPoly:
 
     Properties:
         idx:
-            Index of position below point (ArrayOfIndex)
+            Indices of the interpolation points (list of int)
 
         w:
-            Weight of grids (Vector)
+            Weights of the interpolation points (list of float)
         """
-    def __init__(self, idx=0, fd=[0, 0]):
-        if isinstance(type, c.c_void_p):
+    def __init__(self, idx=[], w=[]):
+        if isinstance(idx, c.c_void_p):
+            self.__delete__ = False
             self.__data__ = idx
         else:
+            self.__delete__ = True
             self.__data__ = lib.createGridPosPoly()
             self.idx = idx
-            self.fd = fd
+            self.w = w
 
     @staticmethod
     def name():
@@ -32,21 +32,31 @@ class GridPosPoly:
 
     @property
     def idx(self):
-        """ Index of position below point (ArrayOfIndex) """
-        return ArrayOfIndex(c.c_void_p(lib.getidxGridPosPoly(self.__data__)))
+        """ Indices of the interpolation points (list of int) """
+        x = lib.getidxGridPosPoly(self.__data__)
+        return [x[i] for i in range(lib.nelemidxGridPosPoly(self.__data__))]
 
     @idx.setter
     def idx(self, val):
-        self.idx.set(val)
+        if len(val) != lib.nelemidxGridPosPoly(self.__data__):
+            lib.resizeidxGridPosPoly(len(val), self.__data__)
+        x = lib.getidxGridPosPoly(self.__data__)
+        for i in range(len(val)):
+            x[i] = int(val[i])
 
     @property
     def w(self):
-        """ Weight of grids (Vector) """
-        return Vector(c.c_void_p(lib.getwGridPosPoly(self.__data__)))
+        """ Weights of the interpolation points (list of float) """
+        x = lib.getwGridPosPoly(self.__data__)
+        return [x[i] for i in range(lib.nelemwGridPosPoly(self.__data__))]
 
     @w.setter
     def w(self, val):
-        self.w.set(val)
+        if len(val) != lib.nelemwGridPosPoly(self.__data__):
+            lib.resizewGridPosPoly(len(val), self.__data__)
+        x = lib.getwGridPosPoly(self.__data__)
+        for i in range(len(val)):
+            x[i] = float(val[i])
 
     def __del__(self):
         if self.__delete__:
@@ -82,8 +92,20 @@ lib.deleteGridPosPoly.argtypes = [c.c_void_p]
 lib.printGridPosPoly.restype = None
 lib.printGridPosPoly.argtypes = [c.c_void_p]
 
-lib.getidxGridPosPoly.restype = c.c_void_p
+lib.resizeidxGridPosPoly.restype = None
+lib.resizeidxGridPosPoly.argtypes = [c.c_long, c.c_void_p]
+
+lib.resizewGridPosPoly.restype = None
+lib.resizewGridPosPoly.argtypes = [c.c_long, c.c_void_p]
+
+lib.nelemidxGridPosPoly.restype = c.c_long
+lib.nelemidxGridPosPoly.argtypes = [c.c_void_p]
+
+lib.nelemwGridPosPoly.restype = c.c_long
+lib.nelemwGridPosPoly.argtypes = [c.c_void_p]
+
+lib.getidxGridPosPoly.restype = c.POINTER(c.c_long)
 lib.getidxGridPosPoly.argtypes = [c.c_void_p]
 
-lib.getwGridPosPoly.restype = c.c_void_p
+lib.getwGridPosPoly.restype = c.POINTER(c.c_double)
 lib.getwGridPosPoly.argtypes = [c.c_void_p]
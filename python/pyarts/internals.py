@@ -204,7 +204,7 @@ class LineFunctionsData:
     def len_of_data(self):
         if self.LS in ['DP']:
             shape_len = 0
-        elif self.LS in ['LP', 'VP']:
+        elif self.LS in ['LP', 'VP', 'FVP']:
             shape_len = 2
         elif self.LS in ['SDVP']:
             shape_len = 4
@@ -630,7 +630,9 @@ void xsec_species(Matrix& xsec,
                   const AbsorptionLines& band,
                   const Numeric& isot_ratio,
                   const SpeciesAuxData::AuxType& partfun_type,
-                  const ArrayOfGriddedField1& partfun_data) {
+                  const ArrayOfGriddedField1& partfun_data,
+                  const Numeric& sparse_df,
+                  const Numeric& sparse_lim) {
   // Size of problem
   const Index np = abs_p.nelem();      // number of pressure levels
   const Index nf = f_grid.nelem();     // number of Dirac frequencies
@@ -650,12 +652,20 @@ void xsec_species(Matrix& xsec,
   
   // Constant for all lines
   const Numeric QT0 = single_partition_function(band.T0(), partfun_type, partfun_data);
+  
+  // Contiguous line data shared by all levels
+  const Absorption::PackedLines packed(band);
+  
+  // Lines far from all frequencies are computed on a coarse grid
+  const Linefunctions::SparseLineIndex sparse(f_grid, packed, sparse_df, sparse_lim);
+  Linefunctions::InternalData sparse_scratch(sparse.sparse_f_grid.nelem(), nj);
+  Linefunctions::InternalData sparse_sum(sparse.sparse_f_grid.nelem(), nj);
 
   ArrayOfString fail_msg;
   bool do_abort = false;
 
 #pragma omp parallel for if (!arts_omp_in_parallel() && np > 1) \
-    firstprivate(scratch, sum)
+    firstprivate(scratch, sum, sparse_scratch, sparse_sum)
   for (Index ip = 0; ip < np; ip++) {
     if (do_abort) continue;
     try {
@@ -678,24 +688,49 @@ void xsec_species(Matrix& xsec,
       const Vector line_shape_vmr =
           band.BroadeningSpeciesVMR(abs_vmrs(joker, ip), abs_species);
 
-      Linefunctions::set_cross_section_of_band(scratch,
-                                               sum,
-                                               f_grid,
-                                               band,
-                                               jacobian_quantities,
-                                               jacobian_propmat_positions,
-                                               line_shape_vmr,
-                                               abs_nlte[ip],
-                                               pressure,
-                                               temperature,
-                                               isot_ratio,
-                                               0,
-                                               DC,
-                                               dDCdT,
-                                               QT,
-                                               dQTdT,
-                                               QT0,
-                                               false);
+      if (sparse.DoSparse())
+        Linefunctions::set_sparse_cross_section_of_band(scratch,
+                                                        sum,
+                                                        sparse_scratch,
+                                                        sparse_sum,
+                                                        f_grid,
+                                                        band,
+                                                        packed,
+                                                        sparse,
+                                                        jacobian_quantities,
+                                                        jacobian_propmat_positions,
+                                                        line_shape_vmr,
+                                                        abs_nlte[ip],
+                                                        pressure,
+                                                        temperature,
+                                                        isot_ratio,
+                                                        0,
+                                                        DC,
+                                                        dDCdT,
+                                                        QT,
+                                                        dQTdT,
+                                                        QT0,
+                                                        false);
+      else
+        Linefunctions::set_cross_section_of_band(scratch,
+                                                 sum,
+                                                 f_grid,
+                                                 band,
+                                                 packed,
+                                                 jacobian_quantities,
+                                                 jacobian_propmat_positions,
+                                                 line_shape_vmr,
+                                                 abs_nlte[ip],
+                                                 pressure,
+                                                 temperature,
+                                                 isot_ratio,
+                                                 0,
+                                                 DC,
+                                                 dDCdT,
+                                                 QT,
+                                                 dQTdT,
+                                                 QT0,
+                                                 false);
 
       // absorption cross-section
       MapToEigen(xsec).col(ip).noalias() += sum.F.real();
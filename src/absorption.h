@@ -397,6 +397,8 @@ void set_vmr_from_first_species(Vector& vmr,
  *  \param[in] isot_ratio Isotopologue ratio of this species
  *  \param[in] partfun_type Partition function type for this species
  *  \param[in] partfun_data Partition function model data for this species
+ *  \param[in] sparse_df Spacing of the coarse grid of far lines
+ *  \param[in] sparse_lim Distance to all of f_grid beyond which a line is far, no far lines if not positive
  * 
  *  @author Richard Larsson
  *  @date   2019-10-10
@@ -418,7 +420,9 @@ void xsec_species(Matrix& xsec,
                   const AbsorptionLines& band,
                   const Numeric& isot_ratio,
                   const SpeciesAuxData::AuxType& partfun_type,
-                  const ArrayOfGriddedField1& partfun_data);
+                  const ArrayOfGriddedField1& partfun_data,
+                  const Numeric& sparse_df=0,
+                  const Numeric& sparse_lim=0);
 
 /** Returns the species data
  * 
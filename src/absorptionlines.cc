@@ -32,6 +32,7 @@
 #include "absorptionlines.h"
 
 #include "absorption.h"
+#include "arts_omp.h"
 #include "constants.h"
 #include "file.h"
 #include "global_data.h"
@@ -81,6 +82,290 @@ LineShape::Output Absorption::Lines::ShapeParameters_dT(size_t k, Numeric T, Num
   return x;
 }
 
+Absorption::PackedLines::PackedLines(const Lines& band) :
+  mnlines(band.NumLines()),
+  mnbroadeners(band.NumBroadeners()),
+  mT0(band.T0()),
+  mlinemixinglimit(band.LinemixingLimit()),
+  mF0(mnlines), mI0(mnlines), mE0(mnlines),
+  mglow(mnlines), mgupp(mnlines), mA(mnlines)
+{
+  mlineshape.reserve(mnlines * mnbroadeners);
+  for (Index k=0; k<mnlines; k++) {
+    const auto& line = band.Line(k);
+    mF0[k] = line.F0();
+    mI0[k] = line.I0();
+    mE0[k] = line.E0();
+    mglow[k] = line.g_low();
+    mgupp[k] = line.g_upp();
+    mA[k] = line.A();
+    
+    const auto& ls = line.LineShape().Data();
+    if (Index(ls.size()) not_eq mnbroadeners)
+      throw std::runtime_error("Line shape model does not match the broadening species of the band");
+    mlineshape.insert(mlineshape.end(), ls.cbegin(), ls.cend());
+  }
+  
+  // Group the coefficients by broadener, variable and temperature model.
+  // The broadeners come first so each parameter of a line is summed over
+  // the broadeners in the same order as in ShapeParameters
+  for (Index j=0; j<mnbroadeners; j++) {
+    for (Index iv=0; iv<LineShape::nVars; iv++) {
+      const size_t first = mshapegroups.size();
+      for (Index k=0; k<mnlines; k++) {
+        const auto& mp = mlineshape[k * mnbroadeners + j].Data()[iv];
+        if (mp.type == LineShape::TemperatureModel::None) continue;
+        
+        auto group = std::find_if(mshapegroups.begin() + first, mshapegroups.end(),
+                                  [&](const ShapeGroup& g){return g.type == mp.type;});
+        if (group == mshapegroups.end()) {
+          mshapegroups.push_back(ShapeGroup{mp.type, LineShape::Variable(iv), j, {}, {}, {}, {}, {}});
+          group = mshapegroups.end() - 1;
+        }
+        
+        group->lines.push_back(k);
+        group->X0.push_back(mp.X0);
+        group->X1.push_back(mp.X1);
+        group->X2.push_back(mp.X2);
+        group->X3.push_back(mp.X3);
+      }
+    }
+  }
+}
+
+std::array<Numeric, 5> Absorption::ZeemanComponentTable::LineKey(const Lines& band, Index k) noexcept {
+  const bool by_F = band.UpperQuantumNumber(k, QuantumNumberType::F).isDefined() and
+                    band.LowerQuantumNumber(k, QuantumNumberType::F).isDefined();
+  const auto qn = by_F ? QuantumNumberType::F : QuantumNumberType::J;
+  const auto zm = band.Line(k).Zeeman();
+  return {Numeric(by_F),
+          band.UpperQuantumNumber(k, qn).toNumeric(),
+          band.LowerQuantumNumber(k, qn).toNumeric(),
+          zm.gu(),
+          zm.gl()};
+}
+
+Absorption::ZeemanComponentTable::ZeemanComponentTable(const Lines& band) :
+  mkeys(band.NumLines())
+{
+  const Index nl = band.NumLines();
+  for (Index k=0; k<nl; k++)
+    mkeys[k] = LineKey(band, k);
+  
+  for (auto type: {Zeeman::Polarization::SigmaMinus,
+                   Zeeman::Polarization::Pi,
+                   Zeeman::Polarization::SigmaPlus}) {
+    auto& c = mcomponents[Index(type)];
+    c.start.resize(nl + 1);
+    c.start[0] = 0;
+    for (Index k=0; k<nl; k++) {
+      const Index nz = band.ZeemanCount(k, type);
+      for (Index iz=0; iz<nz; iz++) {
+        c.splitting.push_back(band.ZeemanSplitting(k, type, iz));
+        c.strength.push_back(band.ZeemanStrength(k, type, iz));
+      }
+      c.start[k + 1] = c.start[k] + nz;
+    }
+  }
+}
+
+bool Absorption::ZeemanComponentTable::Matches(const Lines& band) const noexcept {
+  if (Index(mkeys.size()) not_eq band.NumLines()) return false;
+  
+  // Undefined quantum numbers and g-factors are NaN, and so are equal here
+  auto same = [](Numeric a, Numeric b){return a == b or (std::isnan(a) and std::isnan(b));};
+  for (Index k=0; k<band.NumLines(); k++) {
+    const auto key = LineKey(band, k);
+    for (size_t i=0; i<key.size(); i++)
+      if (not same(key[i], mkeys[k][i])) return false;
+  }
+  return true;
+}
+
+namespace {
+/** The member of LineShape::Output holding a variable */
+Numeric LineShape::Output::* output_member(LineShape::Variable var) noexcept {
+  switch (var) {
+    case LineShape::Variable::G0: return &LineShape::Output::G0;
+    case LineShape::Variable::D0: return &LineShape::Output::D0;
+    case LineShape::Variable::G2: return &LineShape::Output::G2;
+    case LineShape::Variable::D2: return &LineShape::Output::D2;
+    case LineShape::Variable::FVC: return &LineShape::Output::FVC;
+    case LineShape::Variable::ETA: return &LineShape::Output::ETA;
+    case LineShape::Variable::Y: return &LineShape::Output::Y;
+    case LineShape::Variable::G: return &LineShape::Output::G;
+    case LineShape::Variable::DV: return &LineShape::Output::DV;
+  }
+  std::terminate();
+}
+}  // namespace
+
+void Absorption::PackedLines::SetShapeParameters(ShapeParameterTable& table, Numeric T, Numeric P, const Vector& vmrs, bool do_temperature) const {
+  using std::log;
+  using std::pow;
+  using LineShape::TemperatureModel;
+  
+  constexpr LineShape::Output zero{0, 0, 0, 0, 0, 0, 0, 0, 0};
+  table.X.assign(mnlines, zero);
+  table.dXdT.assign(do_temperature ? mnlines : 0, zero);
+  
+  // The expressions are those of LineShape::SingleSpeciesModel::compute
+  // and compute_dT, with the switch moved out of the line loop
+  const Numeric T0 = mT0;
+  const Numeric r = T0 / T;
+  for (const auto& g: mshapegroups) {
+    const Numeric vmr = vmrs[g.broadener];
+    const auto m = output_member(g.var);
+    const Index* lines = g.lines.data();
+    const Numeric* x0 = g.X0.data();
+    const Numeric* x1 = g.X1.data();
+    const Numeric* x2 = g.X2.data();
+    const Numeric* x3 = g.X3.data();
+    const size_t n = g.lines.size();
+    
+    LineShape::Output* X = table.X.data();
+    switch (g.type) {
+      case TemperatureModel::T0:
+        for (size_t i=0; i<n; i++) X[lines[i]].*m += vmr * x0[i];
+        break;
+      case TemperatureModel::T1:
+        for (size_t i=0; i<n; i++) X[lines[i]].*m += vmr * (x0[i] * pow(r, x1[i]));
+        break;
+      case TemperatureModel::T2:
+        for (size_t i=0; i<n; i++) X[lines[i]].*m += vmr * (x0[i] * pow(r, x1[i]) * (1 + x2[i] * log(T / T0)));
+        break;
+      case TemperatureModel::T3:
+        for (size_t i=0; i<n; i++) X[lines[i]].*m += vmr * (x0[i] + x1[i] * (T - T0));
+        break;
+      case TemperatureModel::T4:
+        for (size_t i=0; i<n; i++) X[lines[i]].*m += vmr * ((x0[i] + x1[i] * (r - 1.)) * pow(r, x2[i]));
+        break;
+      case TemperatureModel::T5:
+        for (size_t i=0; i<n; i++) X[lines[i]].*m += vmr * (x0[i] * pow(r, 0.25 + 1.5 * x1[i]));
+        break;
+      case TemperatureModel::DPL:
+        for (size_t i=0; i<n; i++) X[lines[i]].*m += vmr * (x0[i] * pow(r, x1[i]) + x2[i] * pow(r, x3[i]));
+        break;
+      default:
+        for (size_t i=0; i<n; i++) X[lines[i]].*m += vmr * mlineshape[lines[i] * mnbroadeners + g.broadener].compute(T, T0, g.var);
+        break;
+    }
+    
+    if (not do_temperature) continue;
+    
+    LineShape::Output* dX = table.dXdT.data();
+    switch (g.type) {
+      case TemperatureModel::T0:
+        break;
+      case TemperatureModel::T1:
+        for (size_t i=0; i<n; i++) dX[lines[i]].*m += vmr * (-x0[i] * x1[i] * pow(r, x1[i]) / T);
+        break;
+      case TemperatureModel::T2:
+        for (size_t i=0; i<n; i++)
+          dX[lines[i]].*m += vmr * (-x0[i] * x1[i] * pow(r, x1[i]) * (x2[i] * log(T / T0) + 1.) / T +
+                                    x0[i] * x2[i] * pow(r, x1[i]) / T);
+        break;
+      case TemperatureModel::T3:
+        for (size_t i=0; i<n; i++) dX[lines[i]].*m += vmr * x1[i];
+        break;
+      case TemperatureModel::T4:
+        for (size_t i=0; i<n; i++)
+          dX[lines[i]].*m += vmr * (-x2[i] * pow(r, x2[i]) * (x0[i] + x1[i] * (r - 1.)) / T -
+                                    T0 * x1[i] * pow(r, x2[i]) / pow(T, 2));
+        break;
+      case TemperatureModel::T5:
+        for (size_t i=0; i<n; i++) dX[lines[i]].*m += vmr * (-x0[i] * pow(r, 1.5 * x1[i] + 0.25) * (1.5 * x1[i] + 0.25) / T);
+        break;
+      case TemperatureModel::DPL:
+        for (size_t i=0; i<n; i++) dX[lines[i]].*m += vmr * (-x0[i] * x1[i] * pow(r, x1[i]) / T + -x2[i] * x3[i] * pow(r, x3[i]) / T);
+        break;
+      default:
+        for (size_t i=0; i<n; i++) dX[lines[i]].*m += vmr * mlineshape[lines[i] * mnbroadeners + g.broadener].compute_dT(T, T0, g.var);
+        break;
+    }
+  }
+  
+  // Same pressure scaling as in LineShape::Model
+  const bool do_line_mixing = DoLineMixing(P);
+  auto scale = [P, do_line_mixing](LineShape::Output& x) {
+    x.G0 *= P;
+    x.D0 *= P;
+    x.G2 *= P;
+    x.D2 *= P;
+    x.FVC *= P;
+    x.Y *= P;
+    x.G *= P * P;
+    x.DV *= P * P;
+    if (not do_line_mixing) x.Y = x.G = x.DV = 0;
+  };
+  for (auto& x: table.X) scale(x);
+  for (auto& x: table.dXdT) scale(x);
+}
+
+LineShape::Output Absorption::PackedLines::ShapeParameters(size_t k, Numeric T, Numeric P, const Vector& vmrs) const noexcept {
+  LineShape::Output x{0, 0, 0, 0, 0, 0, 0, 0, 0};
+  
+  const auto* ls = mlineshape.data() + k * mnbroadeners;
+  for (Index j=0; j<mnbroadeners; j++) {
+    const Numeric vmr = vmrs[j];
+    x.G0 += vmr * ls[j].compute(T, mT0, LineShape::Variable::G0);
+    x.D0 += vmr * ls[j].compute(T, mT0, LineShape::Variable::D0);
+    x.G2 += vmr * ls[j].compute(T, mT0, LineShape::Variable::G2);
+    x.D2 += vmr * ls[j].compute(T, mT0, LineShape::Variable::D2);
+    x.FVC += vmr * ls[j].compute(T, mT0, LineShape::Variable::FVC);
+    x.ETA += vmr * ls[j].compute(T, mT0, LineShape::Variable::ETA);
+    x.Y += vmr * ls[j].compute(T, mT0, LineShape::Variable::Y);
+    x.G += vmr * ls[j].compute(T, mT0, LineShape::Variable::G);
+    x.DV += vmr * ls[j].compute(T, mT0, LineShape::Variable::DV);
+  }
+  
+  // Same pressure scaling as in LineShape::Model
+  x.G0 *= P;
+  x.D0 *= P;
+  x.G2 *= P;
+  x.D2 *= P;
+  x.FVC *= P;
+  x.Y *= P;
+  x.G *= P * P;
+  x.DV *= P * P;
+  
+  if (not DoLineMixing(P)) x.Y = x.G = x.DV = 0;
+  
+  return x;
+}
+
+LineShape::Output Absorption::PackedLines::ShapeParameters_dT(size_t k, Numeric T, Numeric P, const Vector& vmrs) const noexcept {
+  LineShape::Output x{0, 0, 0, 0, 0, 0, 0, 0, 0};
+  
+  const auto* ls = mlineshape.data() + k * mnbroadeners;
+  for (Index j=0; j<mnbroadeners; j++) {
+    const Numeric vmr = vmrs[j];
+    x.G0 += vmr * ls[j].compute_dT(T, mT0, LineShape::Variable::G0);
+    x.D0 += vmr * ls[j].compute_dT(T, mT0, LineShape::Variable::D0);
+    x.G2 += vmr * ls[j].compute_dT(T, mT0, LineShape::Variable::G2);
+    x.D2 += vmr * ls[j].compute_dT(T, mT0, LineShape::Variable::D2);
+    x.FVC += vmr * ls[j].compute_dT(T, mT0, LineShape::Variable::FVC);
+    x.ETA += vmr * ls[j].compute_dT(T, mT0, LineShape::Variable::ETA);
+    x.Y += vmr * ls[j].compute_dT(T, mT0, LineShape::Variable::Y);
+    x.G += vmr * ls[j].compute_dT(T, mT0, LineShape::Variable::G);
+    x.DV += vmr * ls[j].compute_dT(T, mT0, LineShape::Variable::DV);
+  }
+  
+  // Same pressure scaling as in LineShape::Model
+  x.G0 *= P;
+  x.D0 *= P;
+  x.G2 *= P;
+  x.D2 *= P;
+  x.FVC *= P;
+  x.Y *= P;
+  x.G *= P * P;
+  x.DV *= P * P;
+  
+  if (not DoLineMixing(P)) x.Y = x.G = x.DV = 0;
+  
+  return x;
+}
+
 Index Absorption::Lines::LineShapePos(const Index& spec) const noexcept {
   // Is always first if this is self and self broadening exists
   if(mselfbroadening and spec == mquantumidentity.Species())
@@ -168,10 +453,9 @@ Absorption::SingleLineExternal Absorption::ReadFromArtscat3Stream(istream& is) {
   // species index is ArtsMap[<Arts String>].
   static map<String, SpecIsoMap> ArtsMap;
 
-  // Remember if this stuff has already been initialized:
-  static bool hinit = false;
-
-  if (!hinit) {
+  // The lookup data is set up only once. Initializing a static variable
+  // is thread-safe, so the reader can be called from several threads.
+  static const bool hinit = [&]() {
     for (Index i = 0; i < species_data.nelem(); ++i) {
       const SpeciesRecord& sr = species_data[i];
 
@@ -181,8 +465,9 @@ Absorption::SingleLineExternal Absorption::ReadFromArtscat3Stream(istream& is) {
         ArtsMap[buf] = indicies;
       }
     }
-    hinit = true;
-  }
+    return true;
+  }();
+  (void)hinit;
 
   // This always contains the rest of the line to parse. At the
   // beginning the entire line. Line gets shorter and shorter as we
@@ -338,10 +623,9 @@ Absorption::SingleLineExternal Absorption::ReadFromArtscat4Stream(istream& is) {
   // species index is ArtsMap[<Arts String>].
   static map<String, SpecIsoMap> ArtsMap;
 
-  // Remember if this stuff has already been initialized:
-  static bool hinit = false;
-
-  if (!hinit) {
+  // The lookup data is set up only once. Initializing a static variable
+  // is thread-safe, so the reader can be called from several threads.
+  static const bool hinit = [&]() {
     for (Index i = 0; i < species_data.nelem(); ++i) {
       const SpeciesRecord& sr = species_data[i];
 
@@ -352,8 +636,9 @@ Absorption::SingleLineExternal Absorption::ReadFromArtscat4Stream(istream& is) {
         ArtsMap[buf] = indicies;
       }
     }
-    hinit = true;
-  }
+    return true;
+  }();
+  (void)hinit;
 
   // This always contains the rest of the line to parse. At the
   // beginning the entire line. Line gets shorter and shorter as we
@@ -531,13 +816,12 @@ Absorption::SingleLineExternal Absorption::ReadFromArtscat5Stream(istream& is) {
   // species index is ArtsMap[<Arts String>].
   static map<String, SpecIsoMap> ArtsMap;
 
-  // Remember if this stuff has already been initialized:
-  static bool hinit = false;
-
   LineShape::Model line_mixing_model;
   bool lmd_found = false;
 
-  if (!hinit) {
+  // The lookup data is set up only once. Initializing a static variable
+  // is thread-safe, so the reader can be called from several threads.
+  static const bool hinit = [&]() {
     for (Index i = 0; i < species_data.nelem(); ++i) {
       const SpeciesRecord& sr = species_data[i];
 
@@ -548,8 +832,9 @@ Absorption::SingleLineExternal Absorption::ReadFromArtscat5Stream(istream& is) {
         ArtsMap[buf] = indicies;
       }
     }
-    hinit = true;
-  }
+    return true;
+  }();
+  (void)hinit;
 
   // This always contains the rest of the line to parse. At the
   // beginning the entire line. Line gets shorter and shorter as we
@@ -785,14 +1070,13 @@ Absorption::SingleLineExternal Absorption::ReadFromHitran2004Stream(istream& is)
   // ARTS indices of the HITRAN isotopologues.
   static Array<ArrayOfIndex> hiso(100);
 
-  // Remember if this stuff has already been initialized:
-  static bool hinit = false;
-
   // Remember, about which missing species we have already issued a
   // warning:
   static ArrayOfIndex warned_missing;
 
-  if (!hinit) {
+  // The lookup data is set up only once. Initializing a static variable
+  // is thread-safe, so the reader can be called from several threads.
+  static const bool hinit = [&]() {
     // Initialize hspec.
     // The value of missing means that we don't have this species.
     hspec = missing;  // Matpack can set all elements like this.
@@ -845,8 +1129,9 @@ Absorption::SingleLineExternal Absorption::ReadFromHitran2004Stream(istream& is)
       }
     }
 
-    hinit = true;
-  }
+    return true;
+  }();
+  (void)hinit;
 
   // This contains the rest of the line to parse. At the beginning the
   // entire line. Line gets shorter and shorter as we continue to
@@ -1204,14 +1489,13 @@ Absorption::SingleLineExternal Absorption::ReadFromHitranOnlineStream(istream& i
   // ARTS indices of the HITRAN isotopologues.
   static Array<ArrayOfIndex> hiso(100);
 
-  // Remember if this stuff has already been initialized:
-  static bool hinit = false;
-
   // Remember, about which missing species we have already issued a
   // warning:
   static ArrayOfIndex warned_missing;
 
-  if (!hinit) {
+  // The lookup data is set up only once. Initializing a static variable
+  // is thread-safe, so the reader can be called from several threads.
+  static const bool hinit = [&]() {
     // Initialize hspec.
     // The value of missing means that we don't have this species.
     hspec = missing;  // Matpack can set all elements like this.
@@ -1264,8 +1548,9 @@ Absorption::SingleLineExternal Absorption::ReadFromHitranOnlineStream(istream& i
       }
     }
 
-    hinit = true;
-  }
+    return true;
+  }();
+  (void)hinit;
 
   // This contains the rest of the line to parse. At the beginning the
   // entire line. Line gets shorter and shorter as we continue to
@@ -1593,14 +1878,13 @@ Absorption::SingleLineExternal Absorption::ReadFromHitran2001Stream(istream& is)
   // ARTS indices of the HITRAN isotopologues.
   static Array<ArrayOfIndex> hiso(100);
 
-  // Remember if this stuff has already been initialized:
-  static bool hinit = false;
-
   // Remember, about which missing species we have already issued a
   // warning:
   static ArrayOfIndex warned_missing;
 
-  if (!hinit) {
+  // The lookup data is set up only once. Initializing a static variable
+  // is thread-safe, so the reader can be called from several threads.
+  static const bool hinit = [&]() {
     // Initialize hspec.
     // The value of missing means that we don't have this species.
     hspec = missing;  // Matpack can set all elements like this.
@@ -1653,8 +1937,9 @@ Absorption::SingleLineExternal Absorption::ReadFromHitran2001Stream(istream& is)
       }
     }
 
-    hinit = true;
-  }
+    return true;
+  }();
+  (void)hinit;
 
   // This contains the rest of the line to parse. At the beginning the
   // entire line. Line gets shorter and shorter as we continue to
@@ -2441,6 +2726,165 @@ Absorption::SingleLineExternal Absorption::ReadFromLBLRTMStream(istream& is) {
   }
 }
 
+namespace {
+/** Read-only stream buffer over characters owned by someone else
+ * 
+ * Lets a reader parse a part of a block without copying it into a string.
+ */
+class CharViewBuffer : public std::streambuf {
+ public:
+  CharViewBuffer(const char* begin, const char* end) {
+    char* b = const_cast<char*>(begin);
+    setg(b, b, const_cast<char*>(end));
+  }
+};
+
+/** Parses the lines of a block of text in parallel
+ * 
+ * The block is split into chunks at line breaks and the chunks are parsed
+ * concurrently.  Lines below fmin are skipped, and parsing stops at the first
+ * line above fmax.
+ * 
+ * @param[in,out] v The lines, the lines of the block are appended
+ * @param[in] begin Start of the block
+ * @param[in] end End of the block, just after a line break
+ * @param[in] reader A reader of a single line
+ * @param[in] fmin Lowest frequency of lines to keep
+ * @param[in] fmax Highest frequency of lines to keep
+ * @param[in] chunk_size Smallest size of a chunk
+ * @return True if a line above fmax was found
+ */
+bool parallel_read_external_lines_block(std::vector<Absorption::SingleLineExternal>& v,
+                                        const char* begin,
+                                        const char* end,
+                                        Absorption::SingleLineExternal (*reader)(istream&),
+                                        Numeric fmin,
+                                        Numeric fmax,
+                                        size_t chunk_size)
+{
+  const size_t size = end - begin;
+  const size_t nchunks = std::max<size_t>(1, std::min<size_t>(4 * arts_omp_get_max_threads(),
+                                                              size / chunk_size));
+  
+  // Chunk boundaries, moved to the start of the next line
+  std::vector<const char*> starts(nchunks + 1, end);
+  starts[0] = begin;
+  for (size_t i=1; i<nchunks; i++) {
+    const char* pos = std::find(begin + i * (size / nchunks), end, '\n');
+    starts[i] = std::max(starts[i-1], pos == end ? end : pos + 1);
+  }
+  
+  std::vector<std::vector<Absorption::SingleLineExternal>> chunks(nchunks);
+  
+  // Chunks after the first one with a line above fmax are not needed
+  size_t first_stopped = nchunks;
+  
+  bool failed = false;
+  String fail_msg;
+  
+#pragma omp parallel for schedule(dynamic, 1) if (!arts_omp_in_parallel() && nchunks > 1)
+  for (size_t i=0; i<nchunks; i++) {
+    if (failed or i > first_stopped) continue;
+    
+    try {
+      CharViewBuffer buf(starts[i], starts[i+1]);
+      istream is(&buf);
+      auto& c = chunks[i];
+      for (;;) {
+        auto sle = reader(is);
+        if (sle.bad)
+          break;
+        else if (sle.line.F0() < fmin)
+          continue;
+        else if (sle.line.F0() > fmax) {
+#pragma omp critical(parallel_read_external_lines_stop)
+          first_stopped = std::min(first_stopped, i);
+          break;
+        }
+        c.push_back(std::move(sle));
+      }
+    } catch (const std::exception& e) {
+#pragma omp critical(parallel_read_external_lines_fail)
+      {
+        failed = true;
+        fail_msg = e.what();
+      }
+    }
+  }
+  
+  if (failed) throw std::runtime_error(fail_msg);
+  
+  // Merge in order of the text, up to the first line above fmax
+  const size_t nmerge = std::min(first_stopped + 1, nchunks);
+  size_t nlines = v.size();
+  for (size_t i=0; i<nmerge; i++) nlines += chunks[i].size();
+  
+  v.reserve(nlines);
+  for (size_t i=0; i<nmerge; i++)
+    std::move(chunks[i].begin(), chunks[i].end(), std::back_inserter(v));
+  
+  return first_stopped < nchunks;
+}
+}  // namespace
+
+std::vector<Absorption::SingleLineExternal> Absorption::parallel_read_external_lines(istream& is,
+                                                                                   SingleLineExternal (*reader)(istream&),
+                                                                                   Numeric fmin,
+                                                                                   Numeric fmax,
+                                                                                   const String& end_tag,
+                                                                                   size_t chunk_size)
+{
+  // A block holds a few chunks per thread.  More chunks than threads balance
+  // the load when chunks stop early at fmax.
+  const size_t block_size = 4 * arts_omp_get_max_threads() * chunk_size;
+  
+  std::vector<SingleLineExternal> v;
+  std::vector<char> block;
+  size_t carry = 0;  // Incomplete last line of the previous block
+  bool last = false;
+  bool found_end_tag = false;
+  
+  while (not last) {
+    block.resize(carry + block_size);
+    is.read(block.data() + carry, block_size);
+    const size_t nread = carry + size_t(is.gcount());
+    last = nread < block.size();
+    
+    // Only complete lines are parsed, unless the stream has ended
+    const char* begin = block.data();
+    const char* end = begin + nread;
+    if (not last) {
+      const auto r = std::find(std::make_reverse_iterator(end),
+                               std::make_reverse_iterator(begin),
+                               '\n');
+      end = r.base();
+    }
+    
+    if (end_tag.nelem()) {
+      const char* tag = std::search(begin, end, end_tag.begin(), end_tag.end());
+      if (tag not_eq end) {
+        end = tag;
+        last = true;
+        found_end_tag = true;
+      }
+    }
+    
+    if (parallel_read_external_lines_block(v, begin, end, reader, fmin, fmax, chunk_size))
+      return v;
+    
+    carry = begin + nread - end;
+    std::copy(end, begin + nread, block.data());
+  }
+  
+  if (end_tag.nelem() and not found_end_tag) {
+    ostringstream os;
+    os << "The line catalog ends without " << end_tag << ".";
+    throw std::runtime_error(os.str());
+  }
+  
+  return v;
+}
+
 std::vector<Absorption::Lines> Absorption::split_list_of_external_lines(std::vector<SingleLineExternal>& external_lines,
                                                                         const std::vector<QuantumNumberType>& localquantas,
                                                                         const std::vector<QuantumNumberType>& globalquantas)
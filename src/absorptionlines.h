@@ -32,6 +32,7 @@
 #ifndef absorptionlines_h
 #define absorptionlines_h
 
+#include <array>
 #include <vector>
 #include "bifstream.h"
 #include "bofstream.h"
@@ -1177,7 +1178,7 @@ public:
   
   /** Checks if index is a valid lineshapetype */
   bool validIndexForLineShapeType(Index x) {
-    for (auto y: {LineShape::Type::DP, LineShape::Type::LP, LineShape::Type::VP, LineShape::Type::SDVP, LineShape::Type::HTP, })
+    for (auto y: {LineShape::Type::DP, LineShape::Type::LP, LineShape::Type::VP, LineShape::Type::SDVP, LineShape::Type::HTP, LineShape::Type::FVP, })
       if (Index(y) == x)
         return true;
     return false;
@@ -1195,6 +1196,8 @@ public:
       return LineShape::Type::SDVP;
     else if (type == String("HTP"))
       return LineShape::Type::HTP;
+    else if (type == String("FVP"))
+      return LineShape::Type::FVP;
     else
       return LineShape::Type(-1);
   }
@@ -1446,6 +1449,216 @@ public:
   bool OK() const noexcept;
 };  // Lines
 
+/** Line shape parameters of all lines of a band at one atmospheric state
+ * 
+ * Set by PackedLines::SetShapeParameters once per temperature, pressure and
+ * VMRs, and then read by every Zeeman component and mirrored line
+ */
+struct ShapeParameterTable {
+  /** Line shape parameters of each line */
+  std::vector<LineShape::Output> X;
+  
+  /** Temperature derivatives of X, empty if not computed */
+  std::vector<LineShape::Output> dXdT;
+};
+
+/** Packed copy of the line data of a band
+ * 
+ * Holds the per-line numbers needed by the line-by-line calculations in
+ * contiguous arrays instead of inside each SingleLine.  The line shape
+ * coefficients are stored line-major with one SingleSpeciesModel per
+ * broadener, so the inner line loop streams through memory.
+ * 
+ * The copy is not updated if the original Lines changes, so it should be
+ * built right before it is used and then shared by all atmospheric levels
+ */
+class PackedLines {
+  Index mnlines;
+  Index mnbroadeners;
+  Numeric mT0;
+  Numeric mlinemixinglimit;
+  std::vector<Numeric> mF0;
+  std::vector<Numeric> mI0;
+  std::vector<Numeric> mE0;
+  std::vector<Numeric> mglow;
+  std::vector<Numeric> mgupp;
+  std::vector<Numeric> mA;
+  std::vector<LineShape::SingleSpeciesModel> mlineshape;
+  
+  /** Coefficients of one line shape variable of one broadener for all
+   * lines sharing the same temperature model */
+  struct ShapeGroup {
+    LineShape::TemperatureModel type;
+    LineShape::Variable var;
+    Index broadener;
+    std::vector<Index> lines;
+    std::vector<Numeric> X0, X1, X2, X3;
+  };
+  
+  /** The line shape coefficients grouped by broadener, variable and temperature model */
+  std::vector<ShapeGroup> mshapegroups;
+  
+public:
+  /** Default initialization to no lines */
+  PackedLines() noexcept : mnlines(0), mnbroadeners(0), mT0(0), mlinemixinglimit(-1) {}
+  
+  /** Packs the lines of a band
+   * 
+   * @param[in] band The absorption band
+   */
+  explicit PackedLines(const Lines& band);
+  
+  /** Number of lines */
+  Index NumLines() const noexcept {return mnlines;}
+  
+  /** Number of broadening species */
+  Index NumBroadeners() const noexcept {return mnbroadeners;}
+  
+  /** Central frequency of line k */
+  Numeric F0(size_t k) const noexcept {return mF0[k];}
+  
+  /** Reference line strength of line k */
+  Numeric I0(size_t k) const noexcept {return mI0[k];}
+  
+  /** Lower level energy of line k */
+  Numeric E0(size_t k) const noexcept {return mE0[k];}
+  
+  /** Lower level statistical weight of line k */
+  Numeric g_low(size_t k) const noexcept {return mglow[k];}
+  
+  /** Upper level statistical weight of line k */
+  Numeric g_upp(size_t k) const noexcept {return mgupp[k];}
+  
+  /** Einstein spontaneous emission coefficient of line k */
+  Numeric A(size_t k) const noexcept {return mA[k];}
+  
+  /** Returns if the pressure should do line mixing
+   * 
+   * @param[in] P Atmospheric pressure
+   * @return true if no limit or P less than limit
+   */
+  bool DoLineMixing(Numeric P) const noexcept {
+    return mlinemixinglimit < 0 ? true : mlinemixinglimit > P;
+  }
+  
+  /** Line shape parameters
+   * 
+   * Same as Lines::ShapeParameters but from the packed coefficients
+   * 
+   * @param[in] k Line number (less than NumLines())
+   * @param[in] T Atmospheric temperature
+   * @param[in] P Atmospheric pressure
+   * @param[in] vmrs Line broadener species's volume mixing ratio
+   * @return Line shape parameters
+   */
+  LineShape::Output ShapeParameters(size_t k, Numeric T, Numeric P, const Vector& vmrs) const noexcept;
+  
+  /** Line shape parameters temperature derivatives
+   * 
+   * Same as Lines::ShapeParameters_dT but from the packed coefficients
+   * 
+   * @param[in] k Line number (less than NumLines())
+   * @param[in] T Atmospheric temperature
+   * @param[in] P Atmospheric pressure
+   * @param[in] vmrs Line broadener's volume mixing ratio
+   * @return Line shape parameters temperature derivatives
+   */
+  LineShape::Output ShapeParameters_dT(size_t k, Numeric T, Numeric P, const Vector& vmrs) const noexcept;
+  
+  /** Line shape parameters of all lines
+   * 
+   * Gives the same values as ShapeParameters and ShapeParameters_dT for every
+   * line, but evaluates each temperature model for all its lines in one loop
+   * 
+   * @param[out] table The line shape parameters
+   * @param[in] T Atmospheric temperature
+   * @param[in] P Atmospheric pressure
+   * @param[in] vmrs Line broadener species's volume mixing ratio
+   * @param[in] do_temperature Also computes the temperature derivatives
+   */
+  void SetShapeParameters(ShapeParameterTable& table, Numeric T, Numeric P, const Vector& vmrs, bool do_temperature) const;
+};  // PackedLines
+
+/** Zeeman components of all lines of a band
+ * 
+ * Holds the same values as Lines::ZeemanCount, Lines::ZeemanSplitting and
+ * Lines::ZeemanStrength for every line, stored contiguously per polarization
+ * so that no Wigner symbols are evaluated in the line-by-line loop.
+ * 
+ * The values only depend on the quantum numbers and Zeeman models of the
+ * lines, so a table can be kept between atmospheric states for as long as
+ * Matches(band) is true
+ */
+class ZeemanComponentTable {
+  /** Components of one polarization, line k owns [start[k], start[k+1]) */
+  struct Components {
+    std::vector<Index> start;
+    std::vector<Numeric> splitting;
+    std::vector<Numeric> strength;
+  };
+  
+  /** Components of each Zeeman::Polarization */
+  std::array<Components, 3> mcomponents;
+  
+  /** What the components of each line were computed from, see LineKey */
+  std::vector<std::array<Numeric, 5>> mkeys;
+  
+  /** The quantum numbers and Zeeman model that decide the components of line k */
+  static std::array<Numeric, 5> LineKey(const Lines& band, Index k) noexcept;
+  
+  const Components& Select(Zeeman::Polarization type) const noexcept {
+    return mcomponents[Index(type)];
+  }
+  
+public:
+  /** Default initialization to no lines */
+  ZeemanComponentTable() = default;
+  
+  /** Computes the Zeeman components of all lines of a band
+   * 
+   * @param[in] band The absorption band
+   */
+  explicit ZeemanComponentTable(const Lines& band);
+  
+  /** Returns true if the table holds the Zeeman components of band
+   * 
+   * @param[in] band The absorption band
+   */
+  bool Matches(const Lines& band) const noexcept;
+  
+  /** Number of Zeeman components of line k
+   * 
+   * @param[in] k Line number
+   * @param[in] type Type of Zeeman polarization
+   */
+  Index Count(size_t k, Zeeman::Polarization type) const noexcept {
+    const auto& c = Select(type);
+    return c.start[k + 1] - c.start[k];
+  }
+  
+  /** Splitting per unit magnetic field of Zeeman component i of line k
+   * 
+   * @param[in] k Line number
+   * @param[in] type Type of Zeeman polarization
+   * @param[in] i Zeeman component (less than Count(k, type))
+   */
+  Numeric Splitting(size_t k, Zeeman::Polarization type, Index i) const noexcept {
+    const auto& c = Select(type);
+    return c.splitting[c.start[k] + i];
+  }
+  
+  /** Relative strength of Zeeman component i of line k
+   * 
+   * @param[in] k Line number
+   * @param[in] type Type of Zeeman polarization
+   * @param[in] i Zeeman component (less than Count(k, type))
+   */
+  Numeric Strength(size_t k, Zeeman::Polarization type, Index i) const noexcept {
+    const auto& c = Select(type);
+    return c.strength[c.start[k] + i];
+  }
+};  // ZeemanComponentTable
+
 std::ostream& operator<<(std::ostream&, const Lines&);
 std::istream& operator>>(std::istream&, Lines&);
 
@@ -1715,6 +1928,35 @@ SingleLineExternal ReadFromMytran2Stream(istream& is);
  */
 SingleLineExternal ReadFromJplStream(istream& is);
 
+/** Reads many external lines from a stream in parallel
+ * 
+ * The stream is read in blocks of a few chunks per thread.  Each block is
+ * split into chunks at line breaks and the chunks are parsed concurrently
+ * by the reader, directly from the block.  The lines are returned in the
+ * order of the stream, so the result is the same as calling the reader on
+ * the stream until it reports a bad line.
+ * 
+ * Lines below fmin are skipped.  Reading stops at the first line above fmax,
+ * as the catalogs are sorted by frequency.  The rest of the stream is then
+ * not read.
+ * 
+ * The reader must be safe to call from several threads.
+ * 
+ * @param[in,out] is Stream positioned at the first catalog entry
+ * @param[in] reader A reader of a single line, e.g., ReadFromHitran2004Stream
+ * @param[in] fmin Lowest frequency of lines to keep
+ * @param[in] fmax Highest frequency of lines to keep
+ * @param[in] end_tag If not empty, the entries end at this text, and it is an error if the stream ends before it
+ * @param[in] chunk_size Smallest size of a chunk in bytes
+ * @return The lines of the stream
+ */
+std::vector<SingleLineExternal> parallel_read_external_lines(istream& is,
+                                                             SingleLineExternal (*reader)(istream&),
+                                                             Numeric fmin,
+                                                             Numeric fmax,
+                                                             const String& end_tag = "",
+                                                             size_t chunk_size = 1 << 20);
+
 /** Splits a list of lines into proper Lines
  * 
  * Ensures that all but SingleLine list in Lines is the same in a full
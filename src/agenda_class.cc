@@ -135,6 +135,7 @@ void Agenda::check(Workspace& ws, const Verbosity& verbosity) {
   }
 
   set_outputs_to_push_and_dup(verbosity);
+  set_inputs_to_check();
 
   mchecked = true;
 }
@@ -176,23 +177,30 @@ void Agenda::execute(Workspace& ws) const {
   // The array holding the pointers to the getaway functions:
   extern void (*getaways[])(Workspace&, const MRecord&);
 
-  const Index wsv_id_verbosity = get_wsv_id("verbosity");
-  ws.duplicate(wsv_id_verbosity);
+  static const Index wsv_id_verbosity = get_wsv_id("verbosity");
 
-  Verbosity& averbosity = *((Verbosity*)ws[wsv_id_verbosity]);
+  // The verbosity only has to be duplicated if the main agenda flag
+  // changes. Methods modifying the verbosity have it as output and it is
+  // then already duplicated by the caller.
+  const bool dup_verbosity =
+      ((Verbosity*)ws[wsv_id_verbosity])->is_main_agenda() != is_main_agenda();
+  if (dup_verbosity) {
+    ws.duplicate(wsv_id_verbosity);
+    ((Verbosity*)ws[wsv_id_verbosity])->set_main_agenda(is_main_agenda());
+  }
 
-  averbosity.set_main_agenda(is_main_agenda());
+  const Verbosity& averbosity = *((Verbosity*)ws[wsv_id_verbosity]);
 
   ArtsOut1 aout1(averbosity);
-  {
-    //    ostringstream os;  // disabled for performance reasons
-    //    os << "Executing " << name() << "\n"
-    //       << "{\n";
-    //    aout1 << os.str();
+  if (aout1.sufficient_priority()) {
     aout1 << "Executing " << name() << "\n"
           << "{\n";
   }
 
+  // Input checks found to be unnecessary by check(). The main agenda
+  // and agendas modified after the check do the full checks.
+  const bool full_checks = minputs_to_check.nelem() != mml.nelem();
+
   for (Index i = 0; i < mml.nelem(); ++i) {
     const Verbosity& verbosity = *((Verbosity*)ws[wsv_id_verbosity]);
     CREATE_OUT1;
@@ -206,30 +214,41 @@ void Agenda::execute(Workspace& ws) const {
     try {
       {
         if (mrr.isInternal()) {
-          out3 << "- " + mdd.Name() + "\n";
+          if (out3.sufficient_priority()) out3 << "- " + mdd.Name() + "\n";
         } else {
-          out1 << "- " + mdd.Name() + "\n";
+          if (out1.sufficient_priority()) out1 << "- " + mdd.Name() + "\n";
         }
       }
 
-      {  // Check if all input variables are initialized:
-        const ArrayOfIndex& v(mrr.In());
-        for (Index s = 0; s < v.nelem(); ++s)
-          if ((s != v.nelem() - 1 || !mdd.SetMethod()) &&
-              !ws.is_initialized(v[s]))
-            throw runtime_error(
-                "Method " + mdd.Name() +
-                " needs input variable: " + Workspace::wsv_data[v[s]].Name());
-      }
+      if (full_checks) {
+        {  // Check if all input variables are initialized:
+          const ArrayOfIndex& v(mrr.In());
+          for (Index s = 0; s < v.nelem(); ++s)
+            if ((s != v.nelem() - 1 || !mdd.SetMethod()) &&
+                !ws.is_initialized(v[s]))
+              throw runtime_error("Method " + mdd.Name() +
+                                  " needs input variable: " +
+                                  Workspace::wsv_data[v[s]].Name());
+        }
 
-      {  // Check if all output variables which are also used as input
-        // are initialized
-        const ArrayOfIndex& v = mdd.InOut();
+        {  // Check if all output variables which are also used as input
+          // are initialized
+          const ArrayOfIndex& v = mdd.InOut();
+          for (Index s = 0; s < v.nelem(); ++s)
+            if (!ws.is_initialized(mrr.Out()[v[s]]))
+              throw runtime_error("Method " + mdd.Name() +
+                                  " needs input variable: " +
+                                  Workspace::wsv_data[mrr.Out()[v[s]]].Name());
+        }
+      } else {
+        // Check the remaining input variables, including outputs which
+        // are also used as input:
+        const ArrayOfIndex& v = minputs_to_check[i];
         for (Index s = 0; s < v.nelem(); ++s)
-          if (!ws.is_initialized(mrr.Out()[v[s]]))
+          if (!ws.is_initialized(v[s]))
             throw runtime_error("Method " + mdd.Name() +
                                 " needs input variable: " +
-                                Workspace::wsv_data[mrr.Out()[v[s]]].Name());
+                                Workspace::wsv_data[v[s]].Name());
       }
 
       // Call the getaway function:
@@ -257,7 +276,49 @@ void Agenda::execute(Workspace& ws) const {
 
   aout1 << "}\n";
 
-  ws.pop_free(wsv_id_verbosity);
+  if (dup_verbosity) ws.pop_free(wsv_id_verbosity);
+}
+
+//! Find the method inputs that have to be checked at runtime
+/*!
+  An input variable that is an output of an earlier method in the agenda
+  is always initialized when the method is executed. Such inputs are left
+  out of the lists that execute checks, all other inputs are kept. Agendas
+  containing Delete are always fully checked.
+*/
+void Agenda::set_inputs_to_check() {
+  using global_data::md_data;
+
+  minputs_to_check.resize(0);
+
+  set<Index> set_by_agenda;
+  Array<ArrayOfIndex> inputs_to_check;
+  inputs_to_check.reserve(mml.nelem());
+
+  for (const MRecord& method : mml) {
+    const MdRecord& mdd = md_data[method.Id()];
+
+    // Delete is supergeneric, so its expanded methods are found by name:
+    if (mdd.Name() == "Delete") return;
+
+    ArrayOfIndex to_check;
+
+    const ArrayOfIndex& v = method.In();
+    for (Index s = 0; s < v.nelem(); ++s)
+      if ((s != v.nelem() - 1 || !mdd.SetMethod()) &&
+          set_by_agenda.find(v[s]) == set_by_agenda.end())
+        to_check.push_back(v[s]);
+
+    const ArrayOfIndex& vio = mdd.InOut();
+    for (Index s = 0; s < vio.nelem(); ++s)
+      if (set_by_agenda.find(method.Out()[vio[s]]) == set_by_agenda.end())
+        to_check.push_back(method.Out()[vio[s]]);
+
+    inputs_to_check.push_back(to_check);
+    set_by_agenda.insert(method.Out().begin(), method.Out().end());
+  }
+
+  minputs_to_check = inputs_to_check;
 }
 
 //! Retrieve indexes of all input and output WSVs
@@ -281,7 +342,6 @@ void Agenda::set_outputs_to_push_and_dup(const Verbosity& verbosity) {
   const Index WsmAgendaExecuteIndex = MdMap.find("AgendaExecute")->second;
   const Index WsmAgendaExecuteExclIndex =
       MdMap.find("AgendaExecuteExclusive")->second;
-  const Index WsmDeleteIndex = MdMap.find("Delete")->second;
   const Index WsvAgendaGroupIndex = WsvGroupMap.find("Agenda")->second;
 
   for (Array<MRecord>::const_iterator method = mml.begin(); method != mml.end();
@@ -302,7 +362,7 @@ void Agenda::set_outputs_to_push_and_dup(const Verbosity& verbosity) {
        * of output variables to force a duplication of those variables.
        * It avoids deleting variables outside the agenda's scope.
        */
-    if (method->Id() == WsmDeleteIndex) {
+    if (md_data[method->Id()].Name() == "Delete") {
       souts.insert(gins.begin(), gins.end());
     }
 
@@ -48,6 +48,7 @@ class Agenda {
         mml(),
         moutput_push(),
         moutput_dup(),
+        minputs_to_check(),
         main_agenda(false),
         mchecked(false) { /* Nothing to do here */
   }
@@ -60,6 +61,7 @@ class Agenda {
         mml(x.mml),
         moutput_push(x.moutput_push),
         moutput_dup(x.moutput_dup),
+        minputs_to_check(x.minputs_to_check),
         main_agenda(x.main_agenda),
         mchecked(x.mchecked) { /* Nothing to do here */
   }
@@ -78,6 +80,7 @@ class Agenda {
     mchecked = false;
   }
   void set_outputs_to_push_and_dup(const Verbosity& verbosity);
+  void set_inputs_to_check();
   bool is_input(Workspace& ws, Index var) const;
   bool is_output(Index var) const;
   void set_name(const String& nname);
@@ -100,6 +103,9 @@ class Agenda {
 
   ArrayOfIndex moutput_dup;
 
+  /** Per method, the input variables that execute has to check. */
+  Array<ArrayOfIndex> minputs_to_check;
+
   //! Is set to true if this is the main agenda.
   bool main_agenda;
 
@@ -285,6 +291,7 @@ inline Agenda& Agenda::operator=(const Agenda& x) {
   mname = x.mname;
   moutput_push = x.moutput_push;
   moutput_dup = x.moutput_dup;
+  minputs_to_check = x.minputs_to_check;
   mchecked = x.mchecked;
   return *this;
 }
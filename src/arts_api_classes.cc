@@ -545,8 +545,12 @@ BasicInputOutputCAPI(ArrayOfGridPos)
 
 // GridPosPoly
 BasicInterfaceCAPI(GridPosPoly)
-VoidStructGetterCAPI(GridPosPoly, idx)
-VoidStructGetterCAPI(GridPosPoly, w)
+void resizeidxGridPosPoly(Index n, void * data) {static_cast<GridPosPoly *>(data) -> idx.resize(n);}
+void resizewGridPosPoly(Index n, void * data) {static_cast<GridPosPoly *>(data) -> w.resize(n);}
+Index nelemidxGridPosPoly(void * data) {return static_cast<GridPosPoly *>(data) -> idx.nelem();}
+Index nelemwGridPosPoly(void * data) {return static_cast<GridPosPoly *>(data) -> w.nelem();}
+Index * getidxGridPosPoly(void * data) {return static_cast<GridPosPoly *>(data) -> idx.data();}
+Numeric * getwGridPosPoly(void * data) {return static_cast<GridPosPoly *>(data) -> w.data();}
 VoidArrayCAPI(ArrayOfGridPosPoly)
 BasicInterfaceCAPI(ArrayOfGridPosPoly)
 Index xmlreadArrayOfGridPosPoly(void *, char *) {return 1;}
@@ -409,8 +409,12 @@ extern "C" {
     
     // GridPosPoly
     BasicInterfaceCAPI(GridPosPoly)
-    VoidStructGetterCAPI(GridPosPoly, idx)
-    VoidStructGetterCAPI(GridPosPoly, w)
+    DLL_PUBLIC void resizeidxGridPosPoly(Index, void *);
+    DLL_PUBLIC void resizewGridPosPoly(Index, void *);
+    DLL_PUBLIC Index nelemidxGridPosPoly(void *);
+    DLL_PUBLIC Index nelemwGridPosPoly(void *);
+    DLL_PUBLIC Index * getidxGridPosPoly(void *);
+    DLL_PUBLIC Numeric * getwGridPosPoly(void *);
     VoidArrayCAPI(ArrayOfGridPosPoly)
     BasicInterfaceCAPI(ArrayOfGridPosPoly)
     BasicInputOutputCAPI(ArrayOfGridPosPoly)
@@ -138,3 +138,30 @@ void arts_omp_set_dynamic(int i _U_)
   // Nothing to do here.
 #endif
 }
+
+//! Flag for task based parallelization, see arts_omp_tasking
+static bool arts_omp_tasking_flag = false;
+
+//! Whether loops shall be run as tasks
+/*!
+  A calculation that runs its outermost loop as OpenMP tasks sets this
+  flag for the duration of its parallel region. Inner loops, which
+  would otherwise run serially inside the parallel region, then also
+  create tasks, so that all levels are balanced by the task scheduler.
+
+  \return True inside a parallel region started in tasking mode.
+*/
+bool arts_omp_tasking() {
+  return arts_omp_tasking_flag && arts_omp_in_parallel();
+}
+
+//! Set the flag for task based parallelization
+/*!
+  Must only be called outside of parallel regions.
+
+  \param tasking Turn tasking mode on or off.
+*/
+void arts_omp_set_tasking(bool tasking) {
+  assert(!arts_omp_in_parallel());
+  arts_omp_tasking_flag = tasking;
+}
@@ -50,4 +50,38 @@ void arts_omp_set_nested(int i);
 
 void arts_omp_set_dynamic(int i);
 
+bool arts_omp_tasking();
+
+void arts_omp_set_tasking(bool tasking);
+
+//! Run chunks of a loop as OpenMP tasks
+/*!
+  Splits the iterations [0, n) into chunks of chunk_size iterations,
+  runs body(first, last) for each chunk as a task, and waits for the
+  tasks. Without OMP support the chunks are run one after the other.
+
+  The body must not throw, exceptions have to be handled inside it, as
+  for the body of a parallel loop.
+
+  Each task should make its own copy of the workspace (WorkspaceCopy)
+  inside the body. Copies made when the tasks are created would be
+  destroyed by another thread than the one that made them.
+
+  \param n          Number of iterations.
+  \param chunk_size Number of iterations per task.
+  \param body       Callable taking the first and one past the last
+                    iteration of a chunk.
+*/
+template <typename ChunkBody>
+void arts_omp_task_chunks(const long n,
+                          const long chunk_size,
+                          const ChunkBody& body) {
+  for (long first = 0; first < n; first += chunk_size) {
+    const long last = first + chunk_size < n ? first + chunk_size : n;
+#pragma omp task default(shared) firstprivate(first, last)
+    body(first, last);
+  }
+#pragma omp taskwait
+}
+
 #endif  // arts_omp_h
@@ -17,6 +17,7 @@
  * Copyright (C) 2002, 2003 Simon Peter <dn.tlp@gmx.net>
  */
 
+#include <algorithm>
 #include <cstring>
 #include <stdexcept>
 
@@ -359,6 +360,28 @@ binistream::Int binistream::peekInt(unsigned int size) {
   return val;
 }
 
+void binistream::readDoubleArray(double *data, unsigned long n) {
+  if (getFlag(FloatIEEE) && (system_flags & FloatIEEE) &&
+      sizeof(double) == 8) {
+    // Compatible system, read the whole block at once and fix the byte
+    // order afterwards if necessary
+    getRaw((char *)data, (streamsize)(n * 8));
+
+    if (getFlag(BigEndian) ^ (system_flags & BigEndian)) {
+      for (unsigned long i = 0; i < n; i++) {
+        Byte *b = (Byte *)(data + i);
+        for (unsigned int j = 0; j < 4; j++) {
+          const Byte t = b[j];
+          b[j] = b[7 - j];
+          b[7 - j] = t;
+        }
+      }
+    }
+  } else {
+    for (unsigned long i = 0; i < n; i++) data[i] = readFloat(Double);
+  }
+}
+
 binistream::Float binistream::peekFloat(FType ft) {
   Float val = readFloat(ft);
 
@@ -677,6 +700,30 @@ void binostream::float2ieee_double(Float num, Byte *bytes) {
 
 #endif  // BINIO_WITH_MATH
 
+void binostream::writeDoubleArray(const double *data, unsigned long n) {
+  if (getFlag(FloatIEEE) && (system_flags & FloatIEEE) &&
+      sizeof(double) == 8) {
+    if (!(getFlag(BigEndian) ^ (system_flags & BigEndian))) {
+      // Compatible system and byte order, write the whole block at once
+      putRaw((const char *)data, (streamsize)(n * 8));
+    } else {
+      // Swap the byte order in a buffer and write it in blocks
+      const unsigned long bufsize = 1024;
+      Byte buf[bufsize * 8];
+      for (unsigned long i0 = 0; i0 < n; i0 += bufsize) {
+        const unsigned long nbuf = std::min(bufsize, n - i0);
+        const Byte *in = (const Byte *)(data + i0);
+        for (unsigned long i = 0; i < nbuf; i++)
+          for (unsigned int j = 0; j < 8; j++)
+            buf[i * 8 + j] = in[i * 8 + 7 - j];
+        putRaw((const char *)buf, (streamsize)(nbuf * 8));
+      }
+    }
+  } else {
+    for (unsigned long i = 0; i < n; i++) writeFloat(data[i], Double);
+  }
+}
+
 unsigned long binostream::writeString(const char *str, unsigned long amount) {
   unsigned int i;
 
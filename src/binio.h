@@ -121,6 +121,8 @@ class binistream : virtual public binio {
 
   Int readInt(unsigned int size);
   Float readFloat(FType ft);
+  //! Read n IEEE-754 doubles into contiguous memory with a single read
+  void readDoubleArray(double *data, unsigned long n);
   unsigned long readString(char *str, unsigned long amount);
   unsigned long readString(char *str, unsigned long maxlen, const char delim);
 #if BINIO_ENABLE_STRING
@@ -149,6 +151,8 @@ class binostream : virtual public binio {
 
   void writeInt(Int val, unsigned int size);
   void writeFloat(Float f, FType ft);
+  //! Write n doubles from contiguous memory with a single write
+  void writeDoubleArray(const double *data, unsigned long n);
   unsigned long writeString(const char *str, unsigned long amount = 0);
 #if BINIO_ENABLE_STRING
   unsigned long writeString(const std::string &str);
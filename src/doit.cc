@@ -37,6 +37,7 @@
 #include <stdexcept>
 #include "agenda_class.h"
 #include "array.h"
+#include "arts_omp.h"
 #include "auto_md.h"
 #include "check_input.h"
 #include "cloudbox.h"
@@ -55,6 +56,7 @@
 #include "xml_io.h"
 
 extern const Numeric PI;
+extern const Numeric DEG2RAD;
 extern const Numeric RAD2DEG;
 
 //FIXME function name of 'rte_step_doit_replacement' should be replaced by
@@ -2108,3 +2110,196 @@ void doit_scat_fieldNormalize(Workspace& ws,
   else
     out2 << os.str();
 }
+
+void doit_pha_mat_point3D(Workspace& ws,
+                          Tensor6View pha_mat,
+                          Tensor5& pha_mat_spt,
+                          Tensor4& pha_mat_local,
+                          const Agenda& pha_mat_spt_agenda,
+                          const Tensor4& pnd_field,
+                          const Index& p_index,
+                          const Index& lat_index,
+                          const Index& lon_index,
+                          const Numeric& rtp_temperature,
+                          const Verbosity& verbosity) {
+  const Index Nza = pha_mat.nvitrines();
+  const Index Naa = pha_mat.nshelves();
+  const Index stokes_dim = pha_mat.ncols();
+
+  pha_mat_spt.resize(pnd_field.nbooks(), Nza, Naa, stokes_dim, stokes_dim);
+  pha_mat_spt = 0.;
+
+  // aa = 0 is the same as aa = 360, see doit_scat_fieldCalc:
+  for (Index aa_index_local = 1; aa_index_local < Naa; aa_index_local++) {
+    for (Index za_index_local = 0; za_index_local < Nza; za_index_local++) {
+      pha_mat_spt_agendaExecute(ws,
+                                pha_mat_spt,
+                                za_index_local,
+                                lat_index,
+                                lon_index,
+                                p_index,
+                                aa_index_local,
+                                rtp_temperature,
+                                pha_mat_spt_agenda);
+
+      pha_matCalc(pha_mat_local,
+                  pha_mat_spt,
+                  pnd_field,
+                  3,
+                  p_index,
+                  lat_index,
+                  lon_index,
+                  verbosity);
+
+      pha_mat(za_index_local, aa_index_local, joker, joker, joker, joker) =
+          pha_mat_local;
+    }
+  }
+}
+
+void doit_scat_weights(Matrix& weights,
+                       ConstVectorView za_grid,
+                       ConstVectorView aa_grid) {
+  const Index Nza = za_grid.nelem();
+  const Index Naa = aa_grid.nelem();
+
+  weights.resize(Nza, Naa);
+  weights = 0.;
+
+  if (Naa == 1) {
+    // As AngIntegrate_trapezoid for an azimuth independent integrand,
+    // divided by 2 PI:
+    for (Index i = 0; i < Nza - 1; i++) {
+      const Numeric dza = 0.5 * DEG2RAD * (za_grid[i + 1] - za_grid[i]);
+      weights(i, 0) += dza * sin(za_grid[i] * DEG2RAD);
+      weights(i + 1, 0) += dza * sin(za_grid[i + 1] * DEG2RAD);
+    }
+  } else {
+    // As AngIntegrate_trapezoid_opti for equidistant grids:
+    const Numeric stepsize_za = 180. / (Numeric)(Nza - 1);
+    const Numeric stepsize_aa = 360. / (Numeric)(Naa - 1);
+    for (Index i = 0; i < Nza; i++) {
+      const Numeric w_za = (i == 0 || i == Nza - 1) ? 1. : 2.;
+      for (Index j = 0; j < Naa; j++) {
+        const Numeric w_aa = (j == 0 || j == Naa - 1) ? 1. : 2.;
+        weights(i, j) = w_za * w_aa * 0.25 * DEG2RAD * DEG2RAD * stepsize_za *
+                        stepsize_aa * sin(za_grid[i] * DEG2RAD);
+      }
+    }
+  }
+}
+
+void doit_scat_kernel_point(MatrixView kernel,
+                            ConstTensor6View pha_mat,
+                            ConstMatrixView weights) {
+  const Index Nza_out = pha_mat.nvitrines();
+  const Index Naa_out = pha_mat.nshelves();
+  const Index Nza = pha_mat.nbooks();
+  const Index Naa = pha_mat.npages();
+  const Index stokes_dim = pha_mat.ncols();
+
+  assert(is_size(weights, Nza, Naa));
+  assert(kernel.nrows() == Nza_out * Naa_out * stokes_dim);
+
+  kernel = 0.;
+
+  if (kernel.ncols() == Nza * stokes_dim) {
+    // The incoming field depends on the zenith angle only (1D):
+    assert(Naa_out == 1);
+    for (Index za_out = 0; za_out < Nza_out; za_out++) {
+      for (Index za_in = 0; za_in < Nza; za_in++) {
+        for (Index aa_in = 0; aa_in < Naa; aa_in++) {
+          const Numeric w = weights(za_in, aa_in);
+          for (Index i = 0; i < stokes_dim; i++) {
+            for (Index j = 0; j < stokes_dim; j++) {
+              kernel(za_out * stokes_dim + i, za_in * stokes_dim + j) +=
+                  w * pha_mat(za_out, 0, za_in, aa_in, i, j);
+            }
+          }
+        }
+      }
+    }
+  } else {
+    // The incoming field is taken at the propagation direction (3D):
+    assert(kernel.ncols() == stokes_dim);
+    for (Index za_out = 0; za_out < Nza_out; za_out++) {
+      for (Index aa_out = 0; aa_out < Naa_out; aa_out++) {
+        const Index row = (za_out * Naa_out + aa_out) * stokes_dim;
+        for (Index za_in = 0; za_in < Nza; za_in++) {
+          for (Index aa_in = 0; aa_in < Naa; aa_in++) {
+            const Numeric w = weights(za_in, aa_in);
+            for (Index i = 0; i < stokes_dim; i++) {
+              for (Index j = 0; j < stokes_dim; j++) {
+                kernel(row + i, j) +=
+                    w * pha_mat(za_out, aa_out, za_in, aa_in, i, j);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+void doit_scat_field_from_kernel(Tensor6View doit_scat_field,
+                                 ConstTensor3View doit_scat_kernel,
+                                 ConstTensor6View cloudbox_field_mono) {
+  const Index Nlat = cloudbox_field_mono.nshelves();
+  const Index Nlon = cloudbox_field_mono.nbooks();
+  const Index Nza = cloudbox_field_mono.npages();
+  const Index Naa = cloudbox_field_mono.nrows();
+  const Index stokes_dim = cloudbox_field_mono.ncols();
+  const Index n_points = doit_scat_kernel.npages();
+  const bool field_at_all_za = doit_scat_kernel.ncols() != stokes_dim;
+
+  assert(n_points == cloudbox_field_mono.nvitrines() * Nlat * Nlon);
+  assert(doit_scat_kernel.nrows() == Nza * Naa * stokes_dim);
+
+  Vector field_in(doit_scat_kernel.ncols());
+  Vector field_out(doit_scat_kernel.nrows());
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && n_points > 1) \
+    firstprivate(field_in, field_out)
+  for (Index i_point = 0; i_point < n_points; i_point++) {
+    const Index p_index = i_point / (Nlat * Nlon);
+    const Index lat_index = (i_point / Nlon) % Nlat;
+    const Index lon_index = i_point % Nlon;
+
+    if (field_at_all_za) {
+      // 1D: The scattered field of each direction depends on the
+      // radiation field of all zenith angles.
+      for (Index za = 0; za < Nza; za++)
+        for (Index j = 0; j < stokes_dim; j++)
+          field_in[za * stokes_dim + j] =
+              cloudbox_field_mono(p_index, lat_index, lon_index, za, 0, j);
+
+      mult(field_out, doit_scat_kernel(i_point, joker, joker), field_in);
+    } else {
+      // 3D: The kernel is applied to the radiation field at the
+      // propagation direction.
+      for (Index za = 0; za < Nza; za++) {
+        for (Index aa = 0; aa < Naa; aa++) {
+          const Index row = (za * Naa + aa) * stokes_dim;
+          for (Index i = 0; i < stokes_dim; i++) {
+            field_out[row + i] = 0.;
+            for (Index j = 0; j < stokes_dim; j++)
+              field_out[row + i] +=
+                  doit_scat_kernel(i_point, row + i, j) *
+                  cloudbox_field_mono(p_index, lat_index, lon_index, za, aa, j);
+          }
+        }
+      }
+    }
+
+    for (Index za = 0; za < Nza; za++)
+      for (Index aa = 0; aa < Naa; aa++)
+        for (Index i = 0; i < stokes_dim; i++)
+          doit_scat_field(p_index, lat_index, lon_index, za, aa, i) =
+              field_out[(za * Naa + aa) * stokes_dim + i];
+  }
+
+  // aa = 0 is the same as aa = 180:
+  if (!field_at_all_za && Naa > 1)
+    doit_scat_field(joker, joker, joker, joker, 0, joker) =
+        doit_scat_field(joker, joker, joker, joker, Naa - 1, joker);
+}
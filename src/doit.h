@@ -615,6 +615,92 @@ void za_gridOpt(  //Output:
     const Numeric& acc,
     const Index& scat_za_interp);
 
+//! Phase matrices of a 3D cloudbox grid point for all directions
+/*!
+  Executes pha_mat_spt_agenda for each propagation direction of the
+  grid point, and sums over the scattering elements with pha_matCalc.
+  These are the phase matrices used by doit_scat_fieldCalc. The
+  propagation directions with azimuth index 0 are not calculated, they
+  are the same as the last azimuth angle.
+
+  \param[in,out] ws Current workspace
+  \param[out]    pha_mat Phase matrices. Dimension: [za_grid, aa_grid,
+                 za_grid, aa_grid, stokes_dim, stokes_dim], the first
+                 two for the propagation direction.
+  \param[in,out] pha_mat_spt Scratch tensor.
+  \param[in,out] pha_mat_local Scratch tensor.
+  \param[in]     pha_mat_spt_agenda Calculates the phase matrices of
+                 the scattering elements.
+  \param[in]     pnd_field Particle number density field
+  \param[in]     p_index Pressure index inside the cloudbox
+  \param[in]     lat_index Latitude index inside the cloudbox
+  \param[in]     lon_index Longitude index inside the cloudbox
+  \param[in]     rtp_temperature Temperature at the grid point
+  \param[in]     verbosity Verbosity setting
+*/
+void doit_pha_mat_point3D(Workspace& ws,
+                          Tensor6View pha_mat,
+                          Tensor5& pha_mat_spt,
+                          Tensor4& pha_mat_local,
+                          const Agenda& pha_mat_spt_agenda,
+                          const Tensor4& pnd_field,
+                          const Index& p_index,
+                          const Index& lat_index,
+                          const Index& lon_index,
+                          const Numeric& rtp_temperature,
+                          const Verbosity& verbosity);
+
+//! Integration weights of the scattering integral
+/*!
+  The weights reproduce the trapezoidal integration of
+  doit_scat_fieldCalc: AngIntegrate_trapezoid divided by 2 PI if there
+  is a single azimuth angle, otherwise AngIntegrate_trapezoid_opti for
+  equidistant grids.
+
+  \param[out] weights Integration weights. Dimension: [za_grid, aa_grid]
+  \param[in]  za_grid Zenith angle grid
+  \param[in]  aa_grid Azimuth angle grid
+*/
+void doit_scat_weights(Matrix& weights,
+                       ConstVectorView za_grid,
+                       ConstVectorView aa_grid);
+
+//! Scattering kernel of a cloudbox grid point
+/*!
+  Combines the phase matrices with the integration weights, so that the
+  scattering integral becomes a matrix-vector product, see
+  *doit_scat_kernel*.
+
+  If the kernel has za_grid * stokes_dim columns, it is applied to the
+  radiation field of all incoming zenith angles (1D). If it has
+  stokes_dim columns, it is applied to the radiation field at the
+  propagation direction, as done by doit_scat_fieldCalc for 3D.
+
+  \param[out] kernel Scattering kernel. The rows are ordered as
+              [za_grid, aa_grid, stokes_dim] of the propagation direction.
+  \param[in]  pha_mat Phase matrices of the grid point, as one grid point
+              of pha_mat_doit.
+  \param[in]  weights Integration weights from doit_scat_weights.
+*/
+void doit_scat_kernel_point(MatrixView kernel,
+                            ConstTensor6View pha_mat,
+                            ConstMatrixView weights);
+
+//! Scattered field from the scattering kernel
+/*!
+  Calculates doit_scat_field as doit_scat_fieldCalc does, but by
+  multiplying the precalculated scattering kernel with the radiation
+  field of each cloudbox grid point.
+
+  \param[out] doit_scat_field Scattered field
+  \param[in]  doit_scat_kernel Scattering kernel, see
+              doit_scat_kernel_point.
+  \param[in]  cloudbox_field_mono Radiation field
+*/
+void doit_scat_field_from_kernel(Tensor6View doit_scat_field,
+                                 ConstTensor3View doit_scat_kernel,
+                                 ConstTensor6View cloudbox_field_mono);
+
 //! Normalization of scattered field
 /*!
   Calculate the scattered extinction field and apply the
@@ -38,12 +38,15 @@
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <limits>
 #include <stdexcept>
 
 // For getdir
 #include <dirent.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 
@@ -596,6 +599,56 @@ void make_filename_unique(String& filename, const String& extension) {
   filename = newfilename.str();
 }
 
+////////////////////////////////////////////////////////////////////////////
+//   Read-only memory mapping of files
+////////////////////////////////////////////////////////////////////////////
+
+/** Map a file read-only into memory.
+
+ \param[in] filename  Name of the file
+
+ \throws runtime_error if the file can not be opened or mapped.
+ */
+ReadOnlyFileMap::ReadOnlyFileMap(const String& filename)
+    : mfilename(expand_path(filename)), mdata(nullptr), msize(0) {
+  const int fd = open(mfilename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    ostringstream os;
+    os << "Cannot open file " << mfilename << " for mapping: "
+       << strerror(errno);
+    throw runtime_error(os.str());
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    const int err = errno;
+    close(fd);
+    ostringstream os;
+    os << "Cannot stat file " << mfilename << ": " << strerror(err);
+    throw runtime_error(os.str());
+  }
+  msize = size_t(st.st_size);
+
+  if (msize > 0) {
+    void* p = mmap(nullptr, msize, PROT_READ, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED) {
+      const int err = errno;
+      close(fd);
+      ostringstream os;
+      os << "Cannot map file " << mfilename << ": " << strerror(err);
+      throw runtime_error(os.str());
+    }
+    mdata = static_cast<const char*>(p);
+  }
+
+  // The mapping stays valid after the descriptor is closed
+  close(fd);
+}
+
+ReadOnlyFileMap::~ReadOnlyFileMap() {
+  if (mdata) munmap(const_cast<char*>(mdata), msize);
+}
+
 ////////////////////////////////////////////////////////////////////////////
 //   IO manipulation classes for parsing nan and inf
 ////////////////////////////////////////////////////////////////////////////
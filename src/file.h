@@ -82,6 +82,40 @@ void list_directory(ArrayOfString& files, String dirname);
 
 void make_filename_unique(String& filename, const String& extension = "");
 
+////////////////////////////////////////////////////////////////////////////
+//   Read-only memory mapping of files
+////////////////////////////////////////////////////////////////////////////
+
+/** A read-only memory mapping of a whole file.
+
+ The file is mapped shared, so several processes mapping the same file
+ share the page cache and pages are only read from disk when they are
+ first touched. The mapping is released when the object is destroyed.
+ */
+class ReadOnlyFileMap {
+ public:
+  explicit ReadOnlyFileMap(const String& filename);
+
+  ReadOnlyFileMap(const ReadOnlyFileMap&) = delete;
+  ReadOnlyFileMap& operator=(const ReadOnlyFileMap&) = delete;
+
+  ~ReadOnlyFileMap();
+
+  /** Start of the mapped file. */
+  const char* data() const { return mdata; }
+
+  /** Size of the mapped file in bytes. */
+  size_t size() const { return msize; }
+
+  /** Name of the mapped file. */
+  const String& filename() const { return mfilename; }
+
+ private:
+  String mfilename;
+  const char* mdata;
+  size_t msize;
+};
+
 ////////////////////////////////////////////////////////////////////////////
 //   IO manipulation classes for parsing nan and inf
 ////////////////////////////////////////////////////////////////////////////
@@ -24,9 +24,14 @@
 */
 
 #include "gas_abs_lookup.h"
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
+#include <cstring>
+#include <fstream>
+#include "arts_omp.h"
 #include "check_input.h"
+#include "file.h"
 #include "interpolation.h"
 #include "interpolation_poly.h"
 #include "logic.h"
@@ -131,6 +136,16 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
   const Index n_f_grid = f_grid.nelem();
   const Index n_p_grid = p_grid.nelem();
 
+  if (IsCompressed()) {
+    ostringstream os;
+    os << "The lookup table has reduced precision and can not be adapted.\n"
+       << "Adapt the table before you compress it.";
+    throw runtime_error(os.str());
+  }
+
+  // The cross sections, from memory or from the mapped file:
+  const ConstTensor4View table = XsecView();
+
   out2 << "  Original table: " << n_species << " species, " << n_f_grid
        << " frequencies.\n"
        << "  Adapt to:       " << n_current_species << " species, "
@@ -226,7 +241,7 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
       //     b = n_species
       //     c = n_f_grid
       //     d = n_p_grid
-      chk_size("xsec", xsec, 1, n_species, n_f_grid, n_p_grid);
+      chk_size("xsec", table, 1, n_species, n_f_grid, n_p_grid);
     } else {
       //     Standard case (temperature perturbations,
       //     but no vmr perturbations):
@@ -234,7 +249,7 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
       //     b = n_species
       //     c = n_f_grid
       //     d = n_p_grid
-      chk_size("xsec", xsec, t_pert.nelem(), n_species, n_f_grid, n_p_grid);
+      chk_size("xsec", table, t_pert.nelem(), n_species, n_f_grid, n_p_grid);
     }
   } else {
     //     Full case (with temperature perturbations and
@@ -248,9 +263,18 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
     Index c = n_f_grid;
     Index d = n_p_grid;
 
-    chk_size("xsec", xsec, a, b, c, d);
+    chk_size("xsec", table, a, b, c, d);
   }
 
+  // The temperature derivative, if any, must match xsec:
+  if (HasTemperatureDerivative())
+    chk_size("dxsec_dT",
+             dxsec_dT,
+             table.nbooks(),
+             table.npages(),
+             table.nrows(),
+             table.ncols());
+
   // We also need indices to the positions of the original species
   // data in xsec. Nonlinear species take more space, therefor the
   // position in xsec is not the same as the position in species.
@@ -401,11 +425,43 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
   }
 
   // Absorption coefficients:
-  new_table.xsec.resize(
-      xsec.nbooks(),
-      n_current_species + n_current_nonlinear_species * (n_nls_pert - 1),
-      n_current_f_grid,
-      xsec.ncols());
+
+  // A mapped table can be kept mapped if the species are the same and
+  // the frequencies are a contiguous part of the table's frequencies.
+  // Only the pages of these frequencies will then ever be read.
+  bool keep_mapping = IsMapped() and n_current_species == n_species and
+                      n_current_f_grid > 0;
+  for (Index i = 0; keep_mapping and i < n_current_species; ++i)
+    keep_mapping = i_current_species[i] == i;
+  for (Index i = 1; keep_mapping and i < n_current_f_grid; ++i)
+    keep_mapping = i_current_f_grid[i] == i_current_f_grid[0] + i;
+
+  if (keep_mapping) {
+    out2 << "  Keeping the table mapped, " << n_current_f_grid
+         << " frequencies are used.\n";
+    new_table.xsec_map = xsec_map;
+    new_table.xsec_mapped =
+        xsec_mapped + i_current_f_grid[0] * xsec_mapped_fstride;
+    new_table.xsec_mapped_shape[0] = table.nbooks();
+    new_table.xsec_mapped_shape[1] = table.npages();
+    new_table.xsec_mapped_shape[2] = n_current_f_grid;
+    new_table.xsec_mapped_shape[3] = table.ncols();
+    new_table.xsec_mapped_fstride = xsec_mapped_fstride;
+  } else {
+    new_table.xsec.resize(
+        table.nbooks(),
+        n_current_species + n_current_nonlinear_species * (n_nls_pert - 1),
+        n_current_f_grid,
+        table.ncols());
+  }
+
+  if (HasTemperatureDerivative()) {
+    new_table.dxsec_dT.resize(
+        table.nbooks(),
+        n_current_species + n_current_nonlinear_species * (n_nls_pert - 1),
+        n_current_f_grid,
+        table.ncols());
+  }
 
   // We have to copy the right species and frequencies from the old to
   // the new table. Temperature perturbations and pressure grid remain
@@ -423,11 +479,26 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
     //      cout << "i_s / sp / n_v = " << i_s << " / " << sp << " / " << n_v << endl;
     //      cout << "orig_pos = " << original_spec_pos_in_xsec[i_current_species[i_s]] << endl;
 
+    // Do the temperature derivative, if the table has it:
+    for (Index i_f = 0; i_f < new_table.dxsec_dT.nrows(); ++i_f) {
+      if (i_current_species[i_s] >= 0) {
+        new_table.dxsec_dT(Range(joker), Range(sp, n_v), i_f, Range(joker)) =
+            dxsec_dT(Range(joker),
+                     Range(original_spec_pos_in_xsec[i_current_species[i_s]],
+                           n_v),
+                     i_current_f_grid[i_f],
+                     Range(joker));
+      } else {
+        new_table.dxsec_dT(Range(joker), Range(sp, n_v), i_f, Range(joker)) =
+            NAN;
+      }
+    }
+
     // Do frequencies:
-    for (Index i_f = 0; i_f < n_current_f_grid; ++i_f) {
+    for (Index i_f = 0; i_f < n_current_f_grid and not keep_mapping; ++i_f) {
       if (i_current_species[i_s] >= 0) {
         new_table.xsec(Range(joker), Range(sp, n_v), i_f, Range(joker)) =
-            xsec(Range(joker),
+            table(Range(joker),
                  Range(original_spec_pos_in_xsec[i_current_species[i_s]], n_v),
                  i_current_f_grid[i_f],
                  Range(joker));
@@ -458,70 +529,22 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
   gridpos_poly(fgp_default, f_grid, f_grid, 0);
 }
 
-//! Extract scalar gas absorption coefficients from the lookup table.
-/*!  
-  This carries out a simple interpolation in temperature,
-  pressure, and sometimes frequency. The interpolated value is then 
-  scaled by the ratio between
-  actual VMR and reference VMR. In the case of nonlinear species the
-  interpolation goes also over H2O VMR.
-
-  All input parameters 
-  must be in the range covered by the table. Violation will result in a
-  runtime error. Those checks are here, because they are a bit
-  difficult to make outside, due to the irregularity of the
-  grids. Otherwise there are no runtime checks in this function, only
-  assertions. This is, because the function is called many times
-  inside the RT calculation.
-
-  In this case pressure is not an altitude coordinate, so we are free
-  to choose the type of interpolation that gives lowest interpolation
-  errors or is easiest. I tested both linear and log p interpolation
-  with the result that log p interpolation is slightly better, so that
-  is used.
-
-  \param[out] sga A Matrix with scalar gas absorption coefficients
-              [1/m]. Dimension is adjusted automatically to [n_species,f_grid].
- 
+//! Check the lookup table and the interpolation orders before extraction.
+/*!
   \param[in] p_interp_order Interpolation order for pressure.
-
   \param[in] t_interp_order Interpolation order for temperature.
- 
   \param[in] h2o_interp_order Interpolation order for water vapor.
- 
-  \param[in] f_interp_order Interpolation order for frequency. This should
-             normally be zero, except for calculations with Doppler shift.
- 
-  \param[in] p The pressures [Pa].
-
-  \param[in] T The temperature [K].
-
-  \param[in] abs_vmrs The VMRs [absolute number]. Dimension: [species].  
-
-  \param[in] new_f_grid The frequency grid where absorption should be 
-             extracted. With frequency interpolation order 0, this has
-             to match the lookup table's internal grid, or have exactly
-             1 element. With higher frequency interpolation order it can be
-             an arbitrary grid.
- 
-  \param[in] extpolfac How much extrapolation to allow. Useful for Doppler 
-             calculations. (But there even better to make the lookup table
-             grid wider and denser than the calculation grid.)
- 
-  \date 2002-09-20, 2003-02-22, 2007-05-22, 2013-04-29
+  \param[in] f_interp_order Interpolation order for frequency.
+  \param[in] n_vmrs The number of VMRs that will be given for extraction.
 
-  \author Stefan Buehler
+  \return The position of H2O among the species, or -1 if there are no
+          nonlinear species.
 */
-void GasAbsLookup::Extract(Matrix& sga,
-                           const Index& p_interp_order,
-                           const Index& t_interp_order,
-                           const Index& h2o_interp_order,
-                           const Index& f_interp_order,
-                           const Numeric& p,
-                           const Numeric& T,
-                           ConstVectorView abs_vmrs,
-                           ConstVectorView new_f_grid,
-                           const Numeric& extpolfac) const {
+Index GasAbsLookup::CheckExtraction(const Index& p_interp_order,
+                                    const Index& t_interp_order,
+                                    const Index& h2o_interp_order,
+                                    const Index& f_interp_order,
+                                    const Index& n_vmrs) const {
   // 1. Obtain some properties of the lookup table:
 
   // Number of gas species in the table:
@@ -542,10 +565,6 @@ void GasAbsLookup::Extract(Matrix& sga,
   // Number of nonlinear species perturbations:
   const Index n_nls_pert = nls_pert.nelem();
 
-  // Number of frequencies in new_f_grid, the frequency grid for which we
-  // want to extract.
-  const Index n_new_f_grid = new_f_grid.nelem();
-
   // 2. First some checks on the lookup table itself:
 
   // Most checks here are asserts, because they check the internal
@@ -597,7 +616,13 @@ void GasAbsLookup::Extract(Matrix& sga,
     //            << b << ", "
     //            << c << ", "
     //            << d << "\n";
-    assert(is_size(xsec, a, b, c, d));
+    if (IsCompressed())
+      assert(xsec_compressed_shape[0] == a and
+             xsec_compressed_shape[1] == b and
+             xsec_compressed_shape[2] == c and xsec_compressed_shape[3] == d);
+    else
+      assert(is_size(XsecView(), a, b, c, d));
+    assert(not HasTemperatureDerivative() or is_size(dxsec_dT, a, b, c, d));
   })
 
   // Make sure that log_p_grid is initialized:
@@ -650,7 +675,7 @@ void GasAbsLookup::Extract(Matrix& sga,
   // 3. Checks on the input variables:
 
   // Check that abs_vmrs has the right dimension:
-  if (!is_size(abs_vmrs, n_species)) {
+  if (n_vmrs != n_species) {
     ostringstream os;
     os << "Number of species in lookup table does not match number\n"
        << "of species for which you want to extract absorption.\n"
@@ -659,14 +684,33 @@ void GasAbsLookup::Extract(Matrix& sga,
     throw runtime_error(os.str());
   }
 
-  // 4. Set up some things we will need later on:
+  return h2o_index;
+}
 
-  // 4.a Frequency grid positions
+//! Frequency grid positions for extraction.
+/*!
+  \param[out] fgp_local Storage for the grid positions if they cannot be
+              taken from the table itself.
+  \param[in] f_interp_order Interpolation order for frequency.
+  \param[in] new_f_grid The frequency grid where absorption should be
+             extracted.
+
+  \return Either the default grid positions of the table, or fgp_local.
+*/
+const ArrayOfGridPosPoly& GasAbsLookup::FrequencyGridPositions(
+    ArrayOfGridPosPoly& fgp_local,
+    const Index& f_interp_order,
+    ConstVectorView new_f_grid) const {
+  // Number of frequencies in the table:
+  const Index n_f_grid = f_grid.nelem();
+
+  // Number of frequencies in new_f_grid, the frequency grid for which we
+  // want to extract.
+  const Index n_new_f_grid = new_f_grid.nelem();
 
   // Frequency grid positions. The pointer is used to save copying of the
   // default from the lookup table.
   const ArrayOfGridPosPoly* fgp;
-  ArrayOfGridPosPoly fgp_local;
 
   // With f_interp_order 0 the frequency grid has to have the same size as in the
   // lookup table, or exactly one element. If it matches the lookup table, we
@@ -756,66 +800,155 @@ void GasAbsLookup::Extract(Matrix& sga,
     gridpos_poly(fgp_local, f_grid, new_f_grid, f_interp_order);
   }
 
-  // 4.b Other stuff
+  return *fgp;
+}
+
+//! Check that a pressure is inside the range covered by the table.
+/*!
+  \param[in] p The pressure [Pa].
+*/
+void GasAbsLookup::CheckPressure(const Numeric& p) const {
+  // Number of pressure grid points in the table:
+  const Index n_p_grid = p_grid.nelem();
+
+  // Check that p is inside the grid. (p_grid is sorted in decreasing order.)
+  const Numeric p_max = p_grid[0] + 0.5 * (p_grid[0] - p_grid[1]);
+  const Numeric p_min = p_grid[n_p_grid - 1] -
+                        0.5 * (p_grid[n_p_grid - 2] - p_grid[n_p_grid - 1]);
+  if ((p > p_max) || (p < p_min)) {
+    ostringstream os;
+    os << "Problem with gas absorption lookup table.\n"
+       << "Pressure p is outside the range covered by the lookup table.\n"
+       << "Your p value is " << p << " Pa.\n"
+       << "The allowed range is " << p_min << " to " << p_max << ".\n"
+       << "The pressure grid range in the table is " << p_grid[n_p_grid - 1]
+       << " to " << p_grid[0] << ".\n"
+       << "We allow a bit of extrapolation, but NOT SO MUCH!";
+    throw runtime_error(os.str());
+  }
+}
+
+namespace {
+// Defined below, with the other helpers for compressed tables:
+template <typename Field>
+void interp_compressed(Tensor3View ia,
+                       ConstTensor4View itw,
+                       const GridPosPoly& tp,
+                       const GridPosPoly& vp,
+                       const ArrayOfGridPosPoly& fgp,
+                       const Field& a);
+}  // namespace
+
+//! Extract scalar gas absorption coefficients for one point.
+/*!
+  This is the interpolation part of Extract, with all checks of the
+  table and the input, and the frequency and pressure grid positions,
+  done by the caller. The scratch data are resized as needed, so they
+  can be reused over many points without new allocations.
+
+  \param[out] sga Scalar gas absorption coefficients [1/m]. Must have
+              size [n_species, new_f_grid].
+  \param[out] dsga_dT Temperature derivative of sga [1/(m K)]. Same
+              size as sga, or empty if not wanted.
+  \param[out] dsga_dnls Derivative of sga with respect to the H2O VMR,
+              through the cross sections of the nonlinear species only
+              [1/m]. Same size as sga, or empty if not wanted.
+  \param[in,out] scratch Scratch data, one per thread.
+  \param[in] p_interp_order Interpolation order for pressure.
+  \param[in] t_interp_order Interpolation order for temperature.
+  \param[in] h2o_interp_order Interpolation order for water vapor.
+  \param[in] f_interp_order Interpolation order for frequency.
+  \param[in] pgp The grid position of log(p) in log_p_grid.
+  \param[in] fgp The frequency grid positions, see FrequencyGridPositions.
+  \param[in] non_linear Flag for each species if it is nonlinear.
+  \param[in] h2o_index As returned by CheckExtraction.
+  \param[in] p The pressure [Pa].
+  \param[in] T The temperature [K].
+  \param[in] abs_vmrs The VMRs [absolute number]. Dimension: [species].
+  \param[in] extpolfac How much extrapolation to allow.
+*/
+void GasAbsLookup::ExtractPoint(MatrixView sga,
+                                MatrixView dsga_dT,
+                                MatrixView dsga_dnls,
+                                ExtractScratch& scratch,
+                                const Index& p_interp_order,
+                                const Index& t_interp_order,
+                                const Index& h2o_interp_order,
+                                const Index& f_interp_order,
+                                const GridPosPoly& pgp,
+                                const ArrayOfGridPosPoly& fgp,
+                                const ArrayOfIndex& non_linear,
+                                const Index& h2o_index,
+                                const Numeric& p,
+                                const Numeric& T,
+                                ConstVectorView abs_vmrs,
+                                const Numeric& extpolfac) const {
+  // The cross sections, from memory or from the mapped file. Compressed
+  // tables are read by InterpCompressed instead:
+  const ConstTensor4View table =
+      IsCompressed() ? ConstTensor4View(xsec) : XsecView();
+
+  // Number of gas species in the table:
+  const Index n_species = species.nelem();
+
+  // Number of nonlinear species:
+  const Index n_nls = nonlinear_species.nelem();
+
+  // Number of temperature perturbations:
+  const Index n_t_pert = t_pert.nelem();
+
+  // Number of nonlinear species perturbations:
+  const Index n_nls_pert = nls_pert.nelem();
+
+  // Number of frequencies to extract:
+  const Index n_new_f_grid = fgp.nelem();
+
+  assert(is_size(sga, n_species, n_new_f_grid));
 
   // Flag for temperature interpolation, if this is not 0 we want
   // to do T interpolation:
   const Index do_T = n_t_pert;
 
-  // Set up a logical array for the nonlinear species
-  ArrayOfIndex non_linear(n_species, 0);
-  for (Index s = 0; s < n_nls; ++s) {
-    non_linear[nonlinear_species[s]] = 1;
-  }
+  // Flags for the derivatives, they are only calculated if asked for:
+  const bool do_dT = not dsga_dT.empty();
+  const bool do_dnls = not dsga_dnls.empty() and n_nls > 0;
+  assert(not do_dT or is_size(dsga_dT, n_species, n_new_f_grid));
+  assert(dsga_dnls.empty() or is_size(dsga_dnls, n_species, n_new_f_grid));
+
+  // Without a stored temperature derivative, the derivative of the
+  // temperature interpolation is used:
+  const bool do_dT_interp = do_dT and do_T and not HasTemperatureDerivative();
+
 
   // Calculate the number density for the given pressure and
   // temperature:
   // n = n0*T0/p0 * p/T or n = p/kB/t, ideal gas law
   const Numeric n = number_density(p, T);
 
-  // 5. Determine pressure grid position and interpolation weights:
-
-  // Check that p is inside the grid. (p_grid is sorted in decreasing order.)
-  {
-    const Numeric p_max = p_grid[0] + 0.5 * (p_grid[0] - p_grid[1]);
-    const Numeric p_min = p_grid[n_p_grid - 1] -
-                          0.5 * (p_grid[n_p_grid - 2] - p_grid[n_p_grid - 1]);
-    if ((p > p_max) || (p < p_min)) {
-      ostringstream os;
-      os << "Problem with gas absorption lookup table.\n"
-         << "Pressure p is outside the range covered by the lookup table.\n"
-         << "Your p value is " << p << " Pa.\n"
-         << "The allowed range is " << p_min << " to " << p_max << ".\n"
-         << "The pressure grid range in the table is " << p_grid[n_p_grid - 1]
-         << " to " << p_grid[0] << ".\n"
-         << "We allow a bit of extrapolation, but NOT SO MUCH!";
-      throw runtime_error(os.str());
-    }
-  }
-
-  // For sure, we need to store the pressure grid position.
-  // We do the interpolation in log(p). Test have shown that this
-  // gives slightly better accuracy than interpolating in p directly.
-  ArrayOfGridPosPoly pgp(1);
-  gridpos_poly(pgp, log_p_grid, log(p), p_interp_order);
+  // Scratch data:
+  Tensor5& xsec_pre_interpolated = scratch.xsec_pre_interpolated;
+  Tensor4& itw_withH2O = scratch.itw_withH2O;
+  Tensor4& itw_noH2O = scratch.itw_noH2O;
 
   // Pressure interpolation weights:
-  Vector pitw;
+  Vector& pitw = scratch.pitw;
   pitw.resize(p_interp_order + 1);
-  interpweights(pitw, pgp[0]);
+  interpweights(pitw, pgp);
 
   // Define also other grid positions and interpolation weights here, so that
   // we do not have to allocate them over and over in the loops below.
 
   // Define the ArrayOfGridPosPoly that corresponds to "no interpolation at all".
-  ArrayOfGridPosPoly gp_trivial(1);
+  ArrayOfGridPosPoly& gp_trivial = scratch.gp_trivial;
+  gp_trivial.resize(1);
   gp_trivial[0].idx.resize(1);
   gp_trivial[0].w.resize(1);
   gp_trivial[0].idx[0] = 0;
   gp_trivial[0].w[0] = 1;
 
   // Temperature grid positions.
-  ArrayOfGridPosPoly tgp_withT(1);  // Only a scalar.
+  ArrayOfGridPosPoly& tgp_withT = scratch.tgp_withT;
+  tgp_withT.resize(1);  // Only a scalar.
   ArrayOfGridPosPoly* tgp;  // Pointer to either tgp_withT or gp_trivial.
 
   // Set this_t_interp_order, depending on whether we do T interpolation or not.
@@ -833,7 +966,43 @@ void GasAbsLookup::Extract(Matrix& sga,
   // H2O(VMR) grid positions. vgp is what will be used in the interpolation.
   // Depending on species, it is either pointed to gp_trivial, or to vgp_h2o.
   ArrayOfGridPosPoly* vgp;
-  ArrayOfGridPosPoly vgp_h2o(1);  // only a scalar
+  ArrayOfGridPosPoly& vgp_h2o = scratch.vgp_h2o;
+  vgp_h2o.resize(1);  // only a scalar
+
+  // Grid positions, weights, and scratch data for the derivatives. The
+  // weights of the derivative grid positions add up to zero, therefore
+  // the interpolation is done with interp_compressed, or
+  // InterpCompressed, which do not check the weights.
+  ArrayOfGridPosPoly& tgp_dT = scratch.tgp_dT;
+  ArrayOfGridPosPoly& vgp_dh2o = scratch.vgp_dh2o;
+  tgp_dT.resize(1);
+  vgp_dh2o.resize(1);
+  Tensor4& itw_dT_withH2O = scratch.itw_dT_withH2O;
+  Tensor4& itw_dT_noH2O = scratch.itw_dT_noH2O;
+  Tensor4& itw_dnls = scratch.itw_dnls;
+  Tensor3& dres = scratch.dres;
+  dres.resize(1, 1, n_new_f_grid);
+  if (do_dT) dsga_dT = 0;
+  if (not dsga_dnls.empty()) dsga_dnls = 0;
+
+  const auto interp_derivative = [&](Tensor3View res,
+                                     ConstTensor4View itw_d,
+                                     const ArrayOfGridPosPoly& tgp_d,
+                                     const ArrayOfGridPosPoly& vgp_d,
+                                     const Index p_index,
+                                     const Index first_profile) {
+    if (IsCompressed())
+      InterpCompressed(res, itw_d, tgp_d, vgp_d, fgp, p_index, first_profile);
+    else
+      interp_compressed(res,
+                        itw_d,
+                        tgp_d[0],
+                        vgp_d[0],
+                        fgp,
+                        [&](Index t, Index v, Index f) -> Numeric {
+                          return table(t, first_profile + v, f, p_index);
+                        });
+  };
 
   // 6. We do the T and VMR interpolation for the pressure levels
   // that are used in the pressure interpolation. (How many depends on
@@ -853,14 +1022,13 @@ void GasAbsLookup::Extract(Matrix& sga,
   //   H2O         (always 1)
   //   Frequency
 
-  Tensor5 xsec_pre_interpolated;
   xsec_pre_interpolated.resize(
       p_interp_order + 1, n_species, 1, 1, n_new_f_grid);
 
   // Define variables for interpolation weights outside the loops.
   // We will make itw point to either the weights with H2O interpolation, or
   // the ones without.
-  Tensor4 itw_withH2O, itw_noH2O, *itw;
+  Tensor4* itw;
 
   for (Index pi = 0; pi < p_interp_order + 1; ++pi) {
     // Throw a runtime error if one of the reference VMR profiles is zero, but
@@ -881,7 +1049,7 @@ void GasAbsLookup::Extract(Matrix& sga,
     //        }
 
     // Index into p_grid:
-    const Index this_p_grid_index = pgp[0].idx[pi];
+    const Index this_p_grid_index = pgp.idx[pi];
 
     // Determine temperature grid position. This is only done if we
     // want temperature interpolation, but the variable tgp has to
@@ -942,8 +1110,13 @@ void GasAbsLookup::Extract(Matrix& sga,
       }
 
       gridpos_poly(tgp_withT, t_pert, T_offset, t_interp_order, extpolfac);
+      if (do_dT_interp)
+        gridpos_poly_derivative(tgp_dT[0], tgp_withT[0], t_pert, T_offset);
     }
 
+    // Derivative of the fractional VMR with respect to the H2O VMR:
+    Numeric dfrac_dvmr = 0;
+
     // Determine the H2O VMR grid position. We need to do this only
     // once, since the only species who's VMR is interpolated is
     // H2O. We do this only if there are nonlinear species, but the
@@ -1001,6 +1174,10 @@ void GasAbsLookup::Extract(Matrix& sga,
 
       // For now, do linear interpolation in the fractional VMR.
       gridpos_poly(vgp_h2o, nls_pert, VMR_frac, h2o_interp_order, extpolfac);
+      if (do_dnls) {
+        gridpos_poly_derivative(vgp_dh2o[0], vgp_h2o[0], nls_pert, VMR_frac);
+        dfrac_dvmr = 1 / effective_vmr_ref;
+      }
     }
 
     // Precalculate interpolation weights.
@@ -1013,7 +1190,7 @@ void GasAbsLookup::Extract(Matrix& sga,
                        n_new_f_grid,
                        (this_t_interp_order + 1) * (1) *  // H2O dimension
                            (f_interp_order + 1));
-      interpweights(itw_noH2O, *tgp, gp_trivial, *fgp);
+      interpweights(itw_noH2O, *tgp, gp_trivial, fgp);
     }
     if (n_nls > 0) {
       // Precalculate weights with H2O interpolation if there is at least
@@ -1023,7 +1200,30 @@ void GasAbsLookup::Extract(Matrix& sga,
                          n_new_f_grid,
                          (this_t_interp_order + 1) * (h2o_interp_order + 1) *
                              (f_interp_order + 1));
-      interpweights(itw_withH2O, *tgp, vgp_h2o, *fgp);
+      interpweights(itw_withH2O, *tgp, vgp_h2o, fgp);
+    }
+
+    // The same for the derivatives:
+    if (do_dT_interp and n_nls < n_species) {
+      itw_dT_noH2O.resize(itw_noH2O.nbooks(),
+                          itw_noH2O.npages(),
+                          itw_noH2O.nrows(),
+                          itw_noH2O.ncols());
+      interpweights(itw_dT_noH2O, tgp_dT, gp_trivial, fgp);
+    }
+    if (do_dT_interp and n_nls > 0) {
+      itw_dT_withH2O.resize(itw_withH2O.nbooks(),
+                            itw_withH2O.npages(),
+                            itw_withH2O.nrows(),
+                            itw_withH2O.ncols());
+      interpweights(itw_dT_withH2O, tgp_dT, vgp_h2o, fgp);
+    }
+    if (do_dnls) {
+      itw_dnls.resize(itw_withH2O.nbooks(),
+                      itw_withH2O.npages(),
+                      itw_withH2O.nrows(),
+                      itw_withH2O.ncols());
+      interpweights(itw_dnls, *tgp, vgp_dh2o, fgp);
     }
 
     // 7. Loop species:
@@ -1068,12 +1268,54 @@ void GasAbsLookup::Extract(Matrix& sga,
         itw = &itw_noH2O;
       }
 
+      // Derivatives of the cross sections at this pressure level, added
+      // up over the pressure levels right away:
+      if (do_dT) {
+        if (HasTemperatureDerivative()) {
+          interp(dres,
+                 *itw,
+                 dxsec_dT(Range(joker),
+                          Range(fpi, this_h2o_extent),
+                          Range(joker),
+                          this_p_grid_index),
+                 *tgp,
+                 *vgp,
+                 fgp);
+        } else if (do_T) {
+          interp_derivative(dres,
+                            do_VMR ? itw_dT_withH2O : itw_dT_noH2O,
+                            tgp_dT,
+                            *vgp,
+                            this_p_grid_index,
+                            fpi);
+        } else {
+          dres = 0;
+        }
+        dres *= pitw[pi];
+        dsga_dT(si, Range(joker)) += dres(0, 0, Range(joker));
+      }
+      if (do_dnls and do_VMR) {
+        interp_derivative(
+            dres, itw_dnls, *tgp, vgp_dh2o, this_p_grid_index, fpi);
+        dres *= pitw[pi] * dfrac_dvmr;
+        dsga_dnls(si, Range(joker)) += dres(0, 0, Range(joker));
+      }
+
+      if (IsCompressed()) {
+        InterpCompressed(res, *itw, *tgp, *vgp, fgp, this_p_grid_index, fpi);
+        if (do_VMR)
+          fpi += n_nls_pert;
+        else
+          fpi++;
+        continue;
+      }
+
       // Get the right view on xsec.
       ConstTensor3View this_xsec =
-          xsec(Range(joker),                 // Temperature range
-               Range(fpi, this_h2o_extent),  // VMR profile range
-               Range(joker),                 // Frequency range
-               this_p_grid_index);           // Pressure index
+          table(Range(joker),                 // Temperature range
+                Range(fpi, this_h2o_extent),  // VMR profile range
+                Range(joker),                 // Frequency range
+                this_p_grid_index);           // Pressure index
 
       // Do interpolation.
       interp(res,        // result
@@ -1081,7 +1323,7 @@ void GasAbsLookup::Extract(Matrix& sga,
              this_xsec,  // input
              *tgp,
              *vgp,
-             *fgp);  // grid positions
+             fgp);  // grid positions
 
       // Increase fpi. fpi marks the position of the first profile
       // of the current species in xsec. This is needed to find
@@ -1095,7 +1337,8 @@ void GasAbsLookup::Extract(Matrix& sga,
 
     // fpi should have reached the end of that dimension of xsec. Check
     // this with an assertion:
-    assert(fpi == xsec.npages());
+    assert(fpi ==
+           (IsCompressed() ? xsec_compressed_shape[1] : table.npages()));
 
   }  // End of pressure index loop (below and above gp)
 
@@ -1105,7 +1348,6 @@ void GasAbsLookup::Extract(Matrix& sga,
   // (But for a matrix in frequency and species.) Doing a loop over
   // frequency and species with an interp call inside would be
   // unefficient, so we do this by hand here.
-  sga.resize(n_species, n_new_f_grid);
   sga = 0;
   for (Index pi = 0; pi < p_interp_order + 1; ++pi) {
     // Multiply pre interpolated quantities with pressure interpolation weights.
@@ -1130,9 +1372,918 @@ void GasAbsLookup::Extract(Matrix& sga,
   for (Index si = 0; si < n_species; ++si)
     sga(si, Range(joker)) *= (n * abs_vmrs[si]);
 
+  // The same for the derivatives. The temperature derivative has an
+  // additional term from the number density, dn/dT = -n/T:
+  if (do_dT) {
+    for (Index si = 0; si < n_species; ++si) {
+      dsga_dT(si, Range(joker)) *= (n * abs_vmrs[si]);
+      for (Index iv = 0; iv < n_new_f_grid; ++iv)
+        dsga_dT(si, iv) -= sga(si, iv) / T;
+    }
+  }
+  if (do_dnls) {
+    for (Index si = 0; si < n_species; ++si)
+      dsga_dnls(si, Range(joker)) *= (n * abs_vmrs[si]);
+  }
+
   // That's it, we're done!
 }
 
+//! Extract scalar gas absorption coefficients from the lookup table.
+/*!  
+  This carries out a simple interpolation in temperature,
+  pressure, and sometimes frequency. The interpolated value is then 
+  scaled by the ratio between
+  actual VMR and reference VMR. In the case of nonlinear species the
+  interpolation goes also over H2O VMR.
+
+  All input parameters 
+  must be in the range covered by the table. Violation will result in a
+  runtime error. Those checks are here, because they are a bit
+  difficult to make outside, due to the irregularity of the
+  grids. Otherwise there are no runtime checks in this function, only
+  assertions. This is, because the function is called many times
+  inside the RT calculation.
+
+  In this case pressure is not an altitude coordinate, so we are free
+  to choose the type of interpolation that gives lowest interpolation
+  errors or is easiest. I tested both linear and log p interpolation
+  with the result that log p interpolation is slightly better, so that
+  is used.
+
+  \param[out] sga A Matrix with scalar gas absorption coefficients
+              [1/m]. Dimension is adjusted automatically to [n_species,f_grid].
+ 
+  \param[in] p_interp_order Interpolation order for pressure.
+
+  \param[in] t_interp_order Interpolation order for temperature.
+ 
+  \param[in] h2o_interp_order Interpolation order for water vapor.
+ 
+  \param[in] f_interp_order Interpolation order for frequency. This should
+             normally be zero, except for calculations with Doppler shift.
+ 
+  \param[in] p The pressures [Pa].
+
+  \param[in] T The temperature [K].
+
+  \param[in] abs_vmrs The VMRs [absolute number]. Dimension: [species].  
+
+  \param[in] new_f_grid The frequency grid where absorption should be 
+             extracted. With frequency interpolation order 0, this has
+             to match the lookup table's internal grid, or have exactly
+             1 element. With higher frequency interpolation order it can be
+             an arbitrary grid.
+ 
+  \param[in] extpolfac How much extrapolation to allow. Useful for Doppler 
+             calculations. (But there even better to make the lookup table
+             grid wider and denser than the calculation grid.)
+ 
+  \date 2002-09-20, 2003-02-22, 2007-05-22, 2013-04-29
+
+  \author Stefan Buehler
+*/
+void GasAbsLookup::Extract(Matrix& sga,
+                           const Index& p_interp_order,
+                           const Index& t_interp_order,
+                           const Index& h2o_interp_order,
+                           const Index& f_interp_order,
+                           const Numeric& p,
+                           const Numeric& T,
+                           ConstVectorView abs_vmrs,
+                           ConstVectorView new_f_grid,
+                           const Numeric& extpolfac) const {
+  Matrix dsga_dT, dsga_dnls;
+  Extract(sga,
+          dsga_dT,
+          dsga_dnls,
+          false,
+          false,
+          p_interp_order,
+          t_interp_order,
+          h2o_interp_order,
+          f_interp_order,
+          p,
+          T,
+          abs_vmrs,
+          new_f_grid,
+          extpolfac);
+}
+
+//! Extract scalar gas absorption coefficients and their derivatives.
+/*!
+  As the Extract above, but also gives the derivatives of the absorption
+  coefficients with respect to temperature and H2O VMR, at the cost of
+  a single extraction.
+
+  The temperature derivative is interpolated from the stored derivative
+  of the cross sections, if the table has one (see abs_lookupCalc).
+  Otherwise it is the derivative of the temperature interpolation of the
+  cross sections, which is zero for t_interp_order 0. Both include the
+  change of the number density with temperature.
+
+  The H2O derivative is the derivative of the VMR interpolation of the
+  nonlinear species, for the VMR of the species NonLinearVmrSpecies().
+  It is zero for all other species. The linear scaling of each species
+  with its own VMR is not included, that is simply sga divided by the
+  VMR.
+
+  \param[out] sga As for the Extract above.
+  \param[out] dsga_dT Temperature derivative of sga [1/(m K)]. Same
+              dimension as sga if do_temperature, otherwise empty.
+  \param[out] dsga_dnls Derivative of sga with respect to the H2O VMR,
+              through the nonlinear species [1/m]. Same dimension as sga
+              if do_nls, otherwise empty.
+  \param[in] do_temperature Calculate dsga_dT.
+  \param[in] do_nls Calculate dsga_dnls.
+
+  The other parameters are as for the Extract above.
+*/
+void GasAbsLookup::Extract(Matrix& sga,
+                           Matrix& dsga_dT,
+                           Matrix& dsga_dnls,
+                           const bool do_temperature,
+                           const bool do_nls,
+                           const Index& p_interp_order,
+                           const Index& t_interp_order,
+                           const Index& h2o_interp_order,
+                           const Index& f_interp_order,
+                           const Numeric& p,
+                           const Numeric& T,
+                           ConstVectorView abs_vmrs,
+                           ConstVectorView new_f_grid,
+                           const Numeric& extpolfac) const {
+  // Checks on the table and the interpolation orders:
+  const Index h2o_index = CheckExtraction(p_interp_order,
+                                          t_interp_order,
+                                          h2o_interp_order,
+                                          f_interp_order,
+                                          abs_vmrs.nelem());
+
+  // Frequency grid positions. The reference is used to save copying of the
+  // default from the lookup table.
+  ArrayOfGridPosPoly fgp_local;
+  const ArrayOfGridPosPoly& fgp =
+      FrequencyGridPositions(fgp_local, f_interp_order, new_f_grid);
+
+  // Set up a logical array for the nonlinear species
+  ArrayOfIndex non_linear(species.nelem(), 0);
+  for (Index s = 0; s < nonlinear_species.nelem(); ++s) {
+    non_linear[nonlinear_species[s]] = 1;
+  }
+
+  CheckPressure(p);
+
+  // For sure, we need to store the pressure grid position.
+  // We do the interpolation in log(p). Test have shown that this
+  // gives slightly better accuracy than interpolating in p directly.
+  ArrayOfGridPosPoly pgp(1);
+  gridpos_poly(pgp, log_p_grid, log(p), p_interp_order);
+
+  ExtractScratch scratch;
+  sga.resize(species.nelem(), new_f_grid.nelem());
+  if (do_temperature)
+    dsga_dT.resize(species.nelem(), new_f_grid.nelem());
+  else
+    dsga_dT.resize(0, 0);
+  if (do_nls)
+    dsga_dnls.resize(species.nelem(), new_f_grid.nelem());
+  else
+    dsga_dnls.resize(0, 0);
+  ExtractPoint(sga,
+               dsga_dT,
+               dsga_dnls,
+               scratch,
+               p_interp_order,
+               t_interp_order,
+               h2o_interp_order,
+               f_interp_order,
+               pgp[0],
+               fgp,
+               non_linear,
+               h2o_index,
+               p,
+               T,
+               abs_vmrs,
+               extpolfac);
+}
+
+//! Extract scalar gas absorption coefficients for many points at once.
+/*!
+  Gives the same result as calling the single point Extract for each
+  point, but the checks of the table, the frequency grid positions and
+  weights, and the pressure grid positions are only determined once for
+  all points. The points are visited in order of decreasing pressure, so
+  that consecutive points use the same columns of the table, and the
+  points are shared among threads unless already in a parallel region.
+
+  This is meant for extraction of many atmospheric points, as in
+  abs_coefCalcFromLookup. Radiative transfer calculations do not use it
+  yet. They get the absorption from propmat_clearsky_agenda, which is
+  executed for one propagation path point at a time, so
+  propmat_clearskyAddFromLookup uses the single point Extract. Using this
+  along a path needs an agenda interface that passes all points at once.
+
+  \param[out] sga Scalar gas absorption coefficients [1/m]. Dimension
+              is adjusted automatically to [n_points, n_species, f_grid],
+              so that sga(i, joker, joker) is the output of the single
+              point Extract for point i.
+  \param[in] p_interp_order Interpolation order for pressure.
+  \param[in] t_interp_order Interpolation order for temperature.
+  \param[in] h2o_interp_order Interpolation order for water vapor.
+  \param[in] f_interp_order Interpolation order for frequency.
+  \param[in] p The pressures [Pa]. Dimension: [n_points].
+  \param[in] T The temperatures [K]. Dimension: [n_points].
+  \param[in] abs_vmrs The VMRs [absolute number]. Dimension:
+             [species, n_points].
+  \param[in] new_f_grid The frequency grid where absorption should be
+             extracted, as for the single point Extract.
+  \param[in] extpolfac How much extrapolation to allow.
+*/
+void GasAbsLookup::Extract(Tensor3& sga,
+                           const Index& p_interp_order,
+                           const Index& t_interp_order,
+                           const Index& h2o_interp_order,
+                           const Index& f_interp_order,
+                           ConstVectorView p,
+                           ConstVectorView T,
+                           ConstMatrixView abs_vmrs,
+                           ConstVectorView new_f_grid,
+                           const Numeric& extpolfac) const {
+  const Index n_points = p.nelem();
+
+  if (T.nelem() != n_points || abs_vmrs.ncols() != n_points) {
+    ostringstream os;
+    os << "The number of pressures (" << n_points << "), temperatures ("
+       << T.nelem() << "), and VMR columns (" << abs_vmrs.ncols()
+       << ") must be the same.";
+    throw runtime_error(os.str());
+  }
+
+  // Checks on the table and the interpolation orders:
+  const Index h2o_index = CheckExtraction(p_interp_order,
+                                          t_interp_order,
+                                          h2o_interp_order,
+                                          f_interp_order,
+                                          abs_vmrs.nrows());
+
+  // Frequency grid positions, shared by all points:
+  ArrayOfGridPosPoly fgp_local;
+  const ArrayOfGridPosPoly& fgp =
+      FrequencyGridPositions(fgp_local, f_interp_order, new_f_grid);
+
+  // Set up a logical array for the nonlinear species
+  ArrayOfIndex non_linear(species.nelem(), 0);
+  for (Index s = 0; s < nonlinear_species.nelem(); ++s) {
+    non_linear[nonlinear_species[s]] = 1;
+  }
+
+  sga.resize(n_points, species.nelem(), new_f_grid.nelem());
+  if (n_points == 0) return;
+
+  for (Index ip = 0; ip < n_points; ++ip) CheckPressure(p[ip]);
+
+  // Visit the points in order of decreasing pressure, as p_grid:
+  ArrayOfIndex order(n_points);
+  for (Index ip = 0; ip < n_points; ++ip) order[ip] = ip;
+  std::stable_sort(order.begin(), order.end(), [&](Index a, Index b) {
+    return p[a] > p[b];
+  });
+
+  // Pressure grid positions of all points in one go:
+  Vector log_p(n_points);
+  for (Index io = 0; io < n_points; ++io) log_p[io] = log(p[order[io]]);
+  ArrayOfGridPosPoly pgp(n_points);
+  gridpos_poly(pgp, log_p_grid, log_p, p_interp_order);
+
+  // Scratch data, reused by each thread for all its points:
+  ExtractScratch scratch;
+  Matrix no_derivative;
+
+  ArrayOfString fail_msg;
+  bool do_abort = false;
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && n_points > 1) \
+    schedule(static) firstprivate(scratch)
+  for (Index io = 0; io < n_points; ++io) {
+    if (do_abort) continue;
+    const Index ip = order[io];
+    try {
+      ExtractPoint(sga(ip, joker, joker),
+                   no_derivative,
+                   no_derivative,
+                   scratch,
+                   p_interp_order,
+                   t_interp_order,
+                   h2o_interp_order,
+                   f_interp_order,
+                   pgp[io],
+                   fgp,
+                   non_linear,
+                   h2o_index,
+                   p[ip],
+                   T[ip],
+                   abs_vmrs(joker, ip),
+                   extpolfac);
+    } catch (const std::exception& e) {
+#pragma omp critical(gas_abs_lookup_extract)
+      {
+        do_abort = true;
+        ostringstream os;
+        os << "Point " << ip << ": " << e.what();
+        fail_msg.push_back(os.str());
+      }
+    }
+  }
+
+  if (do_abort) {
+    ostringstream os;
+    os << "Error messages from failed extraction points:\n";
+    for (const auto& msg : fail_msg) os << msg << '\n';
+    throw runtime_error(os.str());
+  }
+}
+
+namespace {
+/** Header tag of mapped lookup table files. */
+const char mapped_table_magic[8] = {'A', 'R', 'T', 'S', 'G', 'A', 'L', '1'};
+
+/** Written to the header to detect files from machines with different
+    byte order. */
+const Index mapped_table_byte_order = 0x0102030405060708;
+
+/** The cross sections start at a multiple of this in mapped table files. */
+const Index mapped_table_page = 4096;
+
+/** A read-only view on the cross sections of a mapped lookup table.
+
+  The protected strided constructor of ConstTensor4View does all the
+  work, this only gives access to it. */
+class MappedXsecView : public ConstTensor4View {
+ public:
+  MappedXsecView(const Numeric* data, const Index* shape, const Index fstride)
+      : ConstTensor4View(const_cast<Numeric*>(data),
+                         Range(0, shape[0], shape[1] * shape[3]),
+                         Range(0, shape[1], shape[3]),
+                         Range(0, shape[2], fstride),
+                         Range(0, shape[3])) {}
+};
+
+/** Sequential reader of the header of a mapped lookup table file. */
+class MappedTableReader {
+ public:
+  explicit MappedTableReader(const ReadOnlyFileMap& map) : mmap(map) {}
+
+  void Read(void* dest, const size_t n) {
+    if (mpos + n > mmap.size()) {
+      ostringstream os;
+      os << "The lookup table file " << mmap.filename() << " is truncated.";
+      throw runtime_error(os.str());
+    }
+    memcpy(dest, mmap.data() + mpos, n);
+    mpos += n;
+  }
+
+  Index ReadIndex() {
+    Index x;
+    Read(&x, sizeof(Index));
+    return x;
+  }
+
+  Index ReadSize() {
+    const Index n = ReadIndex();
+    if (n < 0 or size_t(n) > mmap.size()) {
+      ostringstream os;
+      os << "Invalid size " << n << " in lookup table file "
+         << mmap.filename() << ".";
+      throw runtime_error(os.str());
+    }
+    return n;
+  }
+
+  String ReadString() {
+    String s(ReadSize(), ' ');
+    if (s.size()) Read(&s[0], s.size());
+    return s;
+  }
+
+  void ReadVector(Vector& v) {
+    v.resize(ReadSize());
+    for (Index i = 0; i < v.nelem(); i++) Read(&v[i], sizeof(Numeric));
+  }
+
+ private:
+  const ReadOnlyFileMap& mmap;
+  size_t mpos{0};
+};
+
+/** Binary writers for the header of a mapped lookup table file. */
+void write_mapped_index(ostream& os, const Index x) {
+  os.write(reinterpret_cast<const char*>(&x), sizeof(Index));
+}
+
+void write_mapped_string(ostream& os, const String& s) {
+  write_mapped_index(os, Index(s.size()));
+  os.write(s.data(), s.size());
+}
+
+void write_mapped_vector(ostream& os, ConstVectorView v) {
+  write_mapped_index(os, v.nelem());
+  for (Index i = 0; i < v.nelem(); i++) {
+    const Numeric x = v[i];
+    os.write(reinterpret_cast<const char*>(&x), sizeof(Numeric));
+  }
+}
+}  // namespace
+
+//! Convert to the bit pattern of an IEEE 754 half precision number.
+/*!
+  Rounds to nearest even. Values too large for half precision become
+  infinite, values too small become subnormal or zero. The rounding is
+  done directly from double precision, going through single precision
+  would round twice.
+*/
+std::uint16_t half_from_numeric(const Numeric x) {
+  std::uint64_t b;
+  memcpy(&b, &x, sizeof(b));
+
+  const std::uint64_t sign = (b >> 48) & 0x8000;
+  const std::uint64_t dexp = (b >> 52) & 0x7ff;
+  std::uint64_t mant = b & 0xfffffffffffff;
+
+  // Infinity and NaN
+  if (dexp == 0x7ff) return std::uint16_t(sign | 0x7c00 | (mant ? 0x200 : 0));
+
+  const int exp = int(dexp) - 1023 + 15;
+  if (exp >= 31) return std::uint16_t(sign | 0x7c00);
+
+  if (exp <= 0) {
+    // Subnormal half, or zero
+    if (exp < -10) return std::uint16_t(sign);
+    mant |= std::uint64_t(1) << 52;
+    const int shift = 43 - exp;
+    std::uint64_t h = mant >> shift;
+    const std::uint64_t rem = mant & ((std::uint64_t(1) << shift) - 1);
+    const std::uint64_t halfway = std::uint64_t(1) << (shift - 1);
+    if (rem > halfway or (rem == halfway and (h & 1))) ++h;
+    return std::uint16_t(sign | h);
+  }
+
+  // A carry out of the mantissa correctly increases the exponent
+  std::uint64_t h = (std::uint64_t(exp) << 10) | (mant >> 42);
+  const std::uint64_t rem = mant & ((std::uint64_t(1) << 42) - 1);
+  const std::uint64_t halfway = std::uint64_t(1) << 41;
+  if (rem > halfway or (rem == halfway and (h & 1))) ++h;
+  return std::uint16_t(sign | h);
+}
+
+//! Convert from the bit pattern of an IEEE 754 half precision number.
+/*!
+  Exact, all half precision numbers are also double precision numbers.
+*/
+Numeric numeric_from_half(const std::uint16_t h) {
+  const std::uint32_t sign = std::uint32_t(h & 0x8000) << 16;
+  const std::uint32_t exp = (h >> 10) & 0x1f;
+  const std::uint32_t mant = h & 0x3ff;
+
+  std::uint32_t b;
+  if (exp == 0) {
+    // Zero and subnormals, these are exact in single precision
+    const float f = std::ldexp(float(mant), -24);
+    return sign ? -f : f;
+  } else if (exp == 0x1f) {
+    b = sign | 0x7f800000 | (mant << 13);
+  } else {
+    b = sign | ((exp + 127 - 15) << 23) | (mant << 13);
+  }
+
+  float f;
+  memcpy(&f, &b, sizeof(f));
+  return f;
+}
+
+namespace {
+/** Interpolate compressed cross sections in T, VMR, and frequency.
+
+  The same as the "green" 3D interp of interpolation_poly.cc for a
+  single T and VMR point, but reading the field through a function, so
+  that the decoding is done inside the interpolation loop. The weights
+  are not checked to add up to one, so this is also used with the
+  derivative weights in ExtractPoint.
+
+  \param[out] ia     Interpolated field. Dimension: [1, 1, n_f].
+  \param[in]  itw    Interpolation weights.
+  \param[in]  tp     The grid position for the temperature.
+  \param[in]  vp     The grid position for the VMR.
+  \param[in]  fgp    The grid positions for the frequencies.
+  \param[in]  a      Returns the field value for (T, VMR, frequency).
+*/
+template <typename Field>
+void interp_compressed(Tensor3View ia,
+                       ConstTensor4View itw,
+                       const GridPosPoly& tp,
+                       const GridPosPoly& vp,
+                       const ArrayOfGridPosPoly& fgp,
+                       const Field& a) {
+  assert(is_size(ia, 1, 1, fgp.nelem()));
+
+  for (Index ic = 0; ic < fgp.nelem(); ++ic) {
+    const GridPosPoly& tc = fgp[ic];
+
+    Numeric tia = 0;
+    Index iti = 0;
+    for (const Index t : tp.idx)
+      for (const Index v : vp.idx)
+        for (const Index f : tc.idx) {
+          tia += a(t, v, f) * itw.get(0, 0, ic, iti);
+          ++iti;
+        }
+
+    ia.get(0, 0, ic) = tia;
+  }
+}
+}  // namespace
+
+//! The absorption cross sections of the table.
+/*!
+  For tables read with ReadMapped this is a view directly on the
+  memory mapped file, otherwise it is a view on xsec. Compressed tables
+  have no such view, use XsecTensor() for those.
+
+  \return View on the cross sections. Dimension as for xsec.
+*/
+ConstTensor4View GasAbsLookup::XsecView() const {
+  assert(not IsCompressed());
+  if (not xsec_map) return xsec;
+  return MappedXsecView(xsec_mapped, xsec_mapped_shape, xsec_mapped_fstride);
+}
+
+//! Drop mapped or compressed cross sections of the table, if any.
+/*!
+  Needed before xsec is filled by other means.
+*/
+void GasAbsLookup::ClearXsecStorage() {
+  xsec_map.reset();
+  xsec_mapped = nullptr;
+  for (auto& n : xsec_mapped_shape) n = 0;
+  xsec_mapped_fstride = 0;
+
+  xsec_precision = XsecPrecision::Double;
+  for (auto& n : xsec_compressed_shape) n = 0;
+  xsec_float.clear();
+  xsec_half.clear();
+  xsec_half_scale.clear();
+}
+
+//! The absorption cross sections of the table as a Tensor4.
+/*!
+  Copies the cross sections, decoding them for compressed tables. Meant
+  for output, not for use in calculations.
+
+  \return The cross sections. Dimension as for xsec.
+*/
+Tensor4 GasAbsLookup::XsecTensor() const {
+  if (not IsCompressed()) return Tensor4(XsecView());
+
+  const Index* shape = xsec_compressed_shape;
+  Tensor4 values(shape[0], shape[1], shape[2], shape[3]);
+  for (Index p = 0, i = 0, k = 0; p < shape[3]; ++p)
+    for (Index t = 0; t < shape[0]; ++t)
+      for (Index s = 0; s < shape[1]; ++s, ++k)
+        for (Index f = 0; f < shape[2]; ++f, ++i)
+          values(t, s, f, p) =
+              xsec_precision == XsecPrecision::Float32
+                  ? Numeric(xsec_float[i])
+                  : numeric_from_half(xsec_half[i]) * xsec_half_scale[k];
+  return values;
+}
+
+//! Change the storage precision of the cross sections.
+/*!
+  Reduced precision saves memory and memory bandwidth in Extract, where
+  the cross sections are decoded inside the interpolation loop.
+
+  Float32 keeps about 7 significant digits. Float16 keeps about 3, and
+  is scaled by the largest value over frequency for each pressure,
+  temperature perturbation and species. Values below about 6e-5 of that
+  largest value lose relative precision, and the smallest value that is
+  not zero is about 6e-8 of it. Use abs_lookupTestAccuracy to see the effect on a
+  particular table.
+
+  The table must already be adapted, since Adapt does not work on
+  compressed tables. Going back to Double does not restore the lost
+  precision.
+
+  \param[in] precision The new storage precision.
+*/
+void GasAbsLookup::Compress(const XsecPrecision precision) {
+  if (precision == xsec_precision) return;
+
+  const Tensor4 values = XsecTensor();
+  ClearXsecStorage();
+  xsec_precision = precision;
+
+  if (precision == XsecPrecision::Double) {
+    xsec = values;
+    return;
+  }
+
+  xsec.resize(0, 0, 0, 0);
+  const Index shape[4] = {
+      values.nbooks(), values.npages(), values.nrows(), values.ncols()};
+  for (Index i = 0; i < 4; ++i) xsec_compressed_shape[i] = shape[i];
+
+  if (precision == XsecPrecision::Float32) {
+    xsec_float.resize(shape[0] * shape[1] * shape[2] * shape[3]);
+    auto it = xsec_float.begin();
+    for (Index p = 0; p < shape[3]; ++p)
+      for (Index t = 0; t < shape[0]; ++t)
+        for (Index s = 0; s < shape[1]; ++s)
+          for (Index f = 0; f < shape[2]; ++f)
+            *it++ = float(values(t, s, f, p));
+  } else {
+    xsec_half.resize(shape[0] * shape[1] * shape[2] * shape[3]);
+    xsec_half_scale.resize(shape[0] * shape[1] * shape[3]);
+    auto it = xsec_half.begin();
+    auto scale = xsec_half_scale.begin();
+    for (Index p = 0; p < shape[3]; ++p)
+      for (Index t = 0; t < shape[0]; ++t)
+        for (Index s = 0; s < shape[1]; ++s, ++scale) {
+          *scale = 0;
+          for (Index f = 0; f < shape[2]; ++f)
+            if (std::isfinite(values(t, s, f, p)))
+              *scale = max(*scale, abs(values(t, s, f, p)));
+          if (*scale == 0) *scale = 1;
+
+          for (Index f = 0; f < shape[2]; ++f)
+            *it++ = half_from_numeric(values(t, s, f, p) / *scale);
+        }
+  }
+}
+
+//! Interpolate the compressed cross sections of one species.
+/*!
+  Replaces the interp call of ExtractPoint for compressed tables.
+
+  \param[out] res           Interpolated cross sections. Dimension: [1, 1, n_f].
+  \param[in]  itw           Interpolation weights.
+  \param[in]  tgp           The temperature grid position.
+  \param[in]  vgp           The VMR grid position.
+  \param[in]  fgp           The frequency grid positions.
+  \param[in]  p_index       Index into p_grid.
+  \param[in]  first_profile Position of the species in the second
+                            dimension of xsec.
+*/
+void GasAbsLookup::InterpCompressed(Tensor3View res,
+                                    ConstTensor4View itw,
+                                    const ArrayOfGridPosPoly& tgp,
+                                    const ArrayOfGridPosPoly& vgp,
+                                    const ArrayOfGridPosPoly& fgp,
+                                    const Index& p_index,
+                                    const Index& first_profile) const {
+  const Index n_t = xsec_compressed_shape[0];
+  const Index n_s = xsec_compressed_shape[1];
+  const Index n_f = xsec_compressed_shape[2];
+
+  // Index of the first profile at this pressure, without frequency
+  const Index k0 = p_index * n_t * n_s + first_profile;
+
+  if (xsec_precision == XsecPrecision::Float32) {
+    const float* data = xsec_float.data();
+    interp_compressed(res, itw, tgp[0], vgp[0], fgp,
+                      [=](Index t, Index v, Index f) -> Numeric {
+                        return data[(k0 + t * n_s + v) * n_f + f];
+                      });
+  } else {
+    const std::uint16_t* data = xsec_half.data();
+    const Numeric* scale = xsec_half_scale.data();
+    interp_compressed(res, itw, tgp[0], vgp[0], fgp,
+                      [=](Index t, Index v, Index f) -> Numeric {
+                        const Index k = k0 + t * n_s + v;
+                        return numeric_from_half(data[k * n_f + f]) * scale[k];
+                      });
+  }
+}
+
+//! Write the table in the native format that can be memory mapped.
+/*!
+  The file starts with a header that holds everything but the cross
+  sections. The cross sections follow, aligned to a page boundary, with
+  the frequency as the slowest running dimension. A process mapping the
+  file with ReadMapped then only reads the pages of the frequencies it
+  actually extracts, and processes on the same node share one copy in
+  the page cache.
+
+  The format is the raw memory representation, so files can only be read
+  on machines with the same byte order and floating point format.
+
+  \param[in] filename Name of the file to write.
+*/
+void GasAbsLookup::WriteMapped(const String& filename) const {
+  const Tensor4 decoded = IsCompressed() ? XsecTensor() : Tensor4();
+  const ConstTensor4View table =
+      IsCompressed() ? ConstTensor4View(decoded) : XsecView();
+
+  ostringstream header;
+  header.write(mapped_table_magic, sizeof(mapped_table_magic));
+  write_mapped_index(header, mapped_table_byte_order);
+  write_mapped_index(header, sizeof(Numeric));
+
+  write_mapped_index(header, species.nelem());
+  for (auto& group : species) {
+    write_mapped_index(header, group.nelem());
+    for (auto& tag : group) write_mapped_string(header, tag.Name());
+  }
+
+  write_mapped_index(header, nonlinear_species.nelem());
+  for (auto& i : nonlinear_species) write_mapped_index(header, i);
+
+  write_mapped_vector(header, f_grid);
+  write_mapped_vector(header, p_grid);
+  write_mapped_index(header, vmrs_ref.nrows());
+  for (Index i = 0; i < vmrs_ref.nrows(); i++)
+    write_mapped_vector(header, vmrs_ref(i, joker));
+  write_mapped_vector(header, t_ref);
+  write_mapped_vector(header, t_pert);
+  write_mapped_vector(header, nls_pert);
+
+  write_mapped_index(header, table.nbooks());
+  write_mapped_index(header, table.npages());
+  write_mapped_index(header, table.nrows());
+  write_mapped_index(header, table.ncols());
+
+  // The offset of the cross sections ends the header
+  const Index header_size = Index(header.str().size()) + Index(sizeof(Index));
+  const Index offset =
+      ((header_size + mapped_table_page - 1) / mapped_table_page) *
+      mapped_table_page;
+  write_mapped_index(header, offset);
+
+  ofstream file(expand_path(filename).c_str(), ios::binary);
+  if (not file) {
+    ostringstream os;
+    os << "Cannot open file " << filename << " for writing.";
+    throw runtime_error(os.str());
+  }
+
+  file << header.str();
+  file << String(offset - header_size, '\0');
+
+  // One frequency at a time, in the order of the file
+  std::vector<Numeric> block(table.nbooks() * table.npages() * table.ncols());
+  for (Index f = 0; f < table.nrows(); f++) {
+    auto it = block.begin();
+    for (Index t = 0; t < table.nbooks(); t++)
+      for (Index s = 0; s < table.npages(); s++)
+        for (Index p = 0; p < table.ncols(); p++) *it++ = table(t, s, f, p);
+    file.write(reinterpret_cast<const char*>(block.data()),
+               block.size() * sizeof(Numeric));
+  }
+
+  if (not file) {
+    ostringstream os;
+    os << "Error writing lookup table to file " << filename << ".";
+    throw runtime_error(os.str());
+  }
+}
+
+//! Read a table written by WriteMapped.
+/*!
+  Only the header is read, the cross sections stay in the file and are
+  paged in by the operating system when Extract first touches them. The
+  table must be adapted with Adapt before use, as for all other tables.
+  If the species are kept and the frequencies are a contiguous part of
+  the table's, Adapt keeps the mapping, otherwise it copies the selected
+  cross sections into memory.
+
+  \param[in] filename Name of the file to read.
+*/
+void GasAbsLookup::ReadMapped(const String& filename) {
+  auto map = std::make_shared<const ReadOnlyFileMap>(filename);
+  MappedTableReader reader(*map);
+
+  char magic[sizeof(mapped_table_magic)];
+  reader.Read(magic, sizeof(magic));
+  if (memcmp(magic, mapped_table_magic, sizeof(magic)) != 0) {
+    ostringstream os;
+    os << "File " << map->filename() << " is not a mapped lookup table.";
+    throw runtime_error(os.str());
+  }
+  if (reader.ReadIndex() != mapped_table_byte_order or
+      reader.ReadIndex() != Index(sizeof(Numeric))) {
+    ostringstream os;
+    os << "The lookup table file " << map->filename()
+       << " was written on a machine with different byte order or\n"
+       << "floating point format. Convert it with abs_lookupWriteMapped "
+       << "on such a machine.";
+    throw runtime_error(os.str());
+  }
+
+  GasAbsLookup new_table;
+
+  new_table.species.resize(reader.ReadSize());
+  for (auto& group : new_table.species) {
+    group.resize(reader.ReadSize());
+    for (auto& tag : group) tag = SpeciesTag(reader.ReadString());
+  }
+
+  new_table.nonlinear_species.resize(reader.ReadSize());
+  for (auto& i : new_table.nonlinear_species) {
+    i = reader.ReadIndex();
+    if (i < 0 or i >= new_table.species.nelem()) {
+      ostringstream os;
+      os << "Invalid nonlinear species " << i << " in lookup table file "
+         << map->filename() << ".";
+      throw runtime_error(os.str());
+    }
+  }
+
+  reader.ReadVector(new_table.f_grid);
+  reader.ReadVector(new_table.p_grid);
+  new_table.vmrs_ref.resize(reader.ReadSize(), new_table.p_grid.nelem());
+  for (Index i = 0; i < new_table.vmrs_ref.nrows(); i++) {
+    Vector row;
+    reader.ReadVector(row);
+    if (row.nelem() != new_table.p_grid.nelem()) {
+      ostringstream os;
+      os << "Inconsistent reference VMRs in lookup table file "
+         << map->filename() << ".";
+      throw runtime_error(os.str());
+    }
+    new_table.vmrs_ref(i, joker) = row;
+  }
+  reader.ReadVector(new_table.t_ref);
+  reader.ReadVector(new_table.t_pert);
+  reader.ReadVector(new_table.nls_pert);
+
+  for (auto& n : new_table.xsec_mapped_shape) n = reader.ReadSize();
+  const Index offset = reader.ReadSize();
+
+  // The shape must match the grids, as for tables read from XML:
+  const Index* shape = new_table.xsec_mapped_shape;
+  Index n_profiles = 0;
+  for (Index i = 0; i < new_table.species.nelem(); i++)
+    n_profiles += std::count(new_table.nonlinear_species.begin(),
+                             new_table.nonlinear_species.end(),
+                             i)
+                      ? new_table.nls_pert.nelem()
+                      : 1;
+  if (shape[0] != std::max(new_table.t_pert.nelem(), Index(1)) or
+      shape[1] != n_profiles or shape[2] != new_table.f_grid.nelem() or
+      shape[3] != new_table.p_grid.nelem() or
+      new_table.vmrs_ref.nrows() != new_table.species.nelem() or
+      new_table.t_ref.nelem() != new_table.p_grid.nelem()) {
+    ostringstream os;
+    os << "The dimensions of the cross sections in lookup table file "
+       << map->filename() << "\n"
+       << "do not match its grids.";
+    throw runtime_error(os.str());
+  }
+
+  // Each dimension is below the file size, but their product can still
+  // overflow. It is therefore compared factor by factor to the number of
+  // values that fit behind the offset.
+  if (offset % mapped_table_page or size_t(offset) > map->size()) {
+    ostringstream os;
+    os << "Invalid offset of the cross sections in lookup table file "
+       << map->filename() << ".";
+    throw runtime_error(os.str());
+  }
+  const Index n_available =
+      Index((map->size() - size_t(offset)) / sizeof(Numeric));
+  Index n_values = 1;
+  for (Index i = 0; i < 4; i++) {
+    if (shape[i] and n_values > n_available / shape[i]) {
+      ostringstream os;
+      os << "The cross sections in lookup table file " << map->filename()
+         << " are truncated.";
+      throw runtime_error(os.str());
+    }
+    n_values *= shape[i];
+  }
+  new_table.xsec_mapped_fstride = shape[0] * shape[1] * shape[3];
+
+  new_table.xsec_mapped =
+      reinterpret_cast<const Numeric*>(map->data() + offset);
+  new_table.xsec_map = map;
+
+  *this = new_table;
+}
+
+//! The species whose VMR the nonlinear species depend on.
+/*!
+  This is the first H2O species of the table, the same that Extract
+  uses for the VMR interpolation.
+
+  \return Index into the species of the table, or -1 if the table has
+          no nonlinear species.
+*/
+Index GasAbsLookup::NonLinearVmrSpecies() const {
+  if (not nonlinear_species.nelem()) return -1;
+  return find_first_species_tg(species,
+                               species_index_from_species_name("H2O"));
+}
+
 const Vector& GasAbsLookup::GetFgrid() const { return f_grid; }
 
 const Vector& GasAbsLookup::GetPgrid() const { return p_grid; }
@@ -26,10 +26,14 @@
 #ifndef gas_abs_lookup_h
 #define gas_abs_lookup_h
 
+#include <cstdint>
+#include <memory>
+#include <vector>
 #include "abs_species_tags.h"
 #include "absorption.h"
 #include "interpolation_poly.h"
 #include "matpackIV.h"
+#include "matpackV.h"
 #include "messages.h"
 
 // Declare existance of some classes:
@@ -37,6 +41,7 @@ class bifstream;
 class bofstream;
 class Agenda;
 class Workspace;
+class ReadOnlyFileMap;
 
 //! An absorption lookup table.
 /*! This class holds an absorption lookup table, as well as all
@@ -44,6 +49,13 @@ class Workspace;
     absorption. Extraction routines are implemented as member functions. */
 class GasAbsLookup {
  public:
+  //! Storage precision of the absorption cross sections.
+  enum class XsecPrecision {
+    Double,   // As computed, in xsec
+    Float32,  // Single precision
+    Float16   // Half precision, scaled per pressure, T, and species
+  };
+
   GasAbsLookup()
       : species(),
         nonlinear_species(),
@@ -73,6 +85,67 @@ class GasAbsLookup {
                ConstVectorView new_f_grid,
                const Numeric& extpolfac) const;
 
+  // Documentation is with the implementation!
+  void Extract(Matrix& sga,
+               Matrix& dsga_dT,
+               Matrix& dsga_dnls,
+               const bool do_temperature,
+               const bool do_nls,
+               const Index& p_interp_order,
+               const Index& t_interp_order,
+               const Index& h2o_interp_order,
+               const Index& f_interp_order,
+               const Numeric& p,
+               const Numeric& T,
+               ConstVectorView abs_vmrs,
+               ConstVectorView new_f_grid,
+               const Numeric& extpolfac) const;
+
+  // Documentation is with the implementation!
+  void Extract(Tensor3& sga,
+               const Index& p_interp_order,
+               const Index& t_interp_order,
+               const Index& h2o_interp_order,
+               const Index& f_interp_order,
+               ConstVectorView p,
+               ConstVectorView T,
+               ConstMatrixView abs_vmrs,
+               ConstVectorView new_f_grid,
+               const Numeric& extpolfac) const;
+
+  // Documentation is with the implementation!
+  void ReadMapped(const String& filename);
+
+  // Documentation is with the implementation!
+  void WriteMapped(const String& filename) const;
+
+  // Documentation is with the implementation!
+  ConstTensor4View XsecView() const;
+
+  // Documentation is with the implementation!
+  Tensor4 XsecTensor() const;
+
+  // Documentation is with the implementation!
+  void Compress(const XsecPrecision precision);
+
+  /** The storage precision of the cross sections */
+  XsecPrecision Precision() const { return xsec_precision; }
+
+  /** True if the cross sections are stored with reduced precision */
+  bool IsCompressed() const { return xsec_precision != XsecPrecision::Double; }
+
+  /** True if the cross sections are paged in from a mapped file */
+  bool IsMapped() const { return bool(xsec_map); }
+
+  // Documentation is with the implementation!
+  void ClearXsecStorage();
+
+  /** True if the table holds the temperature derivative of the cross sections */
+  bool HasTemperatureDerivative() const { return not dxsec_dT.empty(); }
+
+  // Documentation is with the implementation!
+  Index NonLinearVmrSpecies() const;
+
   const Vector& GetFgrid() const;
 
   const Vector& GetPgrid() const;
@@ -107,6 +180,12 @@ class GasAbsLookup {
       const Vector& abs_t_pert,
       const Vector& abs_nls_pert,
       const Agenda& abs_xsec_agenda,
+      // Control Parameters:
+      const Index& f_chunk,
+      const Index& p_chunk,
+      const String& checkpoint_file,
+      const Numeric& checkpoint_interval,
+      const Index& t_derivative,
       // Verbosity object:
       const Verbosity& verbosity);
 
@@ -188,10 +267,83 @@ class GasAbsLookup {
   /** The vector of perturbations for the VMRs of the nonlinear species */
   Vector& NLSPert() {return nls_pert;}
   
-  /** Absorption cross sections */
+  /** Absorption cross sections
+   
+   Empty for mapped and compressed tables, use XsecView() or XsecTensor()
+   for reading those. */
   Tensor4& Xsec() {return xsec;}
   
+  /** Temperature derivative of the absorption cross sections
+   
+   Empty if the table has no stored derivative. */
+  Tensor4& dXsecdT() {return dxsec_dT;}
+  
  private:
+  // Documentation is with the implementation!
+  Index CheckExtraction(const Index& p_interp_order,
+                        const Index& t_interp_order,
+                        const Index& h2o_interp_order,
+                        const Index& f_interp_order,
+                        const Index& n_vmrs) const;
+
+  // Documentation is with the implementation!
+  const ArrayOfGridPosPoly& FrequencyGridPositions(
+      ArrayOfGridPosPoly& fgp_local,
+      const Index& f_interp_order,
+      ConstVectorView new_f_grid) const;
+
+  // Documentation is with the implementation!
+  void CheckPressure(const Numeric& p) const;
+
+  // Documentation is with the implementation!
+  void InterpCompressed(Tensor3View res,
+                        ConstTensor4View itw,
+                        const ArrayOfGridPosPoly& tgp,
+                        const ArrayOfGridPosPoly& vgp,
+                        const ArrayOfGridPosPoly& fgp,
+                        const Index& p_index,
+                        const Index& first_profile) const;
+
+  /** Scratch data of ExtractPoint
+
+   Holds the grid positions, weights and intermediate results of one
+   extraction. They keep their size between points with the same
+   interpolation orders and frequency grid, so a scratch that is reused
+   over many points allocates only once. */
+  struct ExtractScratch {
+    Tensor5 xsec_pre_interpolated;
+    Tensor4 itw_withH2O;
+    Tensor4 itw_noH2O;
+    Tensor4 itw_dT_withH2O;
+    Tensor4 itw_dT_noH2O;
+    Tensor4 itw_dnls;
+    Tensor3 dres;
+    Vector pitw;
+    ArrayOfGridPosPoly gp_trivial;
+    ArrayOfGridPosPoly tgp_withT;
+    ArrayOfGridPosPoly vgp_h2o;
+    ArrayOfGridPosPoly tgp_dT;
+    ArrayOfGridPosPoly vgp_dh2o;
+  };
+
+  // Documentation is with the implementation!
+  void ExtractPoint(MatrixView sga,
+                    MatrixView dsga_dT,
+                    MatrixView dsga_dnls,
+                    ExtractScratch& scratch,
+                    const Index& p_interp_order,
+                    const Index& t_interp_order,
+                    const Index& h2o_interp_order,
+                    const Index& f_interp_order,
+                    const GridPosPoly& pgp,
+                    const ArrayOfGridPosPoly& fgp,
+                    const ArrayOfIndex& non_linear,
+                    const Index& h2o_index,
+                    const Numeric& p,
+                    const Numeric& T,
+                    ConstVectorView abs_vmrs,
+                    const Numeric& extpolfac) const;
+
   //! The species tags for which the table is valid.
   ArrayOfArrayOfSpeciesTag species;
 
@@ -307,8 +459,66 @@ class GasAbsLookup {
     dimensions of abs_per_tg in ARTS-1-0. This should simplify
     computation of the lookup table with the old ARTS version.  */
   Tensor4 xsec;
+
+  //! Temperature derivative of the absorption cross sections.
+  /*!
+    Physical unit: m^2/K
+
+    Optional. Either empty, or the same dimension as xsec. Calculated
+    together with xsec by abs_lookupCalc, if asked to. Without it,
+    Extract takes the temperature derivative of the interpolation in
+    xsec instead.
+
+    This is always kept with full precision in memory, also for
+    compressed tables. It is not part of the mapped table format. */
+  Tensor4 dxsec_dT;
+
+  //! Memory mapping of the table file for tables read by ReadMapped.
+  /*! If set, xsec is empty and the cross sections are read directly
+    from the mapping, see XsecView(). The mapping is shared between
+    copies of the table. */
+  std::shared_ptr<const ReadOnlyFileMap> xsec_map;
+
+  //! First cross section of the mapped table.
+  /*! Points into xsec_map. In the mapped file the frequency is the
+    slowest running dimension, so that the pages of frequencies that
+    are never extracted are never read. */
+  const Numeric* xsec_mapped{nullptr};
+
+  //! Dimensions of the mapped cross sections, same order as xsec.
+  Index xsec_mapped_shape[4]{0, 0, 0, 0};
+
+  //! Distance between frequencies in the mapped cross sections.
+  Index xsec_mapped_fstride{0};
+
+  //! Storage precision of the cross sections.
+  /*! For anything but Double, xsec is empty and the cross sections are
+    in xsec_float or xsec_half, see Compress(). */
+  XsecPrecision xsec_precision{XsecPrecision::Double};
+
+  //! Dimensions of the compressed cross sections, same order as xsec.
+  Index xsec_compressed_shape[4]{0, 0, 0, 0};
+
+  //! Single precision cross sections.
+  /*! Dimension: [ n_p_grid, a, b, c ] in the notation of xsec, so
+    that all that is needed for one pressure level is contiguous. */
+  std::vector<float> xsec_float;
+
+  //! Half precision cross sections, same layout as xsec_float.
+  /*! Stored as IEEE 754 binary16 bit patterns of the cross section
+    divided by xsec_half_scale. */
+  std::vector<std::uint16_t> xsec_half;
+
+  //! Scale of the half precision cross sections.
+  /*! The largest absolute value over frequency. Dimension: [ n_p_grid,
+    a, b ] in the notation of xsec. */
+  std::vector<Numeric> xsec_half_scale;
 };
 
 ostream& operator<<(ostream& os, const GasAbsLookup& gal);
 
+std::uint16_t half_from_numeric(const Numeric x);
+
+Numeric numeric_from_half(const std::uint16_t h);
+
 #endif  //  gas_abs_lookup_h
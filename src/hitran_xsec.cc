@@ -30,6 +30,10 @@
 
 #include <complex.h>
 #include <fftw3.h>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
 
 #endif /* ENABLE_FFTW */
 
@@ -77,74 +81,172 @@ void convolve(Vector& result,
 
 #ifdef ENABLE_FFTW
 
-void fftconvolve(VectorView& result,
-                 const Vector& xsec,
-                 const Vector& lorentz) {
-  int n_p = (int)(xsec.nelem() + lorentz.nelem() - 1);
-  int n_p_2 = n_p / 2 + 1;
+namespace {
 
-  double* xsec_in = fftw_alloc_real((size_t)n_p);
-  fftw_complex* xsec_out = fftw_alloc_complex((size_t)n_p_2);
-  memcpy(xsec_in, xsec.get_c_array(), sizeof(double) * xsec.nelem());
-  memset(&xsec_in[xsec.nelem()], 0, sizeof(double) * (n_p - xsec.nelem()));
+/** FFTW plans for the real-data transforms of one size. */
+struct FftwPlans {
+  fftw_plan forward;
+  fftw_plan backward;
+};
 
-  fftw_plan plan;
-#pragma omp critical(fftw_call)
-  plan = fftw_plan_dft_r2c_1d(n_p, xsec_in, xsec_out, FFTW_ESTIMATE);
+/** Get the FFTW plans for transforms of size n.
 
-  fftw_execute(plan);
+ The plans are created once per size and kept for the lifetime of the
+ program. They are only executed with the new-array execute functions,
+ which are thread-safe, while the creation is serialized because the
+ FFTW planner is not.
 
-#pragma omp critical(fftw_call)
-  fftw_destroy_plan(plan);
+ If the environment variable ARTS_FFTW_WISDOM names a file, the plans
+ are measured instead of estimated, and the FFTW wisdom is read from
+ and written to that file, so that the measurement is only done once.
 
-  fftw_free(xsec_in);
+ \param[in] n Transform size.
 
-  double* lorentz_in = fftw_alloc_real((size_t)n_p);
-  fftw_complex* lorentz_out = fftw_alloc_complex((size_t)n_p_2);
-  memcpy(lorentz_in, lorentz.get_c_array(), sizeof(double) * lorentz.nelem());
-  memset(&lorentz_in[lorentz.nelem()],
-         0,
-         sizeof(double) * (n_p - lorentz.nelem()));
+ \returns The forward (real to complex) and backward plans.
+ */
+const FftwPlans& fftw_plans(const int n) {
+  static std::map<int, FftwPlans> plan_cache;
+  static bool wisdom_imported = false;
+  const FftwPlans* plans;
 
 #pragma omp critical(fftw_call)
-  plan = fftw_plan_dft_r2c_1d(n_p, lorentz_in, lorentz_out, FFTW_ESTIMATE);
+  {
+    auto it = plan_cache.find(n);
+    if (it == plan_cache.end()) {
+      const char* wisdom_file = getenv("ARTS_FFTW_WISDOM");
+      if (wisdom_file && !wisdom_imported) {
+        fftw_import_wisdom_from_filename(wisdom_file);
+        wisdom_imported = true;
+      }
 
-  fftw_execute(plan);
+      // Planning with FFTW_MEASURE overwrites the arrays, so dedicated
+      // arrays are used. Their alignment is the same as for all other
+      // arrays allocated with fftw_alloc.
+      double* in = fftw_alloc_real((size_t)n);
+      fftw_complex* out = fftw_alloc_complex((size_t)(n / 2 + 1));
+      const unsigned flags = wisdom_file ? FFTW_MEASURE : FFTW_ESTIMATE;
 
-#pragma omp critical(fftw_call)
-  fftw_destroy_plan(plan);
+      FftwPlans new_plans;
+      new_plans.forward = fftw_plan_dft_r2c_1d(n, in, out, flags);
+      new_plans.backward = fftw_plan_dft_c2r_1d(n, out, in, flags);
 
-  fftw_free(lorentz_in);
+      fftw_free(in);
+      fftw_free(out);
 
-  fftw_complex* fft_in = fftw_alloc_complex((size_t)n_p_2);
-  double* fft_out = fftw_alloc_real((size_t)n_p);
-  memcpy(fft_in, xsec_out, sizeof(fftw_complex) * n_p_2);
+      if (wisdom_file) fftw_export_wisdom_to_filename(wisdom_file);
 
-  for (Index i = 0; i < n_p_2; i++) {
-    fft_in[i][0] =
-        xsec_out[i][0] * lorentz_out[i][0] - xsec_out[i][1] * lorentz_out[i][1];
-    fft_in[i][1] =
-        xsec_out[i][0] * lorentz_out[i][1] + xsec_out[i][1] * lorentz_out[i][0];
+      it = plan_cache.insert(std::make_pair(n, new_plans)).first;
+    }
+    plans = &it->second;
   }
 
-#pragma omp critical(fftw_call)
-  plan = fftw_plan_dft_c2r_1d(n_p, fft_in, fft_out, FFTW_ESTIMATE);
+  return *plans;
+}
 
-  fftw_execute(plan);
+/** Convolution of cross section data with line shapes using FFTW.
 
-#pragma omp critical(fftw_call)
-  fftw_destroy_plan(plan);
+ The cross section data of one dataset is convolved with a different
+ line shape for each pressure level. The spectra of the data are
+ calculated once and reused for all line shapes, so that each
+ convolution needs one forward and one backward transform.
+
+ Several data vectors can be given, the convolved data is then a linear
+ combination of them. This allows to reuse the spectra also if the
+ temperature fit is applied.
+ */
+class XsecConvolution {
+ public:
+  /** Constructor.
+
+   \param[in] n_data    Number of data vectors.
+   \param[in] n_xsec    Length of the data vectors.
+   \param[in] n_lorentz Length of the line shapes.
+   */
+  XsecConvolution(const Index n_data, const Index n_xsec, const Index n_lorentz)
+      : mn_xsec(n_xsec),
+        mn_lorentz(n_lorentz),
+        mn_p((int)(n_xsec + n_lorentz - 1)),
+        mn_p_2(mn_p / 2 + 1),
+        mplans(fftw_plans(mn_p)),
+        mreal(fftw_alloc_real((size_t)mn_p)),
+        mspectrum(fftw_alloc_complex((size_t)mn_p_2)),
+        mdata_spectra(n_data) {
+    for (Index i = 0; i < n_data; i++)
+      mdata_spectra[i] = fftw_alloc_complex((size_t)mn_p_2);
+  }
 
-  fftw_free(fft_in);
+  XsecConvolution(const XsecConvolution&) = delete;
+  XsecConvolution& operator=(const XsecConvolution&) = delete;
 
-  for (Index i = 0; i < xsec.nelem(); i++) {
-    result[i] = fft_out[i + (int)lorentz.nelem() / 2] / n_p;
+  ~XsecConvolution() {
+    fftw_free(mreal);
+    fftw_free(mspectrum);
+    for (auto& data_spectrum : mdata_spectra) fftw_free(data_spectrum);
   }
 
-  fftw_free(xsec_out);
-  fftw_free(lorentz_out);
-  fftw_free(fft_out);
-}
+  /** Set a data vector.
+
+   \param[in] i    Index of the data vector.
+   \param[in] data The data.
+   */
+  void SetData(const Index i, ConstVectorView data) {
+    assert(data.nelem() == mn_xsec);
+    Forward(mdata_spectra[i], data);
+  }
+
+  /** Convolve the data with a line shape.
+
+   \param[out] result  The convolved data, with the length of the data.
+   \param[in]  coeffs  Coefficients of the data vectors.
+   \param[in]  lorentz The line shape.
+   */
+  void Convolve(VectorView result,
+                ConstVectorView coeffs,
+                ConstVectorView lorentz) {
+    assert(result.nelem() == mn_xsec);
+    assert(coeffs.nelem() == mdata_spectra.nelem());
+    assert(lorentz.nelem() == mn_lorentz);
+
+    Forward(mspectrum, lorentz);
+
+    for (Index i = 0; i < mn_p_2; i++) {
+      Numeric re = 0., im = 0.;
+      for (Index j = 0; j < coeffs.nelem(); j++) {
+        re += coeffs[j] * mdata_spectra[j][i][0];
+        im += coeffs[j] * mdata_spectra[j][i][1];
+      }
+      const Numeric l_re = mspectrum[i][0];
+      const Numeric l_im = mspectrum[i][1];
+      mspectrum[i][0] = re * l_re - im * l_im;
+      mspectrum[i][1] = re * l_im + im * l_re;
+    }
+
+    fftw_execute_dft_c2r(mplans.backward, mspectrum, mreal);
+
+    for (Index i = 0; i < mn_xsec; i++)
+      result[i] = mreal[i + mn_lorentz / 2] / mn_p;
+  }
+
+ private:
+  /** Zero-padded forward transform of v. */
+  void Forward(fftw_complex* out, ConstVectorView v) {
+    const Index n = v.nelem();
+    for (Index i = 0; i < n; i++) mreal[i] = v[i];
+    memset(&mreal[n], 0, sizeof(double) * (mn_p - n));
+    fftw_execute_dft_r2c(mplans.forward, mreal, out);
+  }
+
+  const Index mn_xsec;
+  const Index mn_lorentz;
+  const int mn_p;
+  const int mn_p_2;
+  const FftwPlans& mplans;
+  double* mreal;
+  fftw_complex* mspectrum;
+  Array<fftw_complex*> mdata_spectra;
+};
+
+}  // namespace
 
 #endif /* ENABLE_FFTW */
 
@@ -154,12 +256,31 @@ void XsecRecord::Extract(VectorView result,
                          const Numeric& temperature,
                          const Index& apply_tfit,
                          const Verbosity& verbosity) const {
+  Matrix result_matrix(result.nelem(), 1);
+  Extract(result_matrix,
+          f_grid,
+          Vector(1, pressure),
+          Vector(1, temperature),
+          apply_tfit,
+          verbosity);
+  result = result_matrix(joker, 0);
+}
+
+void XsecRecord::Extract(MatrixView result,
+                         ConstVectorView f_grid,
+                         ConstVectorView pressures,
+                         ConstVectorView temperatures,
+                         const Index& apply_tfit,
+                         const Verbosity& verbosity) const {
   CREATE_OUTS;
 
   const Index nf = f_grid.nelem();
+  const Index np = pressures.nelem();
 
-  // Assert that result vector has right size:
-  assert(result.nelem() == nf);
+  // Assert that result matrix has right size:
+  assert(result.nrows() == nf);
+  assert(result.ncols() == np);
+  assert(temperatures.nelem() == np);
 
   // Initialize result to zero (important for those frequencies outside the data grid).
   result = 0.;
@@ -177,7 +298,8 @@ void XsecRecord::Extract(VectorView result,
       os << "    f_grid:      " << f_grid[0] << " - " << f_grid[nf - 1]
          << " Hz\n"
          << "    data_f_grid: " << fmin << " - " << fmax << " Hz\n"
-         << "    pressure: " << pressure << " K\n";
+         << "    pressures: " << pressures[0] << " - " << pressures[np - 1]
+         << " Pa\n";
       out3 << os.str();
     }
 
@@ -237,22 +359,9 @@ void XsecRecord::Extract(VectorView result,
     // This is the part of the xsec dataset for which we have to do the
     // interpolation.
     Range active_range(i_data_fstart, data_f_extent);
-    ConstVectorView xsec_active = mxsecs[this_dataset_i][active_range];
+    ConstVectorView xsec_data_active = mxsecs[this_dataset_i][active_range];
 
-    Vector xsec_active_tfit;
-
-    if (apply_tfit != 0 && mtslope[this_dataset_i].nelem() > 1) {
-      xsec_active_tfit = mtslope[this_dataset_i][active_range];
-      xsec_active_tfit *= temperature - mreftemperature[this_dataset_i];
-      xsec_active_tfit += mtintersect[this_dataset_i][active_range];
-      xsec_active_tfit /= 10000;
-      xsec_active_tfit += mxsecs[this_dataset_i][active_range];
-
-      xsec_active = xsec_active_tfit;
-    }
-    // We have to create a matching view on the result vector:
-    VectorView result_active = result[Range(i_fstart, f_extent)];
-    Vector xsec_interp(f_extent);
+    const bool do_tfit = apply_tfit != 0 && mtslope[this_dataset_i].nelem() > 1;
 
     // Decide on interpolation orders:
     const Index f_order = 3;
@@ -267,67 +376,94 @@ void XsecRecord::Extract(VectorView result,
       throw runtime_error(os.str());
     }
 
-    if (pressure > mrefpressure[this_dataset_i]) {
-      // Apply pressure dependent broadening and set negative values to zero.
-      // (These could happen due to overshooting of the higher order interpolation.)
-      const Numeric pdiff = pressure - mrefpressure[this_dataset_i];
-      const Numeric fwhm = func_2straights(pdiff, mcoeffs);
-      //        std::cout << mcoeffs << " - ";
-      //        std::cout << "pdiff: " << pdiff << " - fwhm: " << fwhm << " - fstep: "
-      //                  << f_grid[i_fstart] + f_grid[i_fstart + 1] << std::endl;
-
-      Vector f_lorentz(data_f_extent);
-      Numeric lsum = 0.;
-      for (Index i = 0; i < data_f_extent; i++) {
-        f_lorentz[i] =
-            lorentz_pdf(data_f_grid[i_data_fstart + i],
-                        data_f_grid[i_data_fstart + data_f_extent / 2],
-                        fwhm / 2.);
-        lsum += f_lorentz[i];
+    // The frequency grid positions are the same for all pressures:
+    ArrayOfGridPosPoly f_gp(f_grid_active.nelem());
+    gridpos_poly(f_gp, data_f_grid_active, f_grid_active, f_order);
+
+    Matrix itw(f_gp.nelem(), f_order + 1);
+    interpweights(itw, f_gp);
+
+    // The line shape is applied to the central half of the data range:
+    const Range lorentz_range(data_f_extent / 4, data_f_extent / 2, 1);
+
+#ifdef ENABLE_FFTW
+    // Set up on the first pressure that needs the broadening:
+    std::unique_ptr<XsecConvolution> convolution;
+    Vector tfit_coeffs(do_tfit ? 3 : 1, 1.);
+#endif /* ENABLE_FFTW */
+
+    Vector xsec_active_tfit;
+    Vector data_result(data_f_extent);
+    Vector xsec_interp(f_extent);
+
+    for (Index ip = 0; ip < np; ip++) {
+      const Numeric pressure = pressures[ip];
+      const Numeric temperature = temperatures[ip];
+
+      ConstVectorView xsec_active = xsec_data_active;
+
+      if (do_tfit) {
+        xsec_active_tfit = mtslope[this_dataset_i][active_range];
+        xsec_active_tfit *= temperature - mreftemperature[this_dataset_i];
+        xsec_active_tfit += mtintersect[this_dataset_i][active_range];
+        xsec_active_tfit /= 10000;
+        xsec_active_tfit += mxsecs[this_dataset_i][active_range];
+
+        xsec_active = xsec_active_tfit;
       }
 
-      f_lorentz /= lsum;
+      if (pressure > mrefpressure[this_dataset_i]) {
+        // Apply pressure dependent broadening and set negative values to zero.
+        // (These could happen due to overshooting of the higher order interpolation.)
+        const Numeric pdiff = pressure - mrefpressure[this_dataset_i];
+        const Numeric fwhm = func_2straights(pdiff, mcoeffs);
+
+        Vector f_lorentz(data_f_extent);
+        Numeric lsum = 0.;
+        for (Index i = 0; i < data_f_extent; i++) {
+          f_lorentz[i] =
+              lorentz_pdf(data_f_grid[i_data_fstart + i],
+                          data_f_grid[i_data_fstart + data_f_extent / 2],
+                          fwhm / 2.);
+          lsum += f_lorentz[i];
+        }
+
+        f_lorentz /= lsum;
 
-      Vector data_result(xsec_active.nelem());
 #ifdef ENABLE_FFTW
-      fftconvolve(
-          data_result,
-          xsec_active,
-          f_lorentz[Range(f_lorentz.nelem() / 4, f_lorentz.nelem() / 2, 1)]);
+        if (!convolution) {
+          convolution.reset(new XsecConvolution(
+              tfit_coeffs.nelem(), data_f_extent, lorentz_range.get_extent()));
+          convolution->SetData(0, xsec_data_active);
+          if (do_tfit) {
+            convolution->SetData(1, mtslope[this_dataset_i][active_range]);
+            convolution->SetData(2, mtintersect[this_dataset_i][active_range]);
+          }
+        }
+        if (do_tfit) {
+          tfit_coeffs[1] =
+              (temperature - mreftemperature[this_dataset_i]) / 10000;
+          tfit_coeffs[2] = 1. / 10000;
+        }
+        convolution->Convolve(
+            data_result, tfit_coeffs, f_lorentz[lorentz_range]);
 #else
-      convolve(
-          data_result,
-          xsec_active,
-          f_lorentz[Range(f_lorentz.nelem() / 4, f_lorentz.nelem() / 2, 1)]);
+        convolve(data_result, xsec_active, f_lorentz[lorentz_range]);
 #endif /* ENABLE_FFTW */
 
-      // TODO: Add to result_active here
-      // Check if frequency is inside the range covered by the data:
-      chk_interpolation_grids("Frequency interpolation for cross sections",
-                              data_f_grid,
-                              f_grid_active,
-                              f_order);
+        // Check if frequency is inside the range covered by the data:
+        chk_interpolation_grids("Frequency interpolation for cross sections",
+                                data_f_grid,
+                                f_grid_active,
+                                f_order);
 
-      {
-        // Find frequency grid positions:
-        ArrayOfGridPosPoly f_gp(f_grid_active.nelem()), T_gp(1);
-        gridpos_poly(f_gp, data_f_grid_active, f_grid_active, f_order);
-
-        Matrix itw(f_gp.nelem(), f_order + 1);
-        interpweights(itw, f_gp);
         interp(xsec_interp, itw, data_result, f_gp);
+      } else {
+        interp(xsec_interp, itw, xsec_active, f_gp);
       }
-    } else {
-      // Find frequency grid positions:
-      ArrayOfGridPosPoly f_gp(f_grid_active.nelem()), T_gp(1);
-      gridpos_poly(f_gp, data_f_grid_active, f_grid_active, f_order);
-
-      Matrix itw(f_gp.nelem(), f_order + 1);
-      interpweights(itw, f_gp);
-      interp(xsec_interp, itw, xsec_active, f_gp);
-    }
 
-    result_active += xsec_interp;
+      result(Range(i_fstart, f_extent), ip) += xsec_interp;
+    }
   }
 }
 
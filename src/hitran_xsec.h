@@ -107,6 +107,27 @@ class XsecRecord {
                const Index& apply_tfit,
                const Verbosity& verbosity) const;
 
+  /** Interpolate cross section data for several pressures.
+
+     As the scalar version, but for all pressure levels at once. This is
+     faster, as the frequency grid positions and, with FFTW, the spectra
+     of the cross section data needed for the pressure broadening are
+     only calculated once.
+
+     \param[out] result      Xsec values. Dimension: [f_grid, pressures]
+     \param[in] f_grid       Frequency grid.
+     \param[in] pressures    Pressures.
+     \param[in] temperatures Temperatures, one for each pressure.
+     \param[in] apply_tfit   Set to 0 to not apply the temperature fit
+     \param[in] verbosity    Standard verbosity object.
+     */
+  void Extract(MatrixView result,
+               ConstVectorView f_grid,
+               ConstVectorView pressures,
+               ConstVectorView temperatures,
+               const Index& apply_tfit,
+               const Verbosity& verbosity) const;
+
   friend void xml_read_from_stream(std::istream& is_xml,
                                    XsecRecord& cr,
                                    bifstream* pbifs,
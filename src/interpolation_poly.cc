@@ -98,6 +98,77 @@ Index IMIN(Index a, Index b) { return a < b ? a : b; }
 */
 DEBUG_ONLY(const Numeric sum_check_epsilon = 1e-6;)
 
+//! Set up the grid position for higher order interpolation of one point.
+/*!
+  Helper function for gridpos_poly, doing the calculations for one
+  point, given the traditional grid position of the point.
+
+  \param gp Output: The grid position.
+  \param gp_trad The traditional grid position of the point.
+  \param old_grid Original grid.
+  \param new_grid New grid value.
+  \param m Number of points used in the interpolation (order + 1).
+*/
+static void gridpos_poly_point(GridPosPoly& gp,
+                               const GridPos& gp_trad,
+                               ConstVectorView old_grid,
+                               const Numeric new_grid,
+                               const Index m) {
+  const Index n_old = old_grid.nelem();
+
+  // Here we calculate the index of the first of the range of
+  // points used for interpolation. For linear interpolation this
+  // is identical to j. The idea for this expression is from
+  // Numerical Receipes (Chapter 3, section "after the hunt"), but
+  // there it is for 1-based arrays.
+  Index k;
+  if (m != 1) {
+    k = IMIN(IMAX(gp_trad.idx - (m - 1) / 2, 0), n_old - m);
+  } else {
+    // The above formula for k is not valid for m==1
+    // (nearest neighbour interpolation).
+    if (gp_trad.fd[0] <= 0.5)
+      k = gp_trad.idx;
+    else
+      k = gp_trad.idx + 1;
+
+    // It is a matter of definition what we do with the exact fd==0.5 case.
+    // Here I arbitrarily decided to stick with the "left" point (smaller
+    // index). I believe this is consistent with the behaviour for m=3,
+    // where 2 points on the left and 1 point on the right is used. (So,
+    // we always prefer the left side.)
+  }
+
+  //      cout << "m: "<< m << ", k: " << k << endl;
+
+  // Make gp.idx and gp.w the right size:
+  gp.idx.resize(m);
+  gp.w.resize(m);
+
+  // Calculate w for each interpolation point. In the linear case
+  // these are just the fractional distances to each interpolation
+  // point. The w here correspond exactly to the terms in front of
+  // the yi in Numerical Recipes, 2nd edition, section 3.1,
+  // eq. 3.1.1.
+  for (Index i = 0; i < m; ++i) {
+    gp.idx[i] = k + i;
+
+    //  Numerical Recipes, 2nd edition, section 3.1, eq. 3.1.1.
+
+    // Numerator:
+    Numeric num = 1;
+    for (Index j = 0; j < m; ++j)
+      if (j != i) num *= new_grid - old_grid[k + j];
+
+    // Denominator:
+    Numeric denom = 1;
+    for (Index j = 0; j < m; ++j)
+      if (j != i) denom *= old_grid[k + i] - old_grid[k + j];
+
+    gp.w[i] = num / denom;
+  }
+}
+
 //! Set up grid positions for higher order interpolation.
 /*!
   This function performs the same task as gridpos, but for arbitrary
@@ -155,64 +226,8 @@ void gridpos_poly(ArrayOfGridPosPoly& gp,
     assert(false);
   }
 
-  for (Index s = 0; s < n_new; ++s) {
-    // Here we calculate the index of the first of the range of
-    // points used for interpolation. For linear interpolation this
-    // is identical to j. The idea for this expression is from
-    // Numerical Receipes (Chapter 3, section "after the hunt"), but
-    // there it is for 1-based arrays.
-    Index k;
-    if (m != 1) {
-      k = IMIN(IMAX(gp_trad[s].idx - (m - 1) / 2, 0), n_old - m);
-    } else {
-      // The above formula for k is not valid for m==1
-      // (nearest neighbour interpolation).
-      if (gp_trad[s].fd[0] <= 0.5)
-        k = gp_trad[s].idx;
-      else
-        k = gp_trad[s].idx + 1;
-
-      // It is a matter of definition what we do with the exact fd==0.5 case.
-      // Here I arbitrarily decided to stick with the "left" point (smaller
-      // index). I believe this is consistent with the behaviour for m=3,
-      // where 2 points on the left and 1 point on the right is used. (So,
-      // we always prefer the left side.)
-    }
-
-    //      cout << "m: "<< m << ", k: " << k << endl;
-
-    // Make gp[s].idx and gp[s].w the right size:
-    gp[s].idx.resize(m);
-    gp[s].w.resize(m);
-
-    // Calculate w for each interpolation point. In the linear case
-    // these are just the fractional distances to each interpolation
-    // point. The w here correspond exactly to the terms in front of
-    // the yi in Numerical Recipes, 2nd edition, section 3.1,
-    // eq. 3.1.1.
-    for (Index i = 0; i < m; ++i) {
-      gp[s].idx[i] = k + i;
-
-      //  Numerical Recipes, 2nd edition, section 3.1, eq. 3.1.1.
-
-      // Numerator:
-      Numeric num = 1;
-      for (Index j = 0; j < m; ++j)
-        if (j != i) num *= new_grid[s] - old_grid[k + j];
-
-      // Denominator:
-      Numeric denom = 1;
-      for (Index j = 0; j < m; ++j)
-        if (j != i) denom *= old_grid[k + i] - old_grid[k + j];
-
-      gp[s].w[i] = num / denom;
-    }
-
-    // Debugging: Test if sum of all w is 1, as it should be:
-    //       Numeric testsum = 0;
-    //       for (Index i=0; i<m; ++i) testsum += gp[s].w[i];
-    //       cout << "Testsum = " << testsum << endl;
-  }
+  for (Index s = 0; s < n_new; ++s)
+    gridpos_poly_point(gp[s], gp_trad[s], old_grid, new_grid[s], m);
 }
 
 //! gridpos_poly
@@ -243,9 +258,71 @@ void gridpos_poly(GridPosPoly& gp,
                   const Numeric& new_grid,
                   const Index order,
                   const Numeric& extpolfac) {
-  ArrayOfGridPosPoly agp(1);
-  gridpos_poly(agp, old_grid, new_grid, order, extpolfac);
-  gp = agp[0];
+  // Number of points used in the interpolation (order + 1):
+  const Index m = order + 1;
+
+  const Index n_old = old_grid.nelem();
+
+  // Same assumptions and special cases as for the vector version above,
+  // but without any temporary arrays.
+  assert(n_old >= m);
+
+  GridPos gp_trad;
+  if (n_old > 1) {
+    gridpos(gp_trad, old_grid, new_grid, extpolfac);
+  } else {
+    gp_trad.idx = 0;
+    gp_trad.fd[0] = 0;
+    gp_trad.fd[1] = 1;
+  }
+
+  gridpos_poly_point(gp, gp_trad, old_grid, new_grid, m);
+}
+
+//! Grid position for the derivative of an interpolation.
+/*!
+  Sets up a grid position with the same points as gp, but with weights
+  that are the derivatives of the weights of gp with respect to the
+  new grid value. Interpolating with dgp thus gives the derivative of
+  the interpolating polynomial. The weights of dgp add up to zero, not
+  one, so dgp can not be used with the interp functions that check the
+  sum of the weights.
+
+  For nearest neighbour interpolation (order 0) all weights are zero.
+
+  \param[out] dgp      The grid position for the derivative.
+  \param[in]  gp       The grid position, from gridpos_poly.
+  \param[in]  old_grid The original grid used for gp.
+  \param[in]  new_grid The new grid value used for gp.
+*/
+void gridpos_poly_derivative(GridPosPoly& dgp,
+                             const GridPosPoly& gp,
+                             ConstVectorView old_grid,
+                             const Numeric& new_grid) {
+  const Index m = gp.idx.nelem();
+
+  dgp.idx = gp.idx;
+  dgp.w.resize(m);
+
+  // Derivative of Numerical Recipes, 2nd edition, section 3.1,
+  // eq. 3.1.1. The numerator is a product, its derivative the sum
+  // of the products leaving out one factor each.
+  for (Index i = 0; i < m; ++i) {
+    Numeric dnum = 0;
+    for (Index l = 0; l < m; ++l) {
+      if (l == i) continue;
+      Numeric num = 1;
+      for (Index j = 0; j < m; ++j)
+        if (j != i and j != l) num *= new_grid - old_grid[gp.idx[j]];
+      dnum += num;
+    }
+
+    Numeric denom = 1;
+    for (Index j = 0; j < m; ++j)
+      if (j != i) denom *= old_grid[gp.idx[i]] - old_grid[gp.idx[j]];
+
+    dgp.w[i] = dnum / denom;
+  }
 }
 
 //! Set up grid positions for higher order interpolation on longitudes.
@@ -348,9 +425,7 @@ void gridpos_poly_cyclic_longitudinal(ArrayOfGridPosPoly& gp,
   gridpos_poly(gp, large_grid, new_grid, order, extpolfac);
 
   for (ArrayOfGridPosPoly::iterator itgp = gp.begin(); itgp != gp.end(); itgp++)
-    for (ArrayOfIndex::iterator iti = itgp->idx.begin(); iti != itgp->idx.end();
-         iti++)
-      *iti %= new_n;
+    for (Index& i : itgp->idx) i %= new_n;
 }
 
 //! gridpos_poly_longitudinal
@@ -439,26 +514,23 @@ void gridpos_poly_cyclic_longitudinal(GridPosPoly& gp,
   for ( ConstIterator1D x=tx.w.begin(); x!=tx.w.end(); ++x )
 
 */
-#define LOOPW(x) for (ConstIterator1D x = t##x##begin; x != t##x##end; ++x)
+#define LOOPW(x) for (const Numeric* x = t##x##begin; x != t##x##end; ++x)
 
 //! Macro for caching begin and end iterators for interpolation weight loops.
-#define CACHEW(x)                                     \
-  const ConstIterator1D t##x##begin = t##x.w.begin(); \
-  const ConstIterator1D t##x##end = t##x.w.end();
+#define CACHEW(x)                                    \
+  const Numeric* const t##x##begin = t##x.w.begin(); \
+  const Numeric* const t##x##end = t##x.w.end();
 
 //! Macro for interpolation index loops.
 /*!
-  This is the same as LOOPW, but for loops over tx.idx. Since tx.idx
-  is an ArrayOfIndex, not a Vector, we have to use a different type of
-  iterator.
+  This is the same as LOOPW, but for loops over tx.idx.
 */
-#define LOOPIDX(x) \
-  for (ArrayOfIndex::const_iterator x = t##x##begin; x != t##x##end; ++x)
+#define LOOPIDX(x) for (const Index* x = t##x##begin; x != t##x##end; ++x)
 
 //! Macro for caching begin and end iterators for interpolation index loops.
-#define CACHEIDX(x)                                                  \
-  const ArrayOfIndex::const_iterator t##x##begin = t##x.idx.begin(); \
-  const ArrayOfIndex::const_iterator t##x##end = t##x.idx.end();
+#define CACHEIDX(x)                                   \
+  const Index* const t##x##begin = t##x.idx.begin(); \
+  const Index* const t##x##end = t##x.idx.end();
 
 //! Output operator for GridPosPoly.
 /*!
@@ -26,9 +26,71 @@
 #ifndef interpolation_poly_h
 #define interpolation_poly_h
 
+#include <array>
+#include <vector>
 #include "interpolation.h"
 #include "matpackI.h"
 
+//! Storage for the interpolation points of a GridPosPoly.
+/*!
+  Behaves like a small Array, but keeps up to ninline elements inside
+  the object itself. Grid positions for the interpolation orders used in
+  practice (up to 7, the default order for temperature in absorption
+  lookup tables) are thereby created and copied without any heap
+  allocation. Larger sizes fall back to heap storage.
+
+  As for Vector, resize does not preserve the content.
+*/
+template <typename T>
+class GridPosPolyArray {
+ public:
+  //! Number of elements that are stored without heap allocation.
+  static constexpr Index ninline = 8;
+
+  //! Number of elements.
+  Index nelem() const { return mn; }
+
+  //! Resize, the content is undefined afterwards.
+  void resize(const Index n) {
+    assert(n >= 0);
+    mn = n;
+    if (n > ninline) mheap.resize(n);
+  }
+
+  T* data() { return mn <= ninline ? mfixed.data() : mheap.data(); }
+  const T* data() const {
+    return mn <= ninline ? mfixed.data() : mheap.data();
+  }
+
+  T& operator[](const Index i) {
+    assert(i >= 0 && i < mn);
+    return data()[i];
+  }
+  const T& operator[](const Index i) const {
+    assert(i >= 0 && i < mn);
+    return data()[i];
+  }
+
+  T* begin() { return data(); }
+  T* end() { return data() + mn; }
+  const T* begin() const { return data(); }
+  const T* end() const { return data() + mn; }
+
+ private:
+  //! Number of elements.
+  Index mn = 0;
+  //! Inline storage, used if mn <= ninline.
+  std::array<T, ninline> mfixed;
+  //! Heap storage, used if mn > ninline.
+  std::vector<T> mheap;
+};
+
+template <typename T>
+ostream& operator<<(ostream& os, const GridPosPolyArray<T>& x) {
+  for (Index i = 0; i < x.nelem(); i++) os << (i ? " " : "") << x[i];
+  return os;
+}
+
 //! Structure to store a grid position for higher order interpolation.
 /*! 
   This serves the same purpose as GridPos for linear
@@ -64,10 +126,10 @@
 struct GridPosPoly {
   /*! Indices of the interpolation point in the original grid. 
       (Dimension is the number of points in the interpolation, m.)*/
-  ArrayOfIndex idx;
+  GridPosPolyArray<Index> idx;
   /*! Interpolation weight for each grid point to use.
       (Dimension is the number of points in the interpolation, m.)  */
-  Vector w;
+  GridPosPolyArray<Numeric> w;
 };
 
 //! An Array of grid positions.
@@ -91,6 +153,11 @@ void gridpos_poly(GridPosPoly& gp,
                   const Index order,
                   const Numeric& extpolfac = 0.5);
 
+void gridpos_poly_derivative(GridPosPoly& dgp,
+                             const GridPosPoly& gp,
+                             ConstVectorView old_grid,
+                             const Numeric& new_grid);
+
 void gridpos_poly_longitudinal(const String& error_msg,
                                ArrayOfGridPosPoly& gp,
                                ConstVectorView old_grid,
@@ -398,6 +398,7 @@
 
 #include "legacy_continua.h"
 #include <cmath>
+#include <map>
 #include "absorption.h"
 #include "array.h"
 #include "arts.h"
@@ -7102,6 +7103,135 @@ Numeric XINT_FUN(const Numeric V1A,
 
 // =================================================================================
 
+//! XINT_FUN interpolation weights of a CKD grid on a frequency grid
+/*!
+   The CKD models calculate their cross sections on the internal wavenumber
+   grid V1C + DVC*(J-1) and interpolate them to f_grid with XINT_FUN, once
+   for each pressure level. The interpolation weights only depend on f_grid
+   and the CKD grid, so they are calculated by update() and kept until one
+   of these changes.
+
+   Each model keeps a thread_local instance, so that repeated calls with
+   the same f_grid (e.g. for all points along a propagation path) only do
+   four multiply-adds per frequency in add(). The results are identical to
+   calling XINT_FUN directly.
+*/
+class CKDFrequencyWeights {
+ public:
+  /** Update the weights, if anything has changed since the last call.
+
+     Frequencies outside [vmin,vmax) (or (vmin,vmax) if vmin_incl is false)
+     and frequencies where XINT_FUN returns zero are dropped.
+
+     \param f_grid     Frequency grid [Hz]
+     \param V1A        First wavenumber of the CKD grid [cm^-1]
+     \param DVA        Wavenumber step of the CKD grid [cm^-1]
+     \param nA         Number of elements of the interpolated array
+     \param vmin       Lower wavenumber limit of the model [cm^-1]
+     \param vmax       Upper wavenumber limit of the model [cm^-1]
+     \param vmin_incl  Include vmin itself in the valid range
+  */
+  void update(ConstVectorView f_grid,
+              const Numeric V1A,
+              const Numeric DVA,
+              const Index nA,
+              const Numeric vmin,
+              const Numeric vmax,
+              const bool vmin_incl) {
+    const Index n_f = f_grid.nelem();
+
+    bool same = mna == nA && mv1a == V1A && mdva == DVA && mvmin == vmin &&
+                mvmax == vmax && mvmin_incl == vmin_incl &&
+                mf_grid.nelem() == n_f;
+    for (Index s = 0; same && s < n_f; ++s) same = mf_grid[s] == f_grid[s];
+    if (same) return;
+
+    mf_grid.resize(n_f);
+    mf_grid = f_grid;
+    mv1a = V1A;
+    mdva = DVA;
+    mna = nA;
+    mvmin = vmin;
+    mvmax = vmax;
+    mvmin_incl = vmin_incl;
+
+    mf.resize(0);
+    mj.resize(0);
+    mw.resize(n_f, 4);
+
+    // Same arithmetic as in XINT_FUN
+    const Numeric ONEPL = 1.001;
+    const Numeric RECDVA = 1.00e0 / DVA;
+
+    for (Index s = 0; s < n_f; ++s) {
+      const Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
+      if (!((vmin_incl ? V >= vmin : V > vmin) && V < vmax)) continue;
+
+      const int J = (int)((V - V1A) * RECDVA + ONEPL);
+      if (!(J - 1 > 0 && J + 2 < nA)) continue;
+
+      const Numeric VJ = V1A + DVA * (Numeric)(J - 1);
+      const Numeric P = RECDVA * (V - VJ);
+      const Numeric C = (3.00e0 - 2.00e0 * P) * P * P;
+      const Numeric B = 0.500e0 * P * (1.00e0 - P);
+      const Numeric B1 = B * (1.00e0 - P);
+      const Numeric B2 = B * P;
+
+      const Index n = mf.nelem();
+      mf.push_back(s);
+      mj.push_back(J);
+      mw(n, 0) = B1;
+      mw(n, 1) = 1.00e0 - C + B2;
+      mw(n, 2) = C + B1;
+      mw(n, 3) = B2;
+    }
+  }
+
+  /** Add the interpolated cross section to xsec.
+
+     \param xsec    Cross section on f_grid, the result is added here
+     \param k       Cross section on the CKD grid, nA elements
+     \param factor  Scaling factor applied to the interpolated values
+  */
+  void add(VectorView xsec, ConstVectorView k, const Numeric factor) const {
+    assert(k.nelem() == mna);
+    add_impl(xsec, k, factor);
+  }
+
+  /** Add the interpolated cross section to xsec.
+
+     \param xsec    Cross section on f_grid, the result is added here
+     \param k       Cross section on the CKD grid, nA elements
+     \param factor  Scaling factor applied to the interpolated values
+  */
+  void add(VectorView xsec, const Numeric k[], const Numeric factor) const {
+    add_impl(xsec, k, factor);
+  }
+
+ private:
+  template <class KArray>
+  void add_impl(VectorView xsec, const KArray &k, const Numeric factor) const {
+    for (Index n = 0; n < mf.nelem(); ++n) {
+      const Index J = mj[n];
+      xsec[mf[n]] += factor * (-k[J - 1] * mw(n, 0) + k[J] * mw(n, 1) +
+                               k[J + 1] * mw(n, 2) - k[J + 2] * mw(n, 3));
+    }
+  }
+
+  Vector mf_grid;
+  Numeric mv1a = 0.;
+  Numeric mdva = 0.;
+  Index mna = -1;
+  Numeric mvmin = 0.;
+  Numeric mvmax = 0.;
+  bool mvmin_incl = false;
+  ArrayOfIndex mf;
+  ArrayOfIndex mj;
+  Matrix mw;
+};
+
+// =================================================================================
+
 Numeric RADFN_FUN(const Numeric VI, const Numeric XKT) {
   // ---------------------------------------------------------------------- B18060
   //              LAST MODIFICATION:    12 AUGUST 1991                      B17940
@@ -7335,6 +7465,11 @@ void CKD_222_self_h2o(MatrixView pxsec,
   Numeric VS2 = 0.00e0;
   // FIXME Numeric VS4  = 0.00e0;
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields, 0.000e0,
+                      SL296_ckd_0_v2, true);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     // atmospheric state parameters
@@ -7390,20 +7525,9 @@ void CKD_222_self_h2o(MatrixView pxsec,
       k[J] = W1 * Rh2o * (SH2O * 1.000e-20) * RADFN_FUN(VJ, XKT);  // [1]
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V >= 0.000e0) && (V < SL296_ckd_0_v2)) {
-        // arts cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        // The factor 100 comes from the conversion from 1/cm to 1/m for
-        // the absorption coefficient
-        pxsec(s, i) += ScalingFac * 1.000e2 *
-                       XINT_FUN(V1C, V2C, DVC, k, NPTC + addF77fields, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 
@@ -7554,6 +7678,11 @@ void CKD_222_foreign_h2o(MatrixView pxsec,
   Numeric FSCAL = 0.000e0;
   Numeric FH2O = 0.000e0;
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields, 0.000e0, VABS_max,
+                      false);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     // atmospheric state parameters
@@ -7594,20 +7723,9 @@ void CKD_222_foreign_h2o(MatrixView pxsec,
       k[J] = WTOT * RFRGN * (FH2O * 1.000e-20) * RADFN_FUN(VJ, XKT);
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V > 0.000e0) && (V < VABS_max)) {
-        // arts CKD2.2.2 foreign H2O continuum cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        // The factor 100 comes from the conversion from (1/cm) to (1/m)
-        // of the abs. coeff.
-        pxsec(s, i) += ScalingFac * 1.000e2 *
-                       XINT_FUN(V1C, V2C, DVC, k, NPTC + addF77fields, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 
@@ -7802,6 +7920,11 @@ void CKD_242_self_h2o(MatrixView pxsec,
   Numeric VS2 = 0.00e0;
   Numeric VS4 = 0.00e0;
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields, 0.000e0,
+                      SL296_ckd_0_v2, true);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     // atmospheric state parameters
@@ -7862,20 +7985,9 @@ void CKD_242_self_h2o(MatrixView pxsec,
       k[J] = W1 * Rh2o * (SH2O * 1.000e-20) * RADFN_FUN(VJ, XKT);
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V >= 0.000e0) && (V < SL296_ckd_0_v2)) {
-        // arts cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        // The factor 100 comes from the conversion from 1/cm to 1/m for
-        // the absorption coefficient
-        pxsec(s, i) += ScalingFac * 1.000e2 *
-                       XINT_FUN(V1C, V2C, DVC, k, NPTC + addF77fields, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 
@@ -8037,6 +8149,11 @@ void CKD_242_foreign_h2o(MatrixView pxsec,
   Numeric FSCAL = 0.000e0;
   Numeric FH2O = 0.000e0;
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields, 0.000e0, VABS_max,
+                      true);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     // atmospheric state parameters
@@ -8088,18 +8205,9 @@ void CKD_242_foreign_h2o(MatrixView pxsec,
       k[J] = WTOT * RFRGN * (FH2O * 1.000e-20) * RADFN_FUN(VJ, XKT);
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V >= 0.000e0) && (V < VABS_max)) {
-        // arts CKD2.4.2 foreign H2O continuum cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        pxsec(s, i) += ScalingFac * 1.000e2 *
-                       XINT_FUN(V1C, V2C, DVC, k, NPTC + addF77fields, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 
@@ -8282,6 +8390,11 @@ void CKD_mt_100_self_h2o(MatrixView pxsec,
 
   Numeric SFAC = 1.00e0;
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields, 0.000e0,
+                      SL296_ckd_mt_100_v2, false);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     // atmospheric state parameters
@@ -8323,19 +8436,9 @@ void CKD_mt_100_self_h2o(MatrixView pxsec,
       k[J] = W1 * Rh2o * (SH2O * 1.000e-20) * RADFN_FUN(VJ, XKT);
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V > 0.000e0) && (V < SL296_ckd_mt_100_v2)) {
-        // arts cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        // The factor 100 comes from the conversion from 1/cm to 1/m for
-        // the absorption coefficient
-        pxsec(s, i) += ScalingFac * 1.000e2 * XINT_FUN(V1C, V2C, DVC, k, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 
@@ -8469,6 +8572,11 @@ void CKD_mt_100_foreign_h2o(MatrixView pxsec,
 
   // ---------------------- subroutine FRN296 ------------------------------
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields, 0.000e0, VABS_max,
+                      true);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     // atmospheric state parameters
@@ -8497,19 +8605,9 @@ void CKD_mt_100_foreign_h2o(MatrixView pxsec,
       k[J] = WTOT * RFRGN * (FH2O * 1.000e-20) * RADFN_FUN(VJ, XKT);
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V >= 0.000e0) && (V < VABS_max)) {
-        // arts CKD_MT.100 cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        // The factor 100 comes from the conversion from (1/cm) to (1/m)
-        // of the abs. coeff.
-        pxsec(s, i) += ScalingFac * 1.000e2 * XINT_FUN(V1C, V2C, DVC, k, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 
@@ -8716,6 +8814,11 @@ void CKD_mt_250_self_h2o(MatrixView pxsec,
 
   Numeric SFAC = 1.00e0;
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields, 0.000e0,
+                      SL296_ckd_mt_100_v2, false);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     // atmospheric state parameters
@@ -8771,19 +8874,9 @@ void CKD_mt_250_self_h2o(MatrixView pxsec,
       k[J] = W1 * Rh2o * (SH2O * 1.000e-20) * RADFN_FUN(VJ, XKT);
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V > 0.000e0) && (V < SL296_ckd_mt_100_v2)) {
-        // arts cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        // The factor 100 comes from the conversion from 1/cm to 1/m for
-        // the absorption coefficient
-        pxsec(s, i) += ScalingFac * 1.000e2 * XINT_FUN(V1C, V2C, DVC, k, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 
@@ -8917,6 +9010,11 @@ void CKD_mt_250_foreign_h2o(MatrixView pxsec,
 
   // ---------------------- subroutine FRN296 ------------------------------
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields, 0.000e0, VABS_max,
+                      true);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     // atmospheric state parameters
@@ -8957,19 +9055,9 @@ void CKD_mt_250_foreign_h2o(MatrixView pxsec,
       k[J] = WTOT * RFRGN * (FH2O * 1.000e-20) * RADFN_FUN(VJ, XKT);
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V >= 0.000e0) && (V < VABS_max)) {
-        // arts CKD_MT.100 cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        // The factor 100 comes from the conversion from (1/cm) to (1/m)
-        // of the abs. coeff.
-        pxsec(s, i) += ScalingFac * 1.000e2 * XINT_FUN(V1C, V2C, DVC, k, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 
@@ -9168,6 +9256,11 @@ void CKD_mt_320_self_h2o(MatrixView pxsec,
 
   Numeric SFAC = 1.00e0;
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields, 0.000e0,
+                      SL296_ckd_mt_320_v2, false);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     // atmospheric state parameters
@@ -9225,19 +9318,9 @@ void CKD_mt_320_self_h2o(MatrixView pxsec,
       k[J] = W1 * Rh2o * (SH2O * 1.000e-20) * RADFN_FUN(VJ, XKT);
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V > 0.000e0) && (V < SL296_ckd_mt_320_v2)) {
-        // arts cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        // The factor 100 comes from the conversion from 1/cm to 1/m for
-        // the absorption coefficient
-        pxsec(s, i) += ScalingFac * 1.000e2 * XINT_FUN(V1C, V2C, DVC, k, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 
@@ -9403,6 +9486,11 @@ void CKD_mt_320_foreign_h2o(MatrixView pxsec,
 
   // ---------------------- subroutine FRN296 ------------------------------
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields, 0.000e0, VABS_max,
+                      true);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     // atmospheric state parameters
@@ -9458,19 +9546,9 @@ void CKD_mt_320_foreign_h2o(MatrixView pxsec,
       k[J] = WTOT * RFRGN * (FH2O * 1.000e-20) * RADFN_FUN(VJ, XKT);
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V >= 0.000e0) && (V < VABS_max)) {
-        // arts CKD_MT.100 cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        // The factor 100 comes from the conversion from (1/cm) to (1/m)
-        // of the abs. coeff.
-        pxsec(s, i) += ScalingFac * 1.000e2 * XINT_FUN(V1C, V2C, DVC, k, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 
@@ -9610,6 +9688,11 @@ void CKD_241_co2(MatrixView pxsec,
 
   // ---------------------- subroutine FRNCO2 ------------------------------
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields, 0.000e0,
+                      FCO2_ckd_mt_100_v2, false);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     Numeric Tave = abs_t[i];               // [K]
@@ -9633,18 +9716,9 @@ void CKD_241_co2(MatrixView pxsec,
       k[J] = ((WTOT * Rhoave) * (FCO2 * 1.000e-20) * RADFN_FUN(VJ, XKT));
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V > 0.000e0) && (V < FCO2_ckd_mt_100_v2)) {
-        // arts cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        pxsec(s, i) += ScalingFac * 1.000e2 *
-                       XINT_FUN(V1C, V2C, DVC, k, NPTC + addF77fields, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 
@@ -9780,6 +9854,11 @@ void CKD_mt_co2(MatrixView pxsec,
 
   // ---------------------- subroutine FRNCO2 ------------------------------
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields, 0.000e0,
+                      FCO2_ckd_mt_100_v2, false);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     Numeric Tave = abs_t[i];               // [K]
@@ -9807,17 +9886,9 @@ void CKD_mt_co2(MatrixView pxsec,
       k[J] = ((WTOT * Rhoave) * (FCO2 * 1.000e-20) * RADFN_FUN(VJ, XKT));
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V > 0.000e0) && (V < FCO2_ckd_mt_100_v2)) {
-        // arts cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        pxsec(s, i) += ScalingFac * 1.000e2 * XINT_FUN(V1C, V2C, DVC, k, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 // =================================================================================
@@ -10020,6 +10091,11 @@ void CKD_mt_250_co2(MatrixView pxsec,
 
   // ---------------------- subroutine FRNCO2 ------------------------------
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields, 0.000e0,
+                      FCO2_ckd_mt_250_v2, false);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     Numeric Tave = abs_t[i];               // [K]
@@ -10059,17 +10135,9 @@ void CKD_mt_250_co2(MatrixView pxsec,
       k[J] = ((WTOT * Rhoave) * (FCO2 * 1.000e-20) * RADFN_FUN(VJ, XKT));
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V > 0.000e0) && (V < FCO2_ckd_mt_250_v2)) {
-        // arts cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        pxsec(s, i) += ScalingFac * 1.000e2 * XINT_FUN(V1C, V2C, DVC, k, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 
@@ -10246,6 +10314,11 @@ void CKD_mt_CIArot_n2(MatrixView pxsec,
 
   // ------------------- subroutine N2R296/N2R220 ----------------------------
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields, 0.000e0,
+                      N2N2_CT220_ckd_mt_100_v2, false);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     Numeric Tave = abs_t[i];               // [K]
@@ -10272,17 +10345,9 @@ void CKD_mt_CIArot_n2(MatrixView pxsec,
       k[J] = SN2 * RADFN_FUN(VJ, XKT);  // [1]
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V > 0.000e0) && (V < N2N2_CT220_ckd_mt_100_v2)) {
-        // arts cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        pxsec(s, i) += ScalingFac * 1.000e2 * XINT_FUN(V1C, V2C, DVC, k, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 
@@ -10431,6 +10496,11 @@ void CKD_mt_CIAfun_n2(MatrixView pxsec,
 
   // ------------------- subroutine N2_VER_1 ----------------------------
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields + 1,
+                      N2N2_N2F_ckd_mt_100_v1, N2N2_N2F_ckd_mt_100_v2, false);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     Numeric Tave = abs_t[i];                            // [K]
@@ -10464,17 +10534,9 @@ void CKD_mt_CIAfun_n2(MatrixView pxsec,
       k[J] = SN2 * RADFN_FUN(VJ, XKT);  // [1/cm]
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V > N2N2_N2F_ckd_mt_100_v1) && (V < N2N2_N2F_ckd_mt_100_v2)) {
-        // arts cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        pxsec(s, i) += ScalingFac * 1.000e2 * XINT_FUN(V1C, V2C, DVC, k, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 // =================================================================================
@@ -10663,6 +10725,11 @@ void CKD_mt_250_CIArot_n2(MatrixView pxsec,
 
   // ------------------- subroutine N2R296/N2R220 ----------------------------
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields, 0.000e0,
+                      N2N2_CT220_ckd_mt_100_v2, false);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     Numeric Tave = abs_t[i];               // [K]
@@ -10702,17 +10769,9 @@ void CKD_mt_250_CIArot_n2(MatrixView pxsec,
       k[J] = SN2 * RADFN_FUN(VJ, XKT);  // [1]
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V > 0.000e0) && (V < N2N2_CT220_ckd_mt_100_v2)) {
-        // arts cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        pxsec(s, i) += ScalingFac * 1.000e2 * XINT_FUN(V1C, V2C, DVC, k, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 
@@ -10861,6 +10920,11 @@ void CKD_mt_250_CIAfun_n2(MatrixView pxsec,
 
   // ------------------- subroutine N2_VER_1 ----------------------------
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields + 1,
+                      N2N2_N2F_ckd_mt_250_v1, N2N2_N2F_ckd_mt_250_v2, false);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     Numeric Tave = abs_t[i];                            // [K]
@@ -10902,17 +10966,9 @@ void CKD_mt_250_CIAfun_n2(MatrixView pxsec,
       k[J] = SN2 * RADFN_FUN(VJ, XKT);  // [1/cm]
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V > N2N2_N2F_ckd_mt_250_v1) && (V < N2N2_N2F_ckd_mt_250_v2)) {
-        // arts cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        pxsec(s, i) += ScalingFac * 1.000e2 * XINT_FUN(V1C, V2C, DVC, k, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 // =================================================================================
@@ -11055,6 +11111,11 @@ void CKD_mt_CIAfun_o2(MatrixView pxsec,
 
   // ------------------- subroutine O2_VER_1 ----------------------------
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields + 1,
+                      O2O2_O2F_ckd_mt_100_v1, O2O2_O2F_ckd_mt_100_v2, false);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     Numeric Tave = abs_t[i];               // [K]
@@ -11084,17 +11145,9 @@ void CKD_mt_CIAfun_o2(MatrixView pxsec,
       k[J] = SO2 * RADFN_FUN(VJ, XKT);  // [1]
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V > O2O2_O2F_ckd_mt_100_v1) && (V < O2O2_O2F_ckd_mt_100_v2)) {
-        // arts cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        pxsec(s, i) += ScalingFac * 1.000e2 * XINT_FUN(V1C, V2C, DVC, k, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 
@@ -11254,6 +11307,11 @@ void CKD_mt_v0v0_o2(MatrixView pxsec,
 
   // ------------------- subroutine O2INF1 ----------------------------
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields,
+                      O2_00_ckd_mt_100_v1, O2_00_ckd_mt_100_v2, false);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     Numeric Tave = abs_t[i];               // [K]
@@ -11281,18 +11339,9 @@ void CKD_mt_v0v0_o2(MatrixView pxsec,
       k[J] = SO2 * RADFN_FUN(VJ, XKT);  // [1/cm]
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V > O2_00_ckd_mt_100_v1) && (V < O2_00_ckd_mt_100_v2)) {
-        // arts cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        pxsec(s, i) += ScalingFac * 1.000e2 *
-                       XINT_FUN(V1C, V2C, DVC, k, NPTC + addF77fields, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 
@@ -11470,6 +11519,10 @@ void CKD_mt_v1v0_o2(MatrixView pxsec,
 
   // ------------------- subroutine O2INF2 ----------------------------
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields, V1S, V2S, false);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     Numeric Tave = abs_t[i];               // [K]
@@ -11496,18 +11549,9 @@ void CKD_mt_v1v0_o2(MatrixView pxsec,
       k[J] = SO2 * RADFN_FUN(VJ, XKT);  // [1]
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V > V1S) && (V < V2S)) {
-        // arts cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        pxsec(s, i) += ScalingFac * 1.000e2 *
-                       XINT_FUN(V1C, V2C, DVC, k, NPTC + addF77fields, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 // =================================================================================
@@ -11658,6 +11702,10 @@ void CKD_mt_250_o2_vis(MatrixView pxsec,
 
   // ------------------- subroutine O2_vis ----------------------------
 
+  // Interpolation weights of the CKD grid on f_grid
+  static thread_local CKDFrequencyWeights xint_weights;
+  xint_weights.update(f_grid, V1C, DVC, NPTC + addF77fields, V1S, V2S, false);
+
   // Loop pressure/temperature:
   for (Index i = 0; i < n_p; ++i) {
     Numeric Tave = abs_t[i];               // [K]
@@ -11691,18 +11739,9 @@ void CKD_mt_250_o2_vis(MatrixView pxsec,
       k[J] = SO2 * RADFN_FUN(VJ, XKT);  // [1]
     }
 
-    // Loop input frequency array. The previously calculated cross section
-    // has therefore to be interpolated on the input frequencies.
-    for (Index s = 0; s < n_f; ++s) {
-      // calculate the associated wave number (= 1/wavelength)
-      Numeric V = f_grid[s] / (SPEED_OF_LIGHT * 1.00e2);  // [cm^-1]
-      if ((V > V1S) && (V < V2S)) {
-        // arts cross section [1/m]
-        // interpolate the k vector on the f_grid grid
-        pxsec(s, i) += ScalingFac * 1.000e2 *
-                       XINT_FUN(V1C, V2C, DVC, k, NPTC + addF77fields, V);
-      }
-    }
+    // Interpolate the k vector on f_grid. The factor 100 comes from the
+    // conversion from 1/cm to 1/m for the absorption coefficient.
+    xint_weights.add(pxsec(joker, i), k, ScalingFac * 1.000e2);
   }
 }
 
@@ -16300,1638 +16339,2119 @@ Numeric MPMLineShapeO2Function(const Numeric gamma,
 // ############################################################################
 //
 //
-/**
-    Calculates model absorption for one continuum or full model tag.
-    Note, that only one tag can be taken at a time.
+/* In the following there is one function for each of the possible tags
+   listed here. After a first consistency check about the input
+   parameters, it calls the appropriate internal function. The functions
+   are found by their tag name in continuum_tag_function.
+
+   !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+   ATTENTION PLEASE UPDATE THIS COMMENT IF ANY CHANGES ARE MADE CONCERNING
+   THE ASSOCIATED MODELS TO EACH TAG
+   !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+
+   ----------------------------------------------------------------------------------------------------
+   TAG                      VALID MODELS
+   ----------------------------------------------------------------------------------------------------
+   *CONTAGMODINFO*   H2O-SelfContStandardType: Rosenkranz, user
+   *CONTAGMODINFO*   H2O-ForeignContStandardType: Rosenkranz, user
+   *CONTAGMODINFO*   H2O-ForeignContMaTippingType: MaTipping, user
+   *CONTAGMODINFO*   H2O-ContMPM93:           MPM93, user
+   *CONTAGMODINFO*   H2O-MPM87:               MPM87, MPM87Lines, MPM87Continuum, user
+   *CONTAGMODINFO*   H2O-MPM89:               MPM89, MPM89Lines, MPM89Continuum, user
+   *CONTAGMODINFO*   H2O-MPM93:               MPM93, MPM93Lines, MPM93Continuum, user
+   *CONTAGMODINFO*   H2O-PWR98:               Rosenkranz, RosenkranzLines, RosenkranzContinuum, user
+   *CONTAGMODINFO*   H2O-CP98:                CruzPol, CruzPolLine, CruzPolContinuum, user
+   *CONTAGMODINFO*   H2O-CKD24:               CKD24, user
+   *CONTAGMODINFO*   O2-MPM85:                MPM85, MPM85Lines, MPM85Continuum, MPM85NoCoupling, MPM85NoCutoff, user
+   *CONTAGMODINFO*   O2-MPM87:                MPM87, MPM87Lines, MPM87Continuum, MPM87NoCoupling, MPM87NoCutoff, user
+   *CONTAGMODINFO*   O2-MPM89:                MPM89, MPM89Lines, MPM89Continuum, MPM89NoCoupling, MPM89NoCutoff, user
+   *CONTAGMODINFO*   O2-MPM92:                MPM92, MPM92Lines, MPM92Continuum, MPM92NoCoupling, MPM92NoCutoff, user
+   *CONTAGMODINFO*   O2-MPM93:                MPM93, MPM93Lines, MPM93Continuum, MPM93NoCoupling, MPM92NoCutoff, user
+   *CONTAGMODINFO*   O2-PWR93:                Rosenkranz, RosenkranzLines, RosenkranzContinuum, user
+   *CONTAGMODINFO*   O2-PWR88:                Rosenkranz, RosenkranzLines, RosenkranzContinuum, user
+   *CONTAGMODINFO*   O2-SelfContMPM93:        MPM93, user
+   *CONTAGMODINFO*   O2-SelfContPWR93:        Rosenkranz, user
+   *CONTAGMODINFO*   O2-GenerealCont:         Rosenkranz, MPM93, user
+   *CONTAGMODINFO*   N2-BFCIA86:              BF86, user
+   *CONTAGMODINFO*   N2-SelfContMPM93:        MPM93, user, MPM93Scale
+   *CONTAGMODINFO*   N2-SelfContPWR93:        Rosenkranz, user
+   *CONTAGMODINFO*   N2-SelfContStandardType: Rosenkranz, user
+   *CONTAGMODINFO*   CO2-SelfContPWR93:       Rosenkranz, user
+   *CONTAGMODINFO*   CO2-ForeignContPWR93:    Rosenkranz, user
+   *CONTAGMODINFO*   liquidcloud-MPM93:       MPM93, user
+   *CONTAGMODINFO*   liquidcloud-ELL07:       ELL07
+   *CONTAGMODINFO*   icecloud-MPM93:          MPM93, user
+   *CONTAGMODINFO*   rain-MPM93:              MPM93, user
+   ----------------------------------------------------------------------------------------------------
+*/
 
-    Calculated is the true absorption cross section, that means you have to
-    multiply this with n*VMR in order to get the absorption
-    coefficient in units of 1/m.
+// ============= H2O continuum ========================================================
+static void pxsec_H2O_SelfContStandardType(MatrixView pxsec,
+                                           const String &name,
+                                           ConstVectorView parameters,
+                                           const String &model,
+                                           ConstVectorView f_grid,
+                                           ConstVectorView abs_p,
+                                           ConstVectorView abs_t,
+                                           ConstVectorView,
+                                           ConstVectorView,
+                                           ConstVectorView,
+                                           ConstVectorView vmr,
+                                           const Verbosity &verbosity) {
+  CREATE_OUT3;
+  //
+  //  specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum coefficient (C_s)  [1/m / (Hz*Pa)]
+  //     parameters[1] : temperature exponent  (x_s)  [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  const int Nparam = 2;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    Standard_H2O_self_continuum(pxsec,
+                                parameters[0],
+                                parameters[1],
+                                model,
+                                f_grid,
+                                abs_p,
+                                abs_t,
+                                vmr,
+                                verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    Standard_H2O_self_continuum(
+        pxsec, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
 
-    This is the type of xsec that is used all over ARTS, but not what
-    is used by the internal continuum functions! (We have to divide
-    the output of the internal continuum functions by the number
-    density n.)
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_H2O_ForeignContStandardType(MatrixView pxsec,
+                                              const String &name,
+                                              ConstVectorView parameters,
+                                              const String &model,
+                                              ConstVectorView f_grid,
+                                              ConstVectorView abs_p,
+                                              ConstVectorView abs_t,
+                                              ConstVectorView,
+                                              ConstVectorView,
+                                              ConstVectorView,
+                                              ConstVectorView vmr,
+                                              const Verbosity &verbosity) {
+  CREATE_OUT3;
+  //
+  // specific continuum parameters units:
+  //  a) output
+  //     pxsec          : [1/m],
+  //  b) input
+  //     parameters[0] : [1/m / (Hz*Pa)]
+  //     parameters[1] : [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  const int Nparam = 2;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    Standard_H2O_foreign_continuum(pxsec,
+                                   parameters[0],
+                                   parameters[1],
+                                   model,
+                                   f_grid,
+                                   abs_p,
+                                   abs_t,
+                                   vmr,
+                                   verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    Standard_H2O_foreign_continuum(
+        pxsec, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
 
-    \retval xsec       Cross section of one continuum tag,<br>
-                       xsec = alpha / (n*VMR)  [m^2]. This is both input
-                       and output! (The function adds the continuum
-                       absorption cross section to the previous
-                       content of xsec.)
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_H2O_ForeignContMaTippingType(MatrixView pxsec,
+                                               const String &name,
+                                               ConstVectorView parameters,
+                                               const String &model,
+                                               ConstVectorView f_grid,
+                                               ConstVectorView abs_p,
+                                               ConstVectorView abs_t,
+                                               ConstVectorView,
+                                               ConstVectorView,
+                                               ConstVectorView,
+                                               ConstVectorView vmr,
+                                               const Verbosity &verbosity) {
+  CREATE_OUT3;
+  //
+  // specific continuum parameters units:
+  //  a) output
+  //     pxsec          : [1/m],
+  //  b) input
+  //     parameters[0] : [1/m / (Hz*Pa)]
+  //     parameters[1] : [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  const int Nparam = 2;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    MaTipping_H2O_foreign_continuum(pxsec,
+                                    parameters[0],
+                                    parameters[1],
+                                    model,
+                                    f_grid,
+                                    abs_p,
+                                    abs_t,
+                                    vmr,
+                                    verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    MaTipping_H2O_foreign_continuum(
+        pxsec, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
 
-    \param  name       The name of the model to calculate (derived from the tag name)
-    \param  parameters model parameters, as defined in method
-                       abs_cont_parameters.
-    \param  model      model, related to model parameters
-    \param  f_grid     Frequency grid [Hz]
-    \param  abs_p      Pressure grid [Pa]
-    \param  abs_t      Temperatures associated with the pressure grid, abs_p [K]
-    \param  abs_n2     Total volume mixing ratio profile of molecular nitrogen.<br>
-                       This will be needed only for the CO2 foreign continuum [1]<br>
-                       however one is forced to give this input [1]
-    \param  abs_h2o    Total volume mixing ratio profile of water vapor.<br>
-                       This will be needed only for the oxygen continuum <br>
-                       however one is forced to give this input [1]
-    \param  vmr        Volume mixing ratio profile of the actual species [1]
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_H2O_ContMPM93(MatrixView pxsec,
+                                const String &name,
+                                ConstVectorView parameters,
+                                const String &model,
+                                ConstVectorView f_grid,
+                                ConstVectorView abs_p,
+                                ConstVectorView abs_t,
+                                ConstVectorView,
+                                ConstVectorView,
+                                ConstVectorView,
+                                ConstVectorView vmr,
+                                const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // self and foreign continuum term are simultaneously calculated
+  // since the parameterization can not be divided up in these two
+  // terms because they are not additive terms.
+  //
+  // specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : pseudo continuum line frequency                      [Hz]
+  //     parameters[1] : pseudo continuum line strength parameter             [Hz/Pa]
+  //     parameters[2] : pseudo continuum line strength temperature parameter [1]
+  //     parameters[3] : pseudo continuum line broadening parameter           [Hz/Pa]
+  //     parameters[4] : pseudo continuum line broadening parameter           [1]
+  //     parameters[5] : pseudo continuum line broadening parameter           [1]
+  //     parameters[6] : pseudo continuum line broadening parameter           [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  const int Nparam = 7;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    MPM93_H2O_continuum(pxsec,
+                        parameters[0],
+                        parameters[1],
+                        parameters[2],
+                        parameters[3],
+                        parameters[4],
+                        parameters[5],
+                        parameters[6],
+                        model,
+                        f_grid,
+                        abs_p,
+                        abs_t,
+                        vmr,
+                        verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    MPM93_H2O_continuum(pxsec,
+                        0.00,
+                        0.00,
+                        0.00,
+                        0.00,
+                        0.00,
+                        0.00,
+                        0.00,
+                        model,
+                        f_grid,
+                        abs_p,
+                        abs_t,
+                        vmr,
+                        verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters. "
+       << "\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
 
-   \author Stefan Buehler, Thomas Kuhn
-   \date 2001-11-05
- */
-void xsec_continuum_tag(MatrixView xsec,
-                        const String &name,
-                        ConstVectorView parameters,
-                        const String &model,
-                        ConstVectorView f_grid,
-                        ConstVectorView abs_p,
-                        ConstVectorView abs_t,
-                        ConstVectorView abs_n2,
-                        ConstVectorView abs_h2o,
-                        ConstVectorView abs_o2,
-                        ConstVectorView vmr,
-                        const Verbosity &verbosity) {
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_H2O_ForeignContATM01(MatrixView pxsec,
+                                       const String &name,
+                                       ConstVectorView parameters,
+                                       const String &model,
+                                       ConstVectorView f_grid,
+                                       ConstVectorView abs_p,
+                                       ConstVectorView abs_t,
+                                       ConstVectorView,
+                                       ConstVectorView,
+                                       ConstVectorView,
+                                       ConstVectorView vmr,
+                                       const Verbosity &verbosity) {
   CREATE_OUT3;
+  // Foreign wet continuum term.
+  //
+  // Pardo et al., IEEE, Trans. Ant. Prop.,
+  // Vol 49, No 12, pp. 1683-1694, 2001.
+  //
+  // specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : pseudo continuum line frequency                      [Hz]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    Pardo_ATM_H2O_ForeignContinuum(
+        pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    Pardo_ATM_H2O_ForeignContinuum(
+        pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters. "
+       << "\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
 
-  /* In the following all the possible tags are listed here and
-     after a first consistency check about the input parameters the
-     appropriate internal function is called,
-
-     !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-     ATTENTION PLEASE UPDATE THIS COMMENT IF ANY CHANGES ARE MADE CONCERNING
-     THE ASSOCIATED MODELS TO EACH TAG
-     !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-
-     ----------------------------------------------------------------------------------------------------
-     TAG                      VALID MODELS
-     ----------------------------------------------------------------------------------------------------
-     *CONTAGMODINFO*   H2O-SelfContStandardType: Rosenkranz, user
-     *CONTAGMODINFO*   H2O-ForeignContStandardType: Rosenkranz, user
-     *CONTAGMODINFO*   H2O-ForeignContMaTippingType: MaTipping, user
-     *CONTAGMODINFO*   H2O-ContMPM93:           MPM93, user
-     *CONTAGMODINFO*   H2O-MPM87:               MPM87, MPM87Lines, MPM87Continuum, user
-     *CONTAGMODINFO*   H2O-MPM89:               MPM89, MPM89Lines, MPM89Continuum, user
-     *CONTAGMODINFO*   H2O-MPM93:               MPM93, MPM93Lines, MPM93Continuum, user
-     *CONTAGMODINFO*   H2O-PWR98:               Rosenkranz, RosenkranzLines, RosenkranzContinuum, user
-     *CONTAGMODINFO*   H2O-CP98:                CruzPol, CruzPolLine, CruzPolContinuum, user
-     *CONTAGMODINFO*   H2O-CKD24:               CKD24, user
-     *CONTAGMODINFO*   O2-MPM85:                MPM85, MPM85Lines, MPM85Continuum, MPM85NoCoupling, MPM85NoCutoff, user
-     *CONTAGMODINFO*   O2-MPM87:                MPM87, MPM87Lines, MPM87Continuum, MPM87NoCoupling, MPM87NoCutoff, user
-     *CONTAGMODINFO*   O2-MPM89:                MPM89, MPM89Lines, MPM89Continuum, MPM89NoCoupling, MPM89NoCutoff, user
-     *CONTAGMODINFO*   O2-MPM92:                MPM92, MPM92Lines, MPM92Continuum, MPM92NoCoupling, MPM92NoCutoff, user
-     *CONTAGMODINFO*   O2-MPM93:                MPM93, MPM93Lines, MPM93Continuum, MPM93NoCoupling, MPM92NoCutoff, user
-     *CONTAGMODINFO*   O2-PWR93:                Rosenkranz, RosenkranzLines, RosenkranzContinuum, user
-     *CONTAGMODINFO*   O2-PWR88:                Rosenkranz, RosenkranzLines, RosenkranzContinuum, user
-     *CONTAGMODINFO*   O2-SelfContMPM93:        MPM93, user
-     *CONTAGMODINFO*   O2-SelfContPWR93:        Rosenkranz, user
-     *CONTAGMODINFO*   O2-GenerealCont:         Rosenkranz, MPM93, user
-     *CONTAGMODINFO*   N2-BFCIA86:              BF86, user
-     *CONTAGMODINFO*   N2-SelfContMPM93:        MPM93, user, MPM93Scale
-     *CONTAGMODINFO*   N2-SelfContPWR93:        Rosenkranz, user
-     *CONTAGMODINFO*   N2-SelfContStandardType: Rosenkranz, user
-     *CONTAGMODINFO*   CO2-SelfContPWR93:       Rosenkranz, user
-     *CONTAGMODINFO*   CO2-ForeignContPWR93:    Rosenkranz, user
-     *CONTAGMODINFO*   liquidcloud-MPM93:       MPM93, user
-     *CONTAGMODINFO*   liquidcloud-ELL07:       ELL07
-     *CONTAGMODINFO*   icecloud-MPM93:          MPM93, user
-     *CONTAGMODINFO*   rain-MPM93:              MPM93, user
-     ----------------------------------------------------------------------------------------------------
-  */
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_H2O_SelfContCKD222(MatrixView pxsec,
+                                     const String &name,
+                                     ConstVectorView parameters,
+                                     const String &model,
+                                     ConstVectorView f_grid,
+                                     ConstVectorView abs_p,
+                                     ConstVectorView abs_t,
+                                     ConstVectorView,
+                                     ConstVectorView,
+                                     ConstVectorView,
+                                     ConstVectorView vmr,
+                                     const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // OUTPUT:
+  //   pxsec           cross section (absorption/volume mixing ratio) of
+  //                  H2O self continuum according to CKD2.2.2    [1/m]
+  // INPUT:
+  //   parameters[0]  strength scaling factor              [1]
+  //   model          allows user defined input parameter set
+  //                  (Cin) or choice of
+  //                  pre-defined parameters of specific models (see note below).
+  //   f_grid         predefined frequency grid            [Hz]
+  //   abs_p          predefined pressure grid             [Pa]
+  //   abs_t          predefined temperature grid          [K]
+  //   vmr            H2O volume mixing ratio profile      [1]
+  //
+  // WWW resource: ftp.aer.com/aer_contnm_ckd
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_222_self_h2o(
+        pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_222_self_h2o(
+        pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
 
-  // Set up a lokal variable pxsec for the pseudo cross sections, that
-  // are used by the internal contiuum functions. It is important that
-  // we also inititialize this to zero here, since the continuum
-  // routines just add to this.
-  // The dimensions of this are [n_frequencies,n_pressures].
-  Matrix pxsec(xsec.nrows(), xsec.ncols(), 0.0);
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_H2O_ForeignContCKD222(MatrixView pxsec,
+                                        const String &name,
+                                        ConstVectorView parameters,
+                                        const String &model,
+                                        ConstVectorView f_grid,
+                                        ConstVectorView abs_p,
+                                        ConstVectorView abs_t,
+                                        ConstVectorView,
+                                        ConstVectorView,
+                                        ConstVectorView,
+                                        ConstVectorView vmr,
+                                        const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // OUTPUT:
+  //   pxsec           cross section (absorption/volume mixing ratio) of
+  //                  H2O foreign continuum according to CKD2.2.2    [1/m]
+  // INPUT:
+  //   parameters[0]  strength scaling factor              [1]
+  //   model          allows user defined input parameter set
+  //                  (Cin) or choice of
+  //                  pre-defined parameters of specific models (see note below).
+  //   f_grid         predefined frequency grid            [Hz]
+  //   abs_p          predefined pressure grid             [Pa]
+  //   abs_t          predefined temperature grid          [K]
+  //   vmr            H2O volume mixing ratio profile      [1]
+  //
+  // WWW resource: ftp.aer.com/aer_contnm_ckd
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_222_foreign_h2o(
+        pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_222_foreign_h2o(
+        pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
 
-  // ============= H2O continuum ========================================================
-  if ("H2O-SelfContStandardType" == name) {
-    //
-    //  specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum coefficient (C_s)  [1/m / (Hz*Pa)]
-    //     parameters[1] : temperature exponent  (x_s)  [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    const int Nparam = 2;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      Standard_H2O_self_continuum(pxsec,
-                                  parameters[0],
-                                  parameters[1],
-                                  model,
-                                  f_grid,
-                                  abs_p,
-                                  abs_t,
-                                  vmr,
-                                  verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      Standard_H2O_self_continuum(
-          pxsec, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_H2O_SelfContCKD242(MatrixView pxsec,
+                                     const String &name,
+                                     ConstVectorView parameters,
+                                     const String &model,
+                                     ConstVectorView f_grid,
+                                     ConstVectorView abs_p,
+                                     ConstVectorView abs_t,
+                                     ConstVectorView,
+                                     ConstVectorView,
+                                     ConstVectorView,
+                                     ConstVectorView vmr,
+                                     const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // OUTPUT:
+  //   pxsec           cross section (absorption/volume mixing ratio) of
+  //                  H2O self continuum according to CKD2.4.2    [1/m]
+  // INPUT:
+  //   parameters[0]  strength scaling factor              [1]
+  //   model          allows user defined input parameter set
+  //                  (Cin) or choice of
+  //                  pre-defined parameters of specific models (see note below).
+  //   f_grid         predefined frequency grid            [Hz]
+  //   abs_p          predefined pressure grid             [Pa]
+  //   abs_t          predefined temperature grid          [K]
+  //   vmr            H2O volume mixing ratio profile      [1]
+  //
+  // WWW resource: ftp.aer.com/aer_contnm_ckd
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_242_self_h2o(
+        pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_242_self_h2o(
+        pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("H2O-ForeignContStandardType" == name) {
-    //
-    // specific continuum parameters units:
-    //  a) output
-    //     pxsec          : [1/m],
-    //  b) input
-    //     parameters[0] : [1/m / (Hz*Pa)]
-    //     parameters[1] : [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    const int Nparam = 2;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      Standard_H2O_foreign_continuum(pxsec,
-                                     parameters[0],
-                                     parameters[1],
-                                     model,
-                                     f_grid,
-                                     abs_p,
-                                     abs_t,
-                                     vmr,
-                                     verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      Standard_H2O_foreign_continuum(
-          pxsec, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_H2O_ForeignContCKD242(MatrixView pxsec,
+                                        const String &name,
+                                        ConstVectorView parameters,
+                                        const String &model,
+                                        ConstVectorView f_grid,
+                                        ConstVectorView abs_p,
+                                        ConstVectorView abs_t,
+                                        ConstVectorView,
+                                        ConstVectorView,
+                                        ConstVectorView,
+                                        ConstVectorView vmr,
+                                        const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // OUTPUT:
+  //   pxsec           cross section (absorption/volume mixing ratio) of
+  //                  H2O foreign continuum according to CKD2.4.2    [1/m]
+  // INPUT:
+  //   parameters[0]  strength scaling factor              [1]
+  //   model          allows user defined input parameter set
+  //                  (Cin) or choice of
+  //                  pre-defined parameters of specific models (see note below).
+  //   f_grid         predefined frequency grid            [Hz]
+  //   abs_p          predefined pressure grid             [Pa]
+  //   abs_t          predefined temperature grid          [K]
+  //   vmr            H2O volume mixing ratio profile      [1]
+  //
+  // WWW resource: ftp.aer.com/aer_contnm_ckd
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_242_foreign_h2o(
+        pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_242_foreign_h2o(
+        pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("H2O-ForeignContMaTippingType" == name) {
-    //
-    // specific continuum parameters units:
-    //  a) output
-    //     pxsec          : [1/m],
-    //  b) input
-    //     parameters[0] : [1/m / (Hz*Pa)]
-    //     parameters[1] : [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    const int Nparam = 2;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      MaTipping_H2O_foreign_continuum(pxsec,
-                                      parameters[0],
-                                      parameters[1],
-                                      model,
-                                      f_grid,
-                                      abs_p,
-                                      abs_t,
-                                      vmr,
-                                      verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      MaTipping_H2O_foreign_continuum(
-          pxsec, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_H2O_SelfContCKDMT100(MatrixView pxsec,
+                                       const String &name,
+                                       ConstVectorView parameters,
+                                       const String &model,
+                                       ConstVectorView f_grid,
+                                       ConstVectorView abs_p,
+                                       ConstVectorView abs_t,
+                                       ConstVectorView,
+                                       ConstVectorView,
+                                       ConstVectorView,
+                                       ConstVectorView vmr,
+                                       const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // OUTPUT:
+  //   pxsec           cross section (absorption/volume mixing ratio) of
+  //                  H2O self continuum according to CKD MT 1.00    [1/m]
+  // INPUT:
+  //   parameters[0]  strength scaling factor              [1]
+  //   model          allows user defined input parameter set
+  //                  (Cin) or choice of
+  //                  pre-defined parameters of specific models (see note below).
+  //   f_grid         predefined frequency grid            [Hz]
+  //   abs_p          predefined pressure grid             [Pa]
+  //   abs_t          predefined temperature grid          [K]
+  //   vmr            H2O volume mixing ratio profile      [1]
+  //
+  // WWW resource: ftp.aer.com/aer_contnm_ckd
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_mt_100_self_h2o(
+        pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_mt_100_self_h2o(
+        pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("H2O-ContMPM93" == name) {
-    // self and foreign continuum term are simultaneously calculated
-    // since the parameterization can not be divided up in these two
-    // terms because they are not additive terms.
-    //
-    // specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : pseudo continuum line frequency                      [Hz]
-    //     parameters[1] : pseudo continuum line strength parameter             [Hz/Pa]
-    //     parameters[2] : pseudo continuum line strength temperature parameter [1]
-    //     parameters[3] : pseudo continuum line broadening parameter           [Hz/Pa]
-    //     parameters[4] : pseudo continuum line broadening parameter           [1]
-    //     parameters[5] : pseudo continuum line broadening parameter           [1]
-    //     parameters[6] : pseudo continuum line broadening parameter           [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    const int Nparam = 7;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      MPM93_H2O_continuum(pxsec,
-                          parameters[0],
-                          parameters[1],
-                          parameters[2],
-                          parameters[3],
-                          parameters[4],
-                          parameters[5],
-                          parameters[6],
-                          model,
-                          f_grid,
-                          abs_p,
-                          abs_t,
-                          vmr,
-                          verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      MPM93_H2O_continuum(pxsec,
-                          0.00,
-                          0.00,
-                          0.00,
-                          0.00,
-                          0.00,
-                          0.00,
-                          0.00,
-                          model,
-                          f_grid,
-                          abs_p,
-                          abs_t,
-                          vmr,
-                          verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters. "
-         << "\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_H2O_ForeignContCKDMT100(MatrixView pxsec,
+                                          const String &name,
+                                          ConstVectorView parameters,
+                                          const String &model,
+                                          ConstVectorView f_grid,
+                                          ConstVectorView abs_p,
+                                          ConstVectorView abs_t,
+                                          ConstVectorView,
+                                          ConstVectorView,
+                                          ConstVectorView,
+                                          ConstVectorView vmr,
+                                          const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // OUTPUT:
+  //   pxsec           cross section (absorption/volume mixing ratio) of
+  //                  H2O foreign continuum according to CKD MT 1.00    [1/m]
+  // INPUT:
+  //   parameters[0]  strength scaling factor              [1]
+  //   model          allows user defined input parameter set
+  //                  (Cin) or choice of
+  //                  pre-defined parameters of specific models (see note below).
+  //   f_grid         predefined frequency grid            [Hz]
+  //   abs_p          predefined pressure grid             [Pa]
+  //   abs_t          predefined temperature grid          [K]
+  //   vmr            H2O volume mixing ratio profile      [1]
+  //
+  // WWW resource: ftp.aer.com/aer_contnm_ckd
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_mt_100_foreign_h2o(
+        pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_mt_100_foreign_h2o(
+        pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("H2O-ForeignContATM01" == name) {
-    // Foreign wet continuum term.
-    //
-    // Pardo et al., IEEE, Trans. Ant. Prop.,
-    // Vol 49, No 12, pp. 1683-1694, 2001.
-    //
-    // specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : pseudo continuum line frequency                      [Hz]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      Pardo_ATM_H2O_ForeignContinuum(
-          pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      Pardo_ATM_H2O_ForeignContinuum(
-          pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters. "
-         << "\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_H2O_SelfContCKDMT252(MatrixView pxsec,
+                                       const String &name,
+                                       ConstVectorView parameters,
+                                       const String &model,
+                                       ConstVectorView f_grid,
+                                       ConstVectorView abs_p,
+                                       ConstVectorView abs_t,
+                                       ConstVectorView,
+                                       ConstVectorView,
+                                       ConstVectorView,
+                                       ConstVectorView vmr,
+                                       const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // OUTPUT:
+  //   pxsec           cross section (absorption/volume mixing ratio) of
+  //                  H2O self continuum according to CKD MT 2.50    [1/m]
+  // INPUT:
+  //   parameters[0]  strength scaling factor              [1]
+  //   model          allows user defined input parameter set
+  //                  (Cin) or choice of
+  //                  pre-defined parameters of specific models (see note below).
+  //   f_grid         predefined frequency grid            [Hz]
+  //   abs_p          predefined pressure grid             [Pa]
+  //   abs_t          predefined temperature grid          [K]
+  //   vmr            H2O volume mixing ratio profile      [1]
+  //
+  // WWW resource: ftp.aer.com/aer_contnm_ckd
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_mt_250_self_h2o(
+        pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_mt_250_self_h2o(
+        pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("H2O-SelfContCKD222" == name) {
-    // OUTPUT:
-    //   pxsec           cross section (absorption/volume mixing ratio) of
-    //                  H2O self continuum according to CKD2.2.2    [1/m]
-    // INPUT:
-    //   parameters[0]  strength scaling factor              [1]
-    //   model          allows user defined input parameter set
-    //                  (Cin) or choice of
-    //                  pre-defined parameters of specific models (see note below).
-    //   f_grid         predefined frequency grid            [Hz]
-    //   abs_p          predefined pressure grid             [Pa]
-    //   abs_t          predefined temperature grid          [K]
-    //   vmr            H2O volume mixing ratio profile      [1]
-    //
-    // WWW resource: ftp.aer.com/aer_contnm_ckd
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_222_self_h2o(
-          pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_222_self_h2o(
-          pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_H2O_ForeignContCKDMT252(MatrixView pxsec,
+                                          const String &name,
+                                          ConstVectorView parameters,
+                                          const String &model,
+                                          ConstVectorView f_grid,
+                                          ConstVectorView abs_p,
+                                          ConstVectorView abs_t,
+                                          ConstVectorView,
+                                          ConstVectorView,
+                                          ConstVectorView,
+                                          ConstVectorView vmr,
+                                          const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // OUTPUT:
+  //   pxsec           cross section (absorption/volume mixing ratio) of
+  //                  H2O foreign continuum according to CKD MT 2.50    [1/m]
+  // INPUT:
+  //   parameters[0]  strength scaling factor              [1]
+  //   model          allows user defined input parameter set
+  //                  (Cin) or choice of
+  //                  pre-defined parameters of specific models (see note below).
+  //   f_grid         predefined frequency grid            [Hz]
+  //   abs_p          predefined pressure grid             [Pa]
+  //   abs_t          predefined temperature grid          [K]
+  //   vmr            H2O volume mixing ratio profile      [1]
+  //
+  // WWW resource: ftp.aer.com/aer_contnm_ckd
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_mt_250_foreign_h2o(
+        pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_mt_250_foreign_h2o(
+        pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("H2O-ForeignContCKD222" == name) {
-    // OUTPUT:
-    //   pxsec           cross section (absorption/volume mixing ratio) of
-    //                  H2O foreign continuum according to CKD2.2.2    [1/m]
-    // INPUT:
-    //   parameters[0]  strength scaling factor              [1]
-    //   model          allows user defined input parameter set
-    //                  (Cin) or choice of
-    //                  pre-defined parameters of specific models (see note below).
-    //   f_grid         predefined frequency grid            [Hz]
-    //   abs_p          predefined pressure grid             [Pa]
-    //   abs_t          predefined temperature grid          [K]
-    //   vmr            H2O volume mixing ratio profile      [1]
-    //
-    // WWW resource: ftp.aer.com/aer_contnm_ckd
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_222_foreign_h2o(
-          pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_222_foreign_h2o(
-          pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_H2O_SelfContCKDMT320(MatrixView pxsec,
+                                       const String &name,
+                                       ConstVectorView parameters,
+                                       const String &model,
+                                       ConstVectorView f_grid,
+                                       ConstVectorView abs_p,
+                                       ConstVectorView abs_t,
+                                       ConstVectorView,
+                                       ConstVectorView,
+                                       ConstVectorView,
+                                       ConstVectorView vmr,
+                                       const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // OUTPUT:
+  //   pxsec           cross section (absorption/volume mixing ratio) of
+  //                  H2O self continuum according to CKD MT 2.50    [1/m]
+  // INPUT:
+  //   parameters[0]  strength scaling factor              [1]
+  //   model          allows user defined input parameter set
+  //                  (Cin) or choice of
+  //                  pre-defined parameters of specific models (see note below).
+  //   f_grid         predefined frequency grid            [Hz]
+  //   abs_p          predefined pressure grid             [Pa]
+  //   abs_t          predefined temperature grid          [K]
+  //   vmr            H2O volume mixing ratio profile      [1]
+  //
+  // WWW resource: ftp.aer.com/aer_contnm_ckd
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_mt_320_self_h2o(
+        pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_mt_320_self_h2o(
+        pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("H2O-SelfContCKD242" == name) {
-    // OUTPUT:
-    //   pxsec           cross section (absorption/volume mixing ratio) of
-    //                  H2O self continuum according to CKD2.4.2    [1/m]
-    // INPUT:
-    //   parameters[0]  strength scaling factor              [1]
-    //   model          allows user defined input parameter set
-    //                  (Cin) or choice of
-    //                  pre-defined parameters of specific models (see note below).
-    //   f_grid         predefined frequency grid            [Hz]
-    //   abs_p          predefined pressure grid             [Pa]
-    //   abs_t          predefined temperature grid          [K]
-    //   vmr            H2O volume mixing ratio profile      [1]
-    //
-    // WWW resource: ftp.aer.com/aer_contnm_ckd
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_242_self_h2o(
-          pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_242_self_h2o(
-          pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_H2O_ForeignContCKDMT320(MatrixView pxsec,
+                                          const String &name,
+                                          ConstVectorView parameters,
+                                          const String &model,
+                                          ConstVectorView f_grid,
+                                          ConstVectorView abs_p,
+                                          ConstVectorView abs_t,
+                                          ConstVectorView,
+                                          ConstVectorView,
+                                          ConstVectorView,
+                                          ConstVectorView vmr,
+                                          const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // OUTPUT:
+  //   pxsec           cross section (absorption/volume mixing ratio) of
+  //                  H2O foreign continuum according to CKD MT 2.50    [1/m]
+  // INPUT:
+  //   parameters[0]  strength scaling factor              [1]
+  //   model          allows user defined input parameter set
+  //                  (Cin) or choice of
+  //                  pre-defined parameters of specific models (see note below).
+  //   f_grid         predefined frequency grid            [Hz]
+  //   abs_p          predefined pressure grid             [Pa]
+  //   abs_t          predefined temperature grid          [K]
+  //   vmr            H2O volume mixing ratio profile      [1]
+  //
+  // WWW resource: ftp.aer.com/aer_contnm_ckd
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_mt_320_foreign_h2o(
+        pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_mt_320_foreign_h2o(
+        pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("H2O-ForeignContCKD242" == name) {
-    // OUTPUT:
-    //   pxsec           cross section (absorption/volume mixing ratio) of
-    //                  H2O foreign continuum according to CKD2.4.2    [1/m]
-    // INPUT:
-    //   parameters[0]  strength scaling factor              [1]
-    //   model          allows user defined input parameter set
-    //                  (Cin) or choice of
-    //                  pre-defined parameters of specific models (see note below).
-    //   f_grid         predefined frequency grid            [Hz]
-    //   abs_p          predefined pressure grid             [Pa]
-    //   abs_t          predefined temperature grid          [K]
-    //   vmr            H2O volume mixing ratio profile      [1]
-    //
-    // WWW resource: ftp.aer.com/aer_contnm_ckd
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_242_foreign_h2o(
-          pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_242_foreign_h2o(
-          pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_H2O_SelfContCKD24(MatrixView pxsec,
+                                    const String &name,
+                                    ConstVectorView parameters,
+                                    const String &model,
+                                    ConstVectorView f_grid,
+                                    ConstVectorView abs_p,
+                                    ConstVectorView abs_t,
+                                    ConstVectorView abs_n2,
+                                    ConstVectorView,
+                                    ConstVectorView,
+                                    ConstVectorView vmr,
+                                    const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // OUTPUT:
+  //   pxsec           cross section (absorption/volume mixing ratio) of
+  //                  H2O continuum according to CKD2.4    [1/m]
+  // INPUT:
+  //   parameters[0]  strength scaling factor              [1]
+  //   model          allows user defined input parameter set
+  //                  (Cin) or choice of
+  //                  pre-defined parameters of specific models (see note below).
+  //   f_grid         predefined frequency grid            [Hz]
+  //   abs_p          predefined pressure grid             [Pa]
+  //   abs_t          predefined temperature grid          [K]
+  //   abs_n2         N2 volume mixing ratio profile       [1]
+  //   vmr            H2O volume mixing ratio profile      [1]
+  //
+  // WWW resource: ftp.aer.com/aer_contnm_ckd
+
+  // abs_n2 needed here. check, whether this is valid.
+  if (abs_n2.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires N2-vmr, but no tag group contains N2!";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("H2O-SelfContCKDMT100" == name) {
-    // OUTPUT:
-    //   pxsec           cross section (absorption/volume mixing ratio) of
-    //                  H2O self continuum according to CKD MT 1.00    [1/m]
-    // INPUT:
-    //   parameters[0]  strength scaling factor              [1]
-    //   model          allows user defined input parameter set
-    //                  (Cin) or choice of
-    //                  pre-defined parameters of specific models (see note below).
-    //   f_grid         predefined frequency grid            [Hz]
-    //   abs_p          predefined pressure grid             [Pa]
-    //   abs_t          predefined temperature grid          [K]
-    //   vmr            H2O volume mixing ratio profile      [1]
-    //
-    // WWW resource: ftp.aer.com/aer_contnm_ckd
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_mt_100_self_h2o(
-          pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_mt_100_self_h2o(
-          pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD24_H20(pxsec,
+              0,
+              parameters[0],
+              model,
+              f_grid,
+              abs_p,
+              abs_t,
+              vmr,
+              abs_n2,
+              verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD24_H20(
+        pxsec, 0, 0.000, model, f_grid, abs_p, abs_t, vmr, abs_n2, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("H2O-ForeignContCKDMT100" == name) {
-    // OUTPUT:
-    //   pxsec           cross section (absorption/volume mixing ratio) of
-    //                  H2O foreign continuum according to CKD MT 1.00    [1/m]
-    // INPUT:
-    //   parameters[0]  strength scaling factor              [1]
-    //   model          allows user defined input parameter set
-    //                  (Cin) or choice of
-    //                  pre-defined parameters of specific models (see note below).
-    //   f_grid         predefined frequency grid            [Hz]
-    //   abs_p          predefined pressure grid             [Pa]
-    //   abs_t          predefined temperature grid          [K]
-    //   vmr            H2O volume mixing ratio profile      [1]
-    //
-    // WWW resource: ftp.aer.com/aer_contnm_ckd
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_mt_100_foreign_h2o(
-          pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_mt_100_foreign_h2o(
-          pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_H2O_ForeignContCKD24(MatrixView pxsec,
+                                       const String &name,
+                                       ConstVectorView parameters,
+                                       const String &model,
+                                       ConstVectorView f_grid,
+                                       ConstVectorView abs_p,
+                                       ConstVectorView abs_t,
+                                       ConstVectorView abs_n2,
+                                       ConstVectorView,
+                                       ConstVectorView,
+                                       ConstVectorView vmr,
+                                       const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // OUTPUT:
+  //   pxsec             cross section (absorption/volume mixing ratio) of
+  //                    H2O continuum according to CKD2.4    [1/m]
+  // INPUT:
+  //   Cin            strength scaling factor              [1]
+  //   model          allows user defined input parameter set
+  //                  (Cin) or choice of
+  //                  pre-defined parameters of specific models (see note below).
+  //   f_grid         predefined frequency grid            [Hz]
+  //   abs_p          predefined pressure grid             [Pa]
+  //   abs_t          predefined temperature grid          [K]
+  //   vmr            H2O volume mixing ratio profile      [1]
+  //   abs_n2         N2 volume mixing ratio profile       [1]
+  //
+  // WWW resource: ftp.aer.com/aer_contnm_ckd
+
+  if (abs_n2.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires N2-vmr, but no tag group contains N2!";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("H2O-SelfContCKDMT252" == name) {
-    // OUTPUT:
-    //   pxsec           cross section (absorption/volume mixing ratio) of
-    //                  H2O self continuum according to CKD MT 2.50    [1/m]
-    // INPUT:
-    //   parameters[0]  strength scaling factor              [1]
-    //   model          allows user defined input parameter set
-    //                  (Cin) or choice of
-    //                  pre-defined parameters of specific models (see note below).
-    //   f_grid         predefined frequency grid            [Hz]
-    //   abs_p          predefined pressure grid             [Pa]
-    //   abs_t          predefined temperature grid          [K]
-    //   vmr            H2O volume mixing ratio profile      [1]
-    //
-    // WWW resource: ftp.aer.com/aer_contnm_ckd
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_mt_250_self_h2o(
-          pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_mt_250_self_h2o(
-          pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD24_H20(pxsec,
+              1,
+              parameters[0],
+              model,
+              f_grid,
+              abs_p,
+              abs_t,
+              vmr,
+              abs_n2,
+              verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD24_H20(
+        pxsec, 1, 0, model, f_grid, abs_p, abs_t, vmr, abs_n2, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("H2O-ForeignContCKDMT252" == name) {
-    // OUTPUT:
-    //   pxsec           cross section (absorption/volume mixing ratio) of
-    //                  H2O foreign continuum according to CKD MT 2.50    [1/m]
-    // INPUT:
-    //   parameters[0]  strength scaling factor              [1]
-    //   model          allows user defined input parameter set
-    //                  (Cin) or choice of
-    //                  pre-defined parameters of specific models (see note below).
-    //   f_grid         predefined frequency grid            [Hz]
-    //   abs_p          predefined pressure grid             [Pa]
-    //   abs_t          predefined temperature grid          [K]
-    //   vmr            H2O volume mixing ratio profile      [1]
-    //
-    // WWW resource: ftp.aer.com/aer_contnm_ckd
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_mt_250_foreign_h2o(
-          pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_mt_250_foreign_h2o(
-          pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+}
+
+// ============= H2O full models ======================================================
+static void pxsec_H2O_CP98(MatrixView pxsec,
+                           const String &name,
+                           ConstVectorView parameters,
+                           const String &model,
+                           ConstVectorView f_grid,
+                           ConstVectorView abs_p,
+                           ConstVectorView abs_t,
+                           ConstVectorView,
+                           ConstVectorView,
+                           ConstVectorView,
+                           ConstVectorView vmr,
+                           const Verbosity &verbosity) {
+  CREATE_OUT3;
+  //
+  // specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum scale factor       (CC) [1]
+  //     parameters[1] : line strength scale factor   (CL) [1]
+  //     parameters[2] : line broadening scale factor (CW) [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  const int Nparam = 3;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Full model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CP98H2OAbsModel(pxsec,
+                    parameters[0],
+                    parameters[1],
+                    parameters[2],
+                    model,
+                    f_grid,
+                    abs_p,
+                    abs_t,
+                    vmr,
+                    verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Full model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Full model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CP98H2OAbsModel(
+        pxsec, 0.00, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Full model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
+}
 
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("H2O-SelfContCKDMT320" == name) {
-    // OUTPUT:
-    //   pxsec           cross section (absorption/volume mixing ratio) of
-    //                  H2O self continuum according to CKD MT 2.50    [1/m]
-    // INPUT:
-    //   parameters[0]  strength scaling factor              [1]
-    //   model          allows user defined input parameter set
-    //                  (Cin) or choice of
-    //                  pre-defined parameters of specific models (see note below).
-    //   f_grid         predefined frequency grid            [Hz]
-    //   abs_p          predefined pressure grid             [Pa]
-    //   abs_t          predefined temperature grid          [K]
-    //   vmr            H2O volume mixing ratio profile      [1]
-    //
-    // WWW resource: ftp.aer.com/aer_contnm_ckd
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_mt_320_self_h2o(
-          pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_mt_320_self_h2o(
-          pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_H2O_MPM87(MatrixView pxsec,
+                            const String &name,
+                            ConstVectorView parameters,
+                            const String &model,
+                            ConstVectorView f_grid,
+                            ConstVectorView abs_p,
+                            ConstVectorView abs_t,
+                            ConstVectorView,
+                            ConstVectorView,
+                            ConstVectorView,
+                            ConstVectorView vmr,
+                            const Verbosity &verbosity) {
+  CREATE_OUT3;
+  //
+  // specific continuum parameters and units:
+  //  a) output
+  //     pxsec          : [1/m],
+  //  b) input
+  //     parameters[0] : continuum scale factor (CC)       [1]
+  //     parameters[1] : line strength scale factor   (CL) [1]
+  //     parameters[2] : line broadening scale factor (CW) [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  const int Nparam = 3;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Full model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    MPM87H2OAbsModel(pxsec,
+                     parameters[0],
+                     parameters[1],
+                     parameters[2],
+                     model,
+                     f_grid,
+                     abs_p,
+                     abs_t,
+                     vmr,
+                     verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Full model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Full model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    MPM87H2OAbsModel(
+        pxsec, 0.00, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Full model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_H2O_MPM89(MatrixView pxsec,
+                            const String &name,
+                            ConstVectorView parameters,
+                            const String &model,
+                            ConstVectorView f_grid,
+                            ConstVectorView abs_p,
+                            ConstVectorView abs_t,
+                            ConstVectorView,
+                            ConstVectorView,
+                            ConstVectorView,
+                            ConstVectorView vmr,
+                            const Verbosity &verbosity) {
+  CREATE_OUT3;
+  //
+  // specific continuum parameters and units:
+  //  a) output
+  //     pxsec          : [1/m],
+  //  b) input
+  //     parameters[0] : continuum scale factor       (CC) [1]
+  //     parameters[1] : line strength scale factor   (CL) [1]
+  //     parameters[2] : line broadening scale factor (CW  [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  const int Nparam = 3;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Full model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    MPM89H2OAbsModel(pxsec,
+                     parameters[0],
+                     parameters[1],
+                     parameters[2],
+                     model,
+                     f_grid,
+                     abs_p,
+                     abs_t,
+                     vmr,
+                     verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Full model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Full model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    MPM89H2OAbsModel(
+        pxsec, 0.00, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Full model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_H2O_MPM93(MatrixView pxsec,
+                            const String &name,
+                            ConstVectorView parameters,
+                            const String &model,
+                            ConstVectorView f_grid,
+                            ConstVectorView abs_p,
+                            ConstVectorView abs_t,
+                            ConstVectorView,
+                            ConstVectorView,
+                            ConstVectorView,
+                            ConstVectorView vmr,
+                            const Verbosity &verbosity) {
+  CREATE_OUT3;
+  //
+  // specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum scale factor       (CC) [1]
+  //     parameters[1] : line strength scale factor   (CL) [1]
+  //     parameters[2] : line broadening scale factor (CW) [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  const int Nparam = 3;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Full model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    MPM93H2OAbsModel(pxsec,
+                     parameters[0],
+                     parameters[1],
+                     parameters[2],
+                     model,
+                     f_grid,
+                     abs_p,
+                     abs_t,
+                     vmr,
+                     verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Full model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Full model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    MPM93H2OAbsModel(
+        pxsec, 0.00, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Full model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_H2O_PWR98(MatrixView pxsec,
+                            const String &name,
+                            ConstVectorView parameters,
+                            const String &model,
+                            ConstVectorView f_grid,
+                            ConstVectorView abs_p,
+                            ConstVectorView abs_t,
+                            ConstVectorView,
+                            ConstVectorView,
+                            ConstVectorView,
+                            ConstVectorView vmr,
+                            const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum scale factor       (CC) [1]
+  //     parameters[1] : line strength scale factor   (CL) [1]
+  //     parameters[2] : line broadening scale factor (CW) [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  const int Nparam = 3;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Full model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    PWR98H2OAbsModel(pxsec,
+                     parameters[0],
+                     parameters[1],
+                     parameters[2],
+                     model,
+                     f_grid,
+                     abs_p,
+                     abs_t,
+                     vmr,
+                     verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Full model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Full model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    PWR98H2OAbsModel(
+        pxsec, 0.00, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Full model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
+
+// ============= O2 continuum =========================================================
+static void pxsec_O2_CIAfunCKDMT100(MatrixView pxsec,
+                                    const String &name,
+                                    ConstVectorView parameters,
+                                    const String &model,
+                                    ConstVectorView f_grid,
+                                    ConstVectorView abs_p,
+                                    ConstVectorView abs_t,
+                                    ConstVectorView,
+                                    ConstVectorView,
+                                    ConstVectorView,
+                                    ConstVectorView vmr,
+                                    const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // Model reference:
+  // F. Thibault, V. Menoux, R. Le Doucen, L. Rosenman,
+  // J.-M. Hartmann, Ch. Boulet,
+  // "Infrared collision-induced absorption by O2 near 6.4 microns for
+  // atmospheric applications: measurements and emprirical modeling",
+  // Appl. Optics, 35, 5911-5917, (1996).
+  //
+  //  specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum scaling
+  //     model         : model option ("CKD" or "user")
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_mt_CIAfun_o2(
+        pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_mt_CIAfun_o2(
+        pxsec, 0.00e0, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_O2_v0v0CKDMT100(MatrixView pxsec,
+                                  const String &name,
+                                  ConstVectorView parameters,
+                                  const String &model,
+                                  ConstVectorView f_grid,
+                                  ConstVectorView abs_p,
+                                  ConstVectorView abs_t,
+                                  ConstVectorView abs_n2,
+                                  ConstVectorView,
+                                  ConstVectorView,
+                                  ConstVectorView vmr,
+                                  const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // Model reference:
+  //   B. Mate, C. Lugez, G.T. Fraser, W.J. Lafferty,
+  //   "Absolute Intensities for the O2 1.27 micron
+  //   continuum absorption",
+  //   J. Geophys. Res., 104, 30,585-30,590, 1999.
+  //
+  //  specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum scaling
+  //     model         : model option ("CKD" or "user")
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //     abs_n2        : [1]
+  //
+
+  if (abs_n2.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires N2-vmr, but no tag group contains N2!";
+    throw runtime_error(os.str());
+  }
+
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_mt_v0v0_o2(pxsec,
+                   parameters[0],
+                   model,
+                   f_grid,
+                   abs_p,
+                   abs_t,
+                   vmr,
+                   abs_n2,
+                   verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_mt_v0v0_o2(
+        pxsec, 0.0e0, model, f_grid, abs_p, abs_t, vmr, abs_n2, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_O2_v1v0CKDMT100(MatrixView pxsec,
+                                  const String &name,
+                                  ConstVectorView parameters,
+                                  const String &model,
+                                  ConstVectorView f_grid,
+                                  ConstVectorView abs_p,
+                                  ConstVectorView abs_t,
+                                  ConstVectorView,
+                                  ConstVectorView,
+                                  ConstVectorView,
+                                  ConstVectorView vmr,
+                                  const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // Model reference:
+  //   Mlawer, Clough, Brown, Stephen, Landry, Goldman, Murcray,
+  //   "Observed  Atmospheric Collision Induced Absorption in Near Infrared Oxygen Bands",
+  //   Journal of Geophysical Research, vol 103, no. D4, pp. 3859-3863, 1998.
+  //
+  //  specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum scaling
+  //     model         : model option ("CKD" or "user")
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_mt_v1v0_o2(
+        pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_mt_v1v0_o2(pxsec, 0.0e0, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the ARTS User Guide.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("H2O-ForeignContCKDMT320" == name) {
-    // OUTPUT:
-    //   pxsec           cross section (absorption/volume mixing ratio) of
-    //                  H2O foreign continuum according to CKD MT 2.50    [1/m]
-    // INPUT:
-    //   parameters[0]  strength scaling factor              [1]
-    //   model          allows user defined input parameter set
-    //                  (Cin) or choice of
-    //                  pre-defined parameters of specific models (see note below).
-    //   f_grid         predefined frequency grid            [Hz]
-    //   abs_p          predefined pressure grid             [Pa]
-    //   abs_t          predefined temperature grid          [K]
-    //   vmr            H2O volume mixing ratio profile      [1]
-    //
-    // WWW resource: ftp.aer.com/aer_contnm_ckd
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_mt_320_foreign_h2o(
-          pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_mt_320_foreign_h2o(
-          pxsec, 0.000, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_O2_visCKDMT252(MatrixView pxsec,
+                                 const String &name,
+                                 ConstVectorView parameters,
+                                 const String &model,
+                                 ConstVectorView f_grid,
+                                 ConstVectorView abs_p,
+                                 ConstVectorView abs_t,
+                                 ConstVectorView,
+                                 ConstVectorView,
+                                 ConstVectorView,
+                                 ConstVectorView vmr,
+                                 const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // Model reference:
+  //     O2 continuum formulated by Greenblatt et al. over the spectral region
+  //     8797-29870 cm-1:  "Absorption Coefficients of Oxygen Between
+  //     330 and 1140 nm, G.D. Green blatt, J.J. Orlando, J.B. Burkholder,
+  //     and A.R. Ravishabkara,  J. Geophys. Res., 95, 18577-18582, 1990.
+  //
+  //  specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum scaling
+  //     model         : model option ("CKD" or "user")
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_mt_250_o2_vis(
+        pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_mt_250_o2_vis(
+        pxsec, 0.0e0, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
+}
 
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-
-  else if ("H2O-SelfContCKD24" == name) {
-    // OUTPUT:
-    //   pxsec           cross section (absorption/volume mixing ratio) of
-    //                  H2O continuum according to CKD2.4    [1/m]
-    // INPUT:
-    //   parameters[0]  strength scaling factor              [1]
-    //   model          allows user defined input parameter set
-    //                  (Cin) or choice of
-    //                  pre-defined parameters of specific models (see note below).
-    //   f_grid         predefined frequency grid            [Hz]
-    //   abs_p          predefined pressure grid             [Pa]
-    //   abs_t          predefined temperature grid          [K]
-    //   abs_n2         N2 volume mixing ratio profile       [1]
-    //   vmr            H2O volume mixing ratio profile      [1]
-    //
-    // WWW resource: ftp.aer.com/aer_contnm_ckd
-
-    // abs_n2 needed here. check, whether this is valid.
-    if (abs_n2.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires N2-vmr, but no tag group contains N2!";
-      throw runtime_error(os.str());
-    }
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_O2_SelfContStandardType(MatrixView pxsec,
+                                          const String &name,
+                                          ConstVectorView parameters,
+                                          const String &model,
+                                          ConstVectorView f_grid,
+                                          ConstVectorView abs_p,
+                                          ConstVectorView abs_t,
+                                          ConstVectorView,
+                                          ConstVectorView abs_h2o,
+                                          ConstVectorView,
+                                          ConstVectorView vmr,
+                                          const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // MPM93, Rosenkranz 1993 O2 continuum:
+  // see publication side of National Telecommunications and Information Administration
+  //   http://www.its.bldrdoc.gov/pub/all_pubs/all_pubs.html
+  // and ftp side for downloading the MPM93 original source code:
+  //   ftp://ftp.its.bldrdoc.gov/pub/mpm93/
+  //
+  // P. W. Rosenkranz Chapter 2, pp 74, in M. A. Janssen,
+  // "Atmospheric Remote Sensing by Microwave Radiometry",
+  // John Wiley & Sons, Inc., 1993, ISBN 0-471-62891-3
+  // (see also JQSRT, Vol.48, No.5/6 pp.629-643, 1992)
+  //
+  //  specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum coefficient (C)    [1/m*1/Hz*1/Pa]
+  //     parameters[1] : frequency coefficient (G0)   [Hz/Pa]
+  //     parameters[3] : line width parameter  (G0A)  [1]
+  //     parameters[3] : line width parameter  (G0B)  [1]
+  //     parameters[2] : temperature exponent  (XG0d) [1]
+  //     parameters[2] : temperature exponent  (x_s)  [1]
+  //     parameters[5] : continuum coefficient (XG0w) [1]
+  //     model   : model option ("MPM93", "Rosenkranz", or "user")
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     abs_h2o       : [1]
+  //     vmr           : [1]
+  //
 
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD24_H20(pxsec,
-                0,
-                parameters[0],
-                model,
-                f_grid,
-                abs_p,
-                abs_t,
-                vmr,
-                abs_n2,
-                verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD24_H20(
-          pxsec, 0, 0.000, model, f_grid, abs_p, abs_t, vmr, abs_n2, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+  if (abs_h2o.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires H2O-vmr, but no tag group contains H2O!";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("H2O-ForeignContCKD24" == name) {
-    // OUTPUT:
-    //   pxsec             cross section (absorption/volume mixing ratio) of
-    //                    H2O continuum according to CKD2.4    [1/m]
-    // INPUT:
-    //   Cin            strength scaling factor              [1]
-    //   model          allows user defined input parameter set
-    //                  (Cin) or choice of
-    //                  pre-defined parameters of specific models (see note below).
-    //   f_grid         predefined frequency grid            [Hz]
-    //   abs_p          predefined pressure grid             [Pa]
-    //   abs_t          predefined temperature grid          [K]
-    //   vmr            H2O volume mixing ratio profile      [1]
-    //   abs_n2         N2 volume mixing ratio profile       [1]
-    //
-    // WWW resource: ftp.aer.com/aer_contnm_ckd
-
-    if (abs_n2.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires N2-vmr, but no tag group contains N2!";
-      throw runtime_error(os.str());
-    }
 
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD24_H20(pxsec,
-                1,
-                parameters[0],
-                model,
-                f_grid,
-                abs_p,
-                abs_t,
-                vmr,
-                abs_n2,
-                verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD24_H20(
-          pxsec, 1, 0, model, f_grid, abs_p, abs_t, vmr, abs_n2, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
-  }
-  // ============= H2O full models ======================================================
-  else if ("H2O-CP98" == name) {
-    //
-    // specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum scale factor       (CC) [1]
-    //     parameters[1] : line strength scale factor   (CL) [1]
-    //     parameters[2] : line broadening scale factor (CW) [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    const int Nparam = 3;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Full model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CP98H2OAbsModel(pxsec,
-                      parameters[0],
-                      parameters[1],
-                      parameters[2],
-                      model,
-                      f_grid,
-                      abs_p,
-                      abs_t,
-                      vmr,
-                      verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Full model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Full model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CP98H2OAbsModel(
-          pxsec, 0.00, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Full model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
-  }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("H2O-MPM87" == name) {
-    //
-    // specific continuum parameters and units:
-    //  a) output
-    //     pxsec          : [1/m],
-    //  b) input
-    //     parameters[0] : continuum scale factor (CC)       [1]
-    //     parameters[1] : line strength scale factor   (CL) [1]
-    //     parameters[2] : line broadening scale factor (CW) [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    const int Nparam = 3;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Full model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      MPM87H2OAbsModel(pxsec,
-                       parameters[0],
-                       parameters[1],
-                       parameters[2],
-                       model,
-                       f_grid,
-                       abs_p,
-                       abs_t,
-                       vmr,
-                       verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Full model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Full model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      MPM87H2OAbsModel(
-          pxsec, 0.00, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Full model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+  const int Nparam = 6;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    Standard_O2_continuum(pxsec,
+                          parameters[0],
+                          parameters[1],
+                          parameters[2],
+                          parameters[3],
+                          parameters[4],
+                          parameters[5],
+                          model,
+                          f_grid,
+                          abs_p,
+                          abs_t,
+                          abs_h2o,
+                          vmr,
+                          verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    Standard_O2_continuum(pxsec,
+                          0.00,
+                          0.00,
+                          0.00,
+                          0.00,
+                          0.00,
+                          0.00,
+                          model,
+                          f_grid,
+                          abs_p,
+                          abs_t,
+                          abs_h2o,
+                          vmr,
+                          verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("H2O-MPM89" == name) {
-    //
-    // specific continuum parameters and units:
-    //  a) output
-    //     pxsec          : [1/m],
-    //  b) input
-    //     parameters[0] : continuum scale factor       (CC) [1]
-    //     parameters[1] : line strength scale factor   (CL) [1]
-    //     parameters[2] : line broadening scale factor (CW  [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    const int Nparam = 3;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Full model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      MPM89H2OAbsModel(pxsec,
-                       parameters[0],
-                       parameters[1],
-                       parameters[2],
-                       model,
-                       f_grid,
-                       abs_p,
-                       abs_t,
-                       vmr,
-                       verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Full model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Full model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      MPM89H2OAbsModel(
-          pxsec, 0.00, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Full model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_O2_SelfContMPM93(MatrixView pxsec,
+                                   const String &name,
+                                   ConstVectorView parameters,
+                                   const String &model,
+                                   ConstVectorView f_grid,
+                                   ConstVectorView abs_p,
+                                   ConstVectorView abs_t,
+                                   ConstVectorView,
+                                   ConstVectorView abs_h2o,
+                                   ConstVectorView,
+                                   ConstVectorView vmr,
+                                   const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // MPM93 O2 continuum:
+  // see publication side of National Telecommunications and Information Administration
+  //   http://www.its.bldrdoc.gov/pub/all_pubs/all_pubs.html
+  // and ftp side for downloading the MPM93 original source code:
+  //   ftp://ftp.its.bldrdoc.gov/pub/mpm93/
+
+  //
+  //  specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum coefficient (C)    [1/m / (Hz*Pa)]
+  //     parameters[1] : temperature exponent  (x_s)  [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     abs_h2o       : [1]
+  //     vmr           : [1]
+  //
+
+  if (abs_h2o.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires H2O-vmr, but no tag group contains H2O!";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("H2O-MPM93" == name) {
-    //
-    // specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum scale factor       (CC) [1]
-    //     parameters[1] : line strength scale factor   (CL) [1]
-    //     parameters[2] : line broadening scale factor (CW) [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    const int Nparam = 3;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Full model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      MPM93H2OAbsModel(pxsec,
+
+  const int Nparam = 4;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    MPM93_O2_continuum(pxsec,
                        parameters[0],
                        parameters[1],
                        parameters[2],
+                       parameters[3],
                        model,
                        f_grid,
                        abs_p,
                        abs_t,
+                       abs_h2o,
                        vmr,
                        verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Full model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Full model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      MPM93H2OAbsModel(
-          pxsec, 0.00, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Full model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
-  }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("H2O-PWR98" == name) {
-    // specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum scale factor       (CC) [1]
-    //     parameters[1] : line strength scale factor   (CL) [1]
-    //     parameters[2] : line broadening scale factor (CW) [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    const int Nparam = 3;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Full model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      PWR98H2OAbsModel(pxsec,
-                       parameters[0],
-                       parameters[1],
-                       parameters[2],
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    MPM93_O2_continuum(pxsec,
+                       0.00,
+                       0.00,
+                       0.00,
+                       0.00,
                        model,
                        f_grid,
                        abs_p,
                        abs_t,
+                       abs_h2o,
                        vmr,
                        verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Full model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Full model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      PWR98H2OAbsModel(
-          pxsec, 0.00, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Full model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
-  }
-  // ============= O2 continuum =========================================================
-  else if ("O2-CIAfunCKDMT100" == name) {
-    // Model reference:
-    // F. Thibault, V. Menoux, R. Le Doucen, L. Rosenman,
-    // J.-M. Hartmann, Ch. Boulet,
-    // "Infrared collision-induced absorption by O2 near 6.4 microns for
-    // atmospheric applications: measurements and emprirical modeling",
-    // Appl. Optics, 35, 5911-5917, (1996).
-    //
-    //  specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum scaling
-    //     model         : model option ("CKD" or "user")
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_mt_CIAfun_o2(
-          pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_mt_CIAfun_o2(
-          pxsec, 0.00e0, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
-  }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("O2-v0v0CKDMT100" == name) {
-    // Model reference:
-    //   B. Mate, C. Lugez, G.T. Fraser, W.J. Lafferty,
-    //   "Absolute Intensities for the O2 1.27 micron
-    //   continuum absorption",
-    //   J. Geophys. Res., 104, 30,585-30,590, 1999.
-    //
-    //  specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum scaling
-    //     model         : model option ("CKD" or "user")
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //     abs_n2        : [1]
-    //
-
-    if (abs_n2.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires N2-vmr, but no tag group contains N2!";
-      throw runtime_error(os.str());
-    }
-
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_mt_v0v0_o2(pxsec,
-                     parameters[0],
-                     model,
-                     f_grid,
-                     abs_p,
-                     abs_t,
-                     vmr,
-                     abs_n2,
-                     verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_mt_v0v0_o2(
-          pxsec, 0.0e0, model, f_grid, abs_p, abs_t, vmr, abs_n2, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
-  }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("O2-v1v0CKDMT100" == name) {
-    // Model reference:
-    //   Mlawer, Clough, Brown, Stephen, Landry, Goldman, Murcray,
-    //   "Observed  Atmospheric Collision Induced Absorption in Near Infrared Oxygen Bands",
-    //   Journal of Geophysical Research, vol 103, no. D4, pp. 3859-3863, 1998.
-    //
-    //  specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum scaling
-    //     model         : model option ("CKD" or "user")
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_mt_v1v0_o2(
-          pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_mt_v1v0_o2(pxsec, 0.0e0, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the ARTS User Guide.\n";
-      throw runtime_error(os.str());
-    }
-  }
-
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("O2-visCKDMT252" == name) {
-    // Model reference:
-    //     O2 continuum formulated by Greenblatt et al. over the spectral region
-    //     8797-29870 cm-1:  "Absorption Coefficients of Oxygen Between
-    //     330 and 1140 nm, G.D. Green blatt, J.J. Orlando, J.B. Burkholder,
-    //     and A.R. Ravishabkara,  J. Geophys. Res., 95, 18577-18582, 1990.
-    //
-    //  specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum scaling
-    //     model         : model option ("CKD" or "user")
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_mt_250_o2_vis(
-          pxsec, parameters[0], model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_mt_250_o2_vis(
-          pxsec, 0.0e0, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
+}
 
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-
-  else if ("O2-SelfContStandardType" == name) {
-    // MPM93, Rosenkranz 1993 O2 continuum:
-    // see publication side of National Telecommunications and Information Administration
-    //   http://www.its.bldrdoc.gov/pub/all_pubs/all_pubs.html
-    // and ftp side for downloading the MPM93 original source code:
-    //   ftp://ftp.its.bldrdoc.gov/pub/mpm93/
-    //
-    // P. W. Rosenkranz Chapter 2, pp 74, in M. A. Janssen,
-    // "Atmospheric Remote Sensing by Microwave Radiometry",
-    // John Wiley & Sons, Inc., 1993, ISBN 0-471-62891-3
-    // (see also JQSRT, Vol.48, No.5/6 pp.629-643, 1992)
-    //
-    //  specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum coefficient (C)    [1/m*1/Hz*1/Pa]
-    //     parameters[1] : frequency coefficient (G0)   [Hz/Pa]
-    //     parameters[3] : line width parameter  (G0A)  [1]
-    //     parameters[3] : line width parameter  (G0B)  [1]
-    //     parameters[2] : temperature exponent  (XG0d) [1]
-    //     parameters[2] : temperature exponent  (x_s)  [1]
-    //     parameters[5] : continuum coefficient (XG0w) [1]
-    //     model   : model option ("MPM93", "Rosenkranz", or "user")
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     abs_h2o       : [1]
-    //     vmr           : [1]
-    //
-
-    if (abs_h2o.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires H2O-vmr, but no tag group contains H2O!";
-      throw runtime_error(os.str());
-    }
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_O2_SelfContPWR93(MatrixView pxsec,
+                                   const String &name,
+                                   ConstVectorView parameters,
+                                   const String &model,
+                                   ConstVectorView f_grid,
+                                   ConstVectorView abs_p,
+                                   ConstVectorView abs_t,
+                                   ConstVectorView,
+                                   ConstVectorView abs_h2o,
+                                   ConstVectorView,
+                                   ConstVectorView vmr,
+                                   const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // data information about this continuum:
+  // P. W. Rosenkranz Chapter 2, pp 74, in M. A. Janssen,
+  // "Atmospheric Remote Sensing by Microwave Radiometry",
+  // John Wiley & Sons, Inc., 1993, ISBN 0-471-62891-3
+  // (see also JQSRT, Vol.48, No.5/6 pp.629-643, 1992)
+  //
+  //  specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum coefficient (C) [K/(Hz*Pa*m)]
+  //     parameters[1] : temperature exponent  (x) [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
 
-    const int Nparam = 6;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      Standard_O2_continuum(pxsec,
+  if (abs_h2o.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires H2O-vmr, but no tag group contains H2O!";
+    throw runtime_error(os.str());
+  }
+
+  const int Nparam = 4;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    Rosenkranz_O2_continuum(pxsec,
                             parameters[0],
                             parameters[1],
                             parameters[2],
                             parameters[3],
-                            parameters[4],
-                            parameters[5],
                             model,
                             f_grid,
                             abs_p,
@@ -17939,22 +18459,20 @@ void xsec_continuum_tag(MatrixView xsec,
                             abs_h2o,
                             vmr,
                             verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      Standard_O2_continuum(pxsec,
-                            0.00,
-                            0.00,
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    Rosenkranz_O2_continuum(pxsec,
                             0.00,
                             0.00,
                             0.00,
@@ -17966,2252 +18484,2256 @@ void xsec_continuum_tag(MatrixView xsec,
                             abs_h2o,
                             vmr,
                             verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("O2-SelfContMPM93" == name) {
-    // MPM93 O2 continuum:
-    // see publication side of National Telecommunications and Information Administration
-    //   http://www.its.bldrdoc.gov/pub/all_pubs/all_pubs.html
-    // and ftp side for downloading the MPM93 original source code:
-    //   ftp://ftp.its.bldrdoc.gov/pub/mpm93/
-
-    //
-    //  specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum coefficient (C)    [1/m / (Hz*Pa)]
-    //     parameters[1] : temperature exponent  (x_s)  [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     abs_h2o       : [1]
-    //     vmr           : [1]
-    //
-
-    if (abs_h2o.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires H2O-vmr, but no tag group contains H2O!";
-      throw runtime_error(os.str());
-    }
+}
 
-    const int Nparam = 4;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      MPM93_O2_continuum(pxsec,
-                         parameters[0],
-                         parameters[1],
-                         parameters[2],
-                         parameters[3],
-                         model,
-                         f_grid,
-                         abs_p,
-                         abs_t,
-                         abs_h2o,
-                         vmr,
-                         verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      MPM93_O2_continuum(pxsec,
-                         0.00,
-                         0.00,
-                         0.00,
-                         0.00,
-                         model,
-                         f_grid,
-                         abs_p,
-                         abs_t,
-                         abs_h2o,
-                         vmr,
-                         verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+// ============= O2 full model ========================================================
+static void pxsec_O2_PWR88(MatrixView pxsec,
+                           const String &name,
+                           ConstVectorView parameters,
+                           const String &model,
+                           ConstVectorView f_grid,
+                           ConstVectorView abs_p,
+                           ConstVectorView abs_t,
+                           ConstVectorView,
+                           ConstVectorView abs_h2o,
+                           ConstVectorView,
+                           ConstVectorView vmr,
+                           const Verbosity &verbosity) {
+  CREATE_OUT3;
+  //  REFERENCE FOR EQUATIONS AND COEFFICIENTS:
+  //  P.W. ROSENKRANZ, CHAP. 2 AND APPENDIX, IN ATMOSPHERIC REMOTE SENSING
+  //  BY MICROWAVE RADIOMETRY (M.A. JANSSEN, ED. 1993)
+  //  AND
+  //  H.J. LIEBE ET AL, JQSRT V.48, PP.629-643 (1992)
+  //  (EXCEPT: SUBMILLIMETER LINE INTENSITIES FROM HITRAN92)
+  //  AND
+  //  P. W. ROSENKRANZ, INTERFERENCE COEFFICIENTS FOR THE
+  //  OVERLAPPING OXYGEN LINES IN AIR, JQSRT, 1988, VOLUME 39, 287-297.
+  //
+  //  the only difference to the 1993 version is the line mixing
+  //  parameter Y, which is taken from the above reference JQSRT, 1988.
+  //
+  //  specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum term scale factor,   default CC = 1.000 [1]
+  //     parameters[1] : line strength scale factor,    default CL = 1.000 [1]
+  //     parameters[1] : line broadening scale factor,  default CW = 1.000 [1]
+  //     parameters[1] : line coupling scale factor,    default CO = 1.000 [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     abs_h2o,      : [1]
+  //     vmr           : [1]
+  //
+
+  if (abs_h2o.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires H2O-vmr, but no tag group contains H2O!";
+    throw runtime_error(os.str());
+  }
+
+  const int Nparam = 4;
+  const char *version = "PWR88";
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Full model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    PWR93O2AbsModel(pxsec,
+                    parameters[0],  // continuum term scale factor
+                    parameters[1],  // line strength scale factor
+                    parameters[2],  // line broadening scale factor
+                    parameters[3],  // line coupling scale factor
+                    model,
+                    version,
+                    f_grid,
+                    abs_p,
+                    abs_t,
+                    abs_h2o,
+                    vmr,
+                    verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Full model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Full model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    PWR93O2AbsModel(pxsec,
+                    0.00,
+                    0.00,
+                    0.00,
+                    0.00,
+                    model,
+                    version,
+                    f_grid,
+                    abs_p,
+                    abs_t,
+                    abs_h2o,
+                    vmr,
+                    verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Full model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_O2_PWR93(MatrixView pxsec,
+                           const String &name,
+                           ConstVectorView parameters,
+                           const String &model,
+                           ConstVectorView f_grid,
+                           ConstVectorView abs_p,
+                           ConstVectorView abs_t,
+                           ConstVectorView,
+                           ConstVectorView abs_h2o,
+                           ConstVectorView,
+                           ConstVectorView vmr,
+                           const Verbosity &verbosity) {
+  CREATE_OUT3;
+  //  REFERENCE FOR EQUATIONS AND COEFFICIENTS:
+  //  P.W. ROSENKRANZ, CHAP. 2 AND APPENDIX, IN ATMOSPHERIC REMOTE SENSING
+  //  BY MICROWAVE RADIOMETRY (M.A. JANSSEN, ED. 1993)
+  //  AND H.J. LIEBE ET AL, JQSRT V.48, PP.629-643 (1992)
+  //  (EXCEPT: SUBMILLIMETER LINE INTENSITIES FROM HITRAN92)
+  //
+  //  specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum term scale factor,   default CC = 1.000 [1]
+  //     parameters[1] : line strength scale factor,    default CL = 1.000 [1]
+  //     parameters[1] : line broadening scale factor,  default CW = 1.000 [1]
+  //     parameters[1] : line coupling scale factor,    default CO = 1.000 [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     abs_h2o,      : [1]
+  //     vmr           : [1]
+  //
+
+  if (abs_h2o.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires H2O-vmr, but no tag group contains H2O!";
+    throw runtime_error(os.str());
+  }
+
+  const int Nparam = 4;
+  const char *version = "PWR93";
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Full model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    PWR93O2AbsModel(pxsec,
+                    parameters[0],  // continuum term scale factor
+                    parameters[1],  // line strength scale factor
+                    parameters[2],  // line broadening scale factor
+                    parameters[3],  // line coupling scale factor
+                    model,
+                    version,
+                    f_grid,
+                    abs_p,
+                    abs_t,
+                    abs_h2o,
+                    vmr,
+                    verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Full model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Full model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    PWR93O2AbsModel(pxsec,
+                    0.00,
+                    0.00,
+                    0.00,
+                    0.00,
+                    model,
+                    version,
+                    f_grid,
+                    abs_p,
+                    abs_t,
+                    abs_h2o,
+                    vmr,
+                    verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Full model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_O2_PWR98(MatrixView pxsec,
+                           const String &name,
+                           ConstVectorView parameters,
+                           const String &model,
+                           ConstVectorView f_grid,
+                           ConstVectorView abs_p,
+                           ConstVectorView abs_t,
+                           ConstVectorView,
+                           ConstVectorView abs_h2o,
+                           ConstVectorView,
+                           ConstVectorView vmr,
+                           const Verbosity &verbosity) {
+  CREATE_OUT3;
+  //  REFERENCES FOR EQUATIONS AND COEFFICIENTS:
+  //    P.W. Rosenkranz, CHAP. 2 and appendix, in ATMOSPHERIC REMOTE SENSING
+  //     BY MICROWAVE RADIOMETRY (M.A. Janssen, ed., 1993).
+  //    H.J. Liebe et al, JQSRT V.48, PP.629-643 (1992).
+  //    M.J. Schwartz, Ph.D. thesis, M.I.T. (1997).
+  //    SUBMILLIMETER LINE INTENSITIES FROM HITRAN96.
+  //    This version differs from Liebe's MPM92 in two significant respects:
+  //    1. It uses the modification of the 1- line width temperature dependence
+  //    recommended by Schwartz: (1/T).
+  //    2. It uses the same temperature dependence (X) for submillimeter
+  //    line widths as in the 60 GHz band: (1/T)**0.8
+  //
+  //  specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum term scale factor,   default CC = 1.000 [1]
+  //     parameters[1] : line strength scale factor,    default CL = 1.000 [1]
+  //     parameters[1] : line broadening scale factor,  default CW = 1.000 [1]
+  //     parameters[1] : line coupling scale factor,    default CO = 1.000 [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     abs_h2o,      : [1]
+  //     vmr           : [1]
+  //
+
+  // abs_h2o needed here. check, whether this is valid.
+  if (abs_h2o.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires H2O-vmr, but no tag group contains H2O!";
+    throw runtime_error(os.str());
+  }
+
+  const int Nparam = 4;
+  const char *version = "PWR98";
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Full model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    PWR93O2AbsModel(pxsec,
+                    parameters[0],  // continuum term scale factor
+                    parameters[1],  // line strength scale factor
+                    parameters[2],  // line broadening scale factor
+                    parameters[3],  // line coupling scale factor
+                    model,
+                    version,
+                    f_grid,
+                    abs_p,
+                    abs_t,
+                    abs_h2o,
+                    vmr,
+                    verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Full model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Full model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    PWR93O2AbsModel(pxsec,
+                    0.00,
+                    0.00,
+                    0.00,
+                    0.00,
+                    model,
+                    version,
+                    f_grid,
+                    abs_p,
+                    abs_t,
+                    abs_h2o,
+                    vmr,
+                    verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Full model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_O2_MPM93(MatrixView pxsec,
+                           const String &name,
+                           ConstVectorView parameters,
+                           const String &model,
+                           ConstVectorView f_grid,
+                           ConstVectorView abs_p,
+                           ConstVectorView abs_t,
+                           ConstVectorView,
+                           ConstVectorView abs_h2o,
+                           ConstVectorView,
+                           ConstVectorView vmr,
+                           const Verbosity &verbosity) {
+  CREATE_OUT3;
+  //  H. J. Liebe and G. A. Hufford and M. G. Cotton,
+  //  "Propagation modeling of moist air and suspended water/ice
+  //   particles at frequencies below 1000 GHz",
+  //  AGARD 52nd Specialists Meeting of the Electromagnetic Wave
+  //  Propagation Panel, Palma de Mallorca, Spain, 1993, May 17-21
+  //
+  //  specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum term scale factor,   default CC = 1.000 [1]
+  //     parameters[1] : line strength scale factor,    default CL = 1.000 [1]
+  //     parameters[2] : line broadening scale factor,  default CW = 1.000 [1]
+  //     parameters[3] : line coupling scale factor,    default CO = 1.000 [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     abs_h2o,      : [1]
+  //     vmr           : [1]
+  //
+
+  if (abs_h2o.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires H2O-vmr, but no tag group contains H2O!";
+    throw runtime_error(os.str());
+  }
+
+  const int Nparam = 4;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Full model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    MPM93O2AbsModel(pxsec,
+                    parameters[0],  // continuum term scale factor
+                    parameters[1],  // line strength scale factor
+                    parameters[2],  // line broadening scale factor
+                    parameters[3],  // line coupling scale factor
+                    model,
+                    f_grid,
+                    abs_p,
+                    abs_t,
+                    abs_h2o,
+                    vmr,
+                    verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Full model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Full model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    MPM93O2AbsModel(pxsec,
+                    0.00,
+                    0.00,
+                    0.00,
+                    0.00,
+                    model,
+                    f_grid,
+                    abs_p,
+                    abs_t,
+                    abs_h2o,
+                    vmr,
+                    verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Full model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_O2_TRE05(MatrixView pxsec,
+                           const String &name,
+                           ConstVectorView parameters,
+                           const String &model,
+                           ConstVectorView f_grid,
+                           ConstVectorView abs_p,
+                           ConstVectorView abs_t,
+                           ConstVectorView,
+                           ConstVectorView abs_h2o,
+                           ConstVectorView,
+                           ConstVectorView vmr,
+                           const Verbosity &verbosity) {
+  CREATE_OUT3;
+  //  H. J. Liebe and G. A. Hufford and M. G. Cotton,
+  //  "Propagation modeling of moist air and suspended water/ice
+  //   particles at frequencies below 1000 GHz",
+  //  AGARD 52nd Specialists Meeting of the Electromagnetic Wave
+  //  Propagation Panel, Palma de Mallorca, Spain, 1993, May 17-21
+  //
+  //  specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum term scale factor,   default CC = 1.000 [1]
+  //     parameters[1] : line strength scale factor,    default CL = 1.000 [1]
+  //     parameters[2] : line broadening scale factor,  default CW = 1.000 [1]
+  //     parameters[3] : line coupling scale factor,    default CO = 1.000 [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     abs_h2o,      : [1]
+  //     vmr           : [1]
+  //
+
+  if (abs_h2o.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires H2O-vmr, but no tag group contains H2O!";
+    throw runtime_error(os.str());
+  }
+
+  const int Nparam = 4;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Full model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    TRE05O2AbsModel(pxsec,
+                    parameters[0],  // continuum term scale factor
+                    parameters[1],  // line strength scale factor
+                    parameters[2],  // line broadening scale factor
+                    parameters[3],  // line coupling scale factor
+                    model,
+                    f_grid,
+                    abs_p,
+                    abs_t,
+                    abs_h2o,
+                    vmr,
+                    verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Full model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Full model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    TRE05O2AbsModel(pxsec,
+                    0.00,
+                    0.00,
+                    0.00,
+                    0.00,
+                    model,
+                    f_grid,
+                    abs_p,
+                    abs_t,
+                    abs_h2o,
+                    vmr,
+                    verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Full model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_O2_MPM92(MatrixView pxsec,
+                           const String &name,
+                           ConstVectorView parameters,
+                           const String &model,
+                           ConstVectorView f_grid,
+                           ConstVectorView abs_p,
+                           ConstVectorView abs_t,
+                           ConstVectorView,
+                           ConstVectorView abs_h2o,
+                           ConstVectorView,
+                           ConstVectorView vmr,
+                           const Verbosity &verbosity) {
+  CREATE_OUT3;
+  //   H. J. Liebe, P. W. Rosenkranz and G. A. Hufford,
+  //   Atmospheric 60-GHz Oxygen Spectrum: New Laboratory
+  //   Measurements and Line Parameters
+  //   JQSRT, Vol 48, pp. 629-643, 1992
+  //
+  //  specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum term scale factor,   default CC = 1.000 [1]
+  //     parameters[1] : line strength scale factor,    default CL = 1.000 [1]
+  //     parameters[2] : line broadening scale factor,  default CW = 1.000 [1]
+  //     parameters[3] : line coupling scale factor,    default CO = 1.000 [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     abs_h2o,      : [1]
+  //     vmr           : [1]
+  //
+
+  if (abs_h2o.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires H2O-vmr, but no tag group contains H2O!";
+    throw runtime_error(os.str());
+  }
+
+  const int Nparam = 4;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Full model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    MPM92O2AbsModel(pxsec,
+                    parameters[0],  // continuum term scale factor
+                    parameters[1],  // line strength scale factor
+                    parameters[2],  // line broadening scale factor
+                    parameters[3],  // line coupling scale factor
+                    model,
+                    f_grid,
+                    abs_p,
+                    abs_t,
+                    abs_h2o,
+                    vmr,
+                    verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Full model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Full model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    MPM92O2AbsModel(pxsec,
+                    0.00,
+                    0.00,
+                    0.00,
+                    0.00,
+                    model,
+                    f_grid,
+                    abs_p,
+                    abs_t,
+                    abs_h2o,
+                    vmr,
+                    verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Full model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_O2_MPM89(MatrixView pxsec,
+                           const String &name,
+                           ConstVectorView parameters,
+                           const String &model,
+                           ConstVectorView f_grid,
+                           ConstVectorView abs_p,
+                           ConstVectorView abs_t,
+                           ConstVectorView,
+                           ConstVectorView abs_h2o,
+                           ConstVectorView,
+                           ConstVectorView vmr,
+                           const Verbosity &verbosity) {
+  CREATE_OUT3;
+  //   H. J. Liebe,
+  //   MPM - an atmospheric millimeter-wave propagation model,
+  //   Int. J. Infrared and Mill. Waves, Vol 10, pp. 631-650, 1989.
+  //
+  //  specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum term scale factor,   default CC = 1.000 [1]
+  //     parameters[1] : line strength scale factor,    default CL = 1.000 [1]
+  //     parameters[2] : line broadening scale factor,  default CW = 1.000 [1]
+  //     parameters[3] : line coupling scale factor,    default CO = 1.000 [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     abs_h2o,      : [1]
+  //     vmr           : [1]
+  //
+
+  if (abs_h2o.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires H2O-vmr, but no tag group contains H2O!";
+    throw runtime_error(os.str());
+  }
+
+  const int Nparam = 4;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Full model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    MPM89O2AbsModel(pxsec,
+                    parameters[0],  // continuum term scale factor
+                    parameters[1],  // line strength scale factor
+                    parameters[2],  // line broadening scale factor
+                    parameters[3],  // line coupling scale factor
+                    model,
+                    f_grid,
+                    abs_p,
+                    abs_t,
+                    abs_h2o,
+                    vmr,
+                    verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Full model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Full model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    MPM89O2AbsModel(pxsec,
+                    0.00,
+                    0.00,
+                    0.00,
+                    0.00,
+                    model,
+                    f_grid,
+                    abs_p,
+                    abs_t,
+                    abs_h2o,
+                    vmr,
+                    verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Full model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_O2_MPM87(MatrixView pxsec,
+                           const String &name,
+                           ConstVectorView parameters,
+                           const String &model,
+                           ConstVectorView f_grid,
+                           ConstVectorView abs_p,
+                           ConstVectorView abs_t,
+                           ConstVectorView,
+                           ConstVectorView abs_h2o,
+                           ConstVectorView,
+                           ConstVectorView vmr,
+                           const Verbosity &verbosity) {
+  CREATE_OUT3;
+  //   H. J. Liebe and D. H. Layton,
+  //   Millimeter-wave properties of the atmosphere:
+  //   Laboratory studies and propagation modelling,
+  //   NITA Report 87-224,
+  //   U.S. Dept. of Commerce, National Telecommunications and Information
+  //   Administration, Institute for Communication Sciences, rep. 87-224,
+  //   325 Broadway, Boulder, CO 80303-3328
+  //
+  //  specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum term scale factor,   default CC = 1.000 [1]
+  //     parameters[1] : line strength scale factor,    default CL = 1.000 [1]
+  //     parameters[2] : line broadening scale factor,  default CW = 1.000 [1]
+  //     parameters[3] : line coupling scale factor,    default CO = 1.000 [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     abs_h2o,      : [1]
+  //     vmr           : [1]
+  //
+
+  if (abs_h2o.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires H2O-vmr, but no tag group contains H2O!";
+    throw runtime_error(os.str());
+  }
+
+  const int Nparam = 4;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Full model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    MPM87O2AbsModel(pxsec,
+                    parameters[0],  // continuum term scale factor
+                    parameters[1],  // line strength scale factor
+                    parameters[2],  // line broadening scale factor
+                    parameters[3],  // line coupling scale factor
+                    model,
+                    f_grid,
+                    abs_p,
+                    abs_t,
+                    abs_h2o,
+                    vmr,
+                    verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Full model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Full model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    MPM87O2AbsModel(pxsec,
+                    0.00,
+                    0.00,
+                    0.00,
+                    0.00,
+                    model,
+                    f_grid,
+                    abs_p,
+                    abs_t,
+                    abs_h2o,
+                    vmr,
+                    verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Full model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_O2_MPM85(MatrixView pxsec,
+                           const String &name,
+                           ConstVectorView parameters,
+                           const String &model,
+                           ConstVectorView f_grid,
+                           ConstVectorView abs_p,
+                           ConstVectorView abs_t,
+                           ConstVectorView,
+                           ConstVectorView abs_h2o,
+                           ConstVectorView,
+                           ConstVectorView vmr,
+                           const Verbosity &verbosity) {
+  CREATE_OUT3;
+  //   H. J. Liebe and D. H. Layton,
+  //   An updated model for millimeter wave propagation in moist air
+  //   Radio Science, vol. 20, pp. 1069-1089, 1985
+  //
+  //  specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum term scale factor,   default CC = 1.000 [1]
+  //     parameters[1] : line strength scale factor,    default CL = 1.000 [1]
+  //     parameters[2] : line broadening scale factor,  default CW = 1.000 [1]
+  //     parameters[3] : line coupling scale factor,    default CO = 1.000 [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     abs_h2o,      : [1]
+  //     vmr           : [1]
+  //
+
+  if (abs_h2o.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires H2O-vmr, but no tag group contains H2O!";
+    throw runtime_error(os.str());
+  }
+
+  const int Nparam = 4;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Full model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    MPM85O2AbsModel(pxsec,
+                    parameters[0],  // continuum term scale factor
+                    parameters[1],  // line strength scale factor
+                    parameters[2],  // line broadening scale factor
+                    parameters[3],  // line coupling scale factor
+                    model,
+                    f_grid,
+                    abs_p,
+                    abs_t,
+                    abs_h2o,
+                    vmr,
+                    verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Full model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Full model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    MPM85O2AbsModel(pxsec,
+                    0.00,
+                    0.00,
+                    0.00,
+                    0.00,
+                    model,
+                    f_grid,
+                    abs_p,
+                    abs_t,
+                    abs_h2o,
+                    vmr,
+                    verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Full model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
+
+// ============= N2 continuum =========================================================
+static void pxsec_N2_SelfContMPM93(MatrixView pxsec,
+                                   const String &name,
+                                   ConstVectorView parameters,
+                                   const String &model,
+                                   ConstVectorView f_grid,
+                                   ConstVectorView abs_p,
+                                   ConstVectorView abs_t,
+                                   ConstVectorView,
+                                   ConstVectorView abs_h2o,
+                                   ConstVectorView,
+                                   ConstVectorView vmr,
+                                   const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // MPM93 N2 continuum:
+  // see publication side of National Telecommunications and Information Administration
+  //   http://www.its.bldrdoc.gov/pub/all_pubs/all_pubs.html
+  // and ftp side for downloading the MPM93 original source code:
+  //   ftp://ftp.its.bldrdoc.gov/pub/mpm93/
+  //
+  //  specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : strength parameter   [1/m * 1/(Hz*Pa)]
+  //     parameters[1] : broadening parameter [1]
+  //     parameters[2] : temperature exponent [1]
+  //     parameters[3] : frequency exponent   [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     abs_h2o       : [1]
+  //     vmr           : [1]
+  //
+
+  if (abs_h2o.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires H2O-vmr, but no tag group contains H2O!";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("O2-SelfContPWR93" == name) {
-    // data information about this continuum:
-    // P. W. Rosenkranz Chapter 2, pp 74, in M. A. Janssen,
-    // "Atmospheric Remote Sensing by Microwave Radiometry",
-    // John Wiley & Sons, Inc., 1993, ISBN 0-471-62891-3
-    // (see also JQSRT, Vol.48, No.5/6 pp.629-643, 1992)
-    //
-    //  specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum coefficient (C) [K/(Hz*Pa*m)]
-    //     parameters[1] : temperature exponent  (x) [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-
-    if (abs_h2o.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires H2O-vmr, but no tag group contains H2O!";
-      throw runtime_error(os.str());
-    }
 
-    const int Nparam = 4;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      Rosenkranz_O2_continuum(pxsec,
-                              parameters[0],
-                              parameters[1],
-                              parameters[2],
-                              parameters[3],
-                              model,
-                              f_grid,
-                              abs_p,
-                              abs_t,
-                              abs_h2o,
-                              vmr,
-                              verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      Rosenkranz_O2_continuum(pxsec,
-                              0.00,
-                              0.00,
-                              0.00,
-                              0.00,
-                              model,
-                              f_grid,
-                              abs_p,
-                              abs_t,
-                              abs_h2o,
-                              vmr,
-                              verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+  const int Nparam = 4;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    MPM93_N2_continuum(pxsec,
+                       parameters[0],
+                       parameters[1],
+                       parameters[2],
+                       parameters[3],
+                       model,
+                       f_grid,
+                       abs_p,
+                       abs_t,
+                       abs_h2o,
+                       vmr,
+                       verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model == "MPM93Scale") &&
+             (parameters.nelem() == 1))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    MPM93_N2_continuum(pxsec,
+                       parameters[0],
+                       0.00,
+                       0.00,
+                       0.00,
+                       model,
+                       f_grid,
+                       abs_p,
+                       abs_t,
+                       abs_h2o,
+                       vmr,
+                       verbosity);
+  } else if ((model == "MPM93Scale") &&
+             (parameters.nelem() != 1))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires 1 scaling input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") && (model != "MPM93Scale") &&
+             (parameters.nelem() == 0))  // --
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    MPM93_N2_continuum(pxsec,
+                       0.00,
+                       0.00,
+                       0.00,
+                       0.00,
+                       model,
+                       f_grid,
+                       abs_p,
+                       abs_t,
+                       abs_h2o,
+                       vmr,
+                       verbosity);
   }
-  // ============= O2 full model ========================================================
-  else if ("O2-PWR88" == name) {
-    //  REFERENCE FOR EQUATIONS AND COEFFICIENTS:
-    //  P.W. ROSENKRANZ, CHAP. 2 AND APPENDIX, IN ATMOSPHERIC REMOTE SENSING
-    //  BY MICROWAVE RADIOMETRY (M.A. JANSSEN, ED. 1993)
-    //  AND
-    //  H.J. LIEBE ET AL, JQSRT V.48, PP.629-643 (1992)
-    //  (EXCEPT: SUBMILLIMETER LINE INTENSITIES FROM HITRAN92)
-    //  AND
-    //  P. W. ROSENKRANZ, INTERFERENCE COEFFICIENTS FOR THE
-    //  OVERLAPPING OXYGEN LINES IN AIR, JQSRT, 1988, VOLUME 39, 287-297.
-    //
-    //  the only difference to the 1993 version is the line mixing
-    //  parameter Y, which is taken from the above reference JQSRT, 1988.
-    //
-    //  specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum term scale factor,   default CC = 1.000 [1]
-    //     parameters[1] : line strength scale factor,    default CL = 1.000 [1]
-    //     parameters[1] : line broadening scale factor,  default CW = 1.000 [1]
-    //     parameters[1] : line coupling scale factor,    default CO = 1.000 [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     abs_h2o,      : [1]
-    //     vmr           : [1]
-    //
-
-    if (abs_h2o.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires H2O-vmr, but no tag group contains H2O!";
-      throw runtime_error(os.str());
-    }
+  /* --------------------------------------------------------------------------
+       else if ( (model != "user") && (parameters.nelem() != 0) ) // --------------------
+       {
+       ostringstream os;
+       os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+       throw runtime_error(os.str());
+       }
+       ----------------------------------------------------------------------*/
+}
 
-    const int Nparam = 4;
-    const char *version = "PWR88";
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Full model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      PWR93O2AbsModel(pxsec,
-                      parameters[0],  // continuum term scale factor
-                      parameters[1],  // line strength scale factor
-                      parameters[2],  // line broadening scale factor
-                      parameters[3],  // line coupling scale factor
-                      model,
-                      version,
-                      f_grid,
-                      abs_p,
-                      abs_t,
-                      abs_h2o,
-                      vmr,
-                      verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Full model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Full model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      PWR93O2AbsModel(pxsec,
-                      0.00,
-                      0.00,
-                      0.00,
-                      0.00,
-                      model,
-                      version,
-                      f_grid,
-                      abs_p,
-                      abs_t,
-                      abs_h2o,
-                      vmr,
-                      verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Full model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_N2_DryContATM01(MatrixView pxsec,
+                                  const String &name,
+                                  ConstVectorView parameters,
+                                  const String &model,
+                                  ConstVectorView f_grid,
+                                  ConstVectorView abs_p,
+                                  ConstVectorView abs_t,
+                                  ConstVectorView,
+                                  ConstVectorView abs_h2o,
+                                  ConstVectorView,
+                                  ConstVectorView vmr,
+                                  const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // data information about this continuum:
+  // Pardo et al. model model (IEEE, Trans. Ant. Prop.,
+  // Vol 49, No 12, pp. 1683-1694, 2001)
+  //
+  // specific continuum parameters and units:
+  //  a) output
+  //     pxsec          : [1/m],
+  //  b) input
+  //     parameters[0] : continuum strength coefficient  [1/m * 1/(Hz*Pa)]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]   N2 vmr
+  //     abs_h2o       : [1]   H2O vmr
+  //
+
+  if (abs_h2o.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires H2O-vmr, but no tag group contains H2O!";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("O2-PWR93" == name) {
-    //  REFERENCE FOR EQUATIONS AND COEFFICIENTS:
-    //  P.W. ROSENKRANZ, CHAP. 2 AND APPENDIX, IN ATMOSPHERIC REMOTE SENSING
-    //  BY MICROWAVE RADIOMETRY (M.A. JANSSEN, ED. 1993)
-    //  AND H.J. LIEBE ET AL, JQSRT V.48, PP.629-643 (1992)
-    //  (EXCEPT: SUBMILLIMETER LINE INTENSITIES FROM HITRAN92)
-    //
-    //  specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum term scale factor,   default CC = 1.000 [1]
-    //     parameters[1] : line strength scale factor,    default CL = 1.000 [1]
-    //     parameters[1] : line broadening scale factor,  default CW = 1.000 [1]
-    //     parameters[1] : line coupling scale factor,    default CO = 1.000 [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     abs_h2o,      : [1]
-    //     vmr           : [1]
-    //
-
-    if (abs_h2o.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires H2O-vmr, but no tag group contains H2O!";
-      throw runtime_error(os.str());
-    }
 
-    const int Nparam = 4;
-    const char *version = "PWR93";
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Full model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      PWR93O2AbsModel(pxsec,
-                      parameters[0],  // continuum term scale factor
-                      parameters[1],  // line strength scale factor
-                      parameters[2],  // line broadening scale factor
-                      parameters[3],  // line coupling scale factor
-                      model,
-                      version,
-                      f_grid,
-                      abs_p,
-                      abs_t,
-                      abs_h2o,
-                      vmr,
-                      verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Full model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Full model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      PWR93O2AbsModel(pxsec,
-                      0.00,
-                      0.00,
-                      0.00,
-                      0.00,
-                      model,
-                      version,
-                      f_grid,
-                      abs_p,
-                      abs_t,
-                      abs_h2o,
-                      vmr,
-                      verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Full model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    Pardo_ATM_N2_dry_continuum(pxsec,
+                               parameters[0],  // coefficient
+                               model,
+                               f_grid,
+                               abs_p,
+                               abs_t,
+                               vmr,
+                               abs_h2o,
+                               verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    Pardo_ATM_N2_dry_continuum(pxsec,
+                               0.000,  // coefficient
+                               model,
+                               f_grid,
+                               abs_p,
+                               abs_t,
+                               vmr,
+                               abs_h2o,
+                               verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("O2-PWR98" == name) {
-    //  REFERENCES FOR EQUATIONS AND COEFFICIENTS:
-    //    P.W. Rosenkranz, CHAP. 2 and appendix, in ATMOSPHERIC REMOTE SENSING
-    //     BY MICROWAVE RADIOMETRY (M.A. Janssen, ed., 1993).
-    //    H.J. Liebe et al, JQSRT V.48, PP.629-643 (1992).
-    //    M.J. Schwartz, Ph.D. thesis, M.I.T. (1997).
-    //    SUBMILLIMETER LINE INTENSITIES FROM HITRAN96.
-    //    This version differs from Liebe's MPM92 in two significant respects:
-    //    1. It uses the modification of the 1- line width temperature dependence
-    //    recommended by Schwartz: (1/T).
-    //    2. It uses the same temperature dependence (X) for submillimeter
-    //    line widths as in the 60 GHz band: (1/T)**0.8
-    //
-    //  specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum term scale factor,   default CC = 1.000 [1]
-    //     parameters[1] : line strength scale factor,    default CL = 1.000 [1]
-    //     parameters[1] : line broadening scale factor,  default CW = 1.000 [1]
-    //     parameters[1] : line coupling scale factor,    default CO = 1.000 [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     abs_h2o,      : [1]
-    //     vmr           : [1]
-    //
-
-    // abs_h2o needed here. check, whether this is valid.
-    if (abs_h2o.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires H2O-vmr, but no tag group contains H2O!";
-      throw runtime_error(os.str());
-    }
+}
 
-    const int Nparam = 4;
-    const char *version = "PWR98";
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Full model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      PWR93O2AbsModel(pxsec,
-                      parameters[0],  // continuum term scale factor
-                      parameters[1],  // line strength scale factor
-                      parameters[2],  // line broadening scale factor
-                      parameters[3],  // line coupling scale factor
-                      model,
-                      version,
-                      f_grid,
-                      abs_p,
-                      abs_t,
-                      abs_h2o,
-                      vmr,
-                      verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Full model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Full model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      PWR93O2AbsModel(pxsec,
-                      0.00,
-                      0.00,
-                      0.00,
-                      0.00,
-                      model,
-                      version,
-                      f_grid,
-                      abs_p,
-                      abs_t,
-                      abs_h2o,
-                      vmr,
-                      verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Full model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_N2_SelfContPWR93(MatrixView pxsec,
+                                   const String &name,
+                                   ConstVectorView parameters,
+                                   const String &model,
+                                   ConstVectorView f_grid,
+                                   ConstVectorView abs_p,
+                                   ConstVectorView abs_t,
+                                   ConstVectorView,
+                                   ConstVectorView,
+                                   ConstVectorView,
+                                   ConstVectorView vmr,
+                                   const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // data information about this continuum:
+  // P. W. Rosenkranz Chapter 2, pp 74, in M. A. Janssen,
+  // "Atmospheric Remote Sensing by Microwave Radiometry",
+  // John Wiley & Sons, Inc., 1993, ISBN 0-471-62891-3
+  //
+  // specific continuum parameters and units:
+  //  a) output
+  //     pxsec          : [1/m],
+  //  b) input
+  //     parameters[0] : continuum strength coefficient  [1/m * 1/(Hz*Pa)]
+  //     parameters[1] : continuum temperature exponent  [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  const int Nparam = 2;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    Rosenkranz_N2_self_continuum(pxsec,
+                                 parameters[0],  // coefficient
+                                 parameters[1],  // temp. exponent
+                                 model,
+                                 f_grid,
+                                 abs_p,
+                                 abs_t,
+                                 vmr,
+                                 verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    Rosenkranz_N2_self_continuum(
+        pxsec, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("O2-MPM93" == name) {
-    //  H. J. Liebe and G. A. Hufford and M. G. Cotton,
-    //  "Propagation modeling of moist air and suspended water/ice
-    //   particles at frequencies below 1000 GHz",
-    //  AGARD 52nd Specialists Meeting of the Electromagnetic Wave
-    //  Propagation Panel, Palma de Mallorca, Spain, 1993, May 17-21
-    //
-    //  specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum term scale factor,   default CC = 1.000 [1]
-    //     parameters[1] : line strength scale factor,    default CL = 1.000 [1]
-    //     parameters[2] : line broadening scale factor,  default CW = 1.000 [1]
-    //     parameters[3] : line coupling scale factor,    default CO = 1.000 [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     abs_h2o,      : [1]
-    //     vmr           : [1]
-    //
-
-    if (abs_h2o.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires H2O-vmr, but no tag group contains H2O!";
-      throw runtime_error(os.str());
-    }
+}
 
-    const int Nparam = 4;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Full model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      MPM93O2AbsModel(pxsec,
-                      parameters[0],  // continuum term scale factor
-                      parameters[1],  // line strength scale factor
-                      parameters[2],  // line broadening scale factor
-                      parameters[3],  // line coupling scale factor
-                      model,
-                      f_grid,
-                      abs_p,
-                      abs_t,
-                      abs_h2o,
-                      vmr,
-                      verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Full model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Full model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      MPM93O2AbsModel(pxsec,
-                      0.00,
-                      0.00,
-                      0.00,
-                      0.00,
-                      model,
-                      f_grid,
-                      abs_p,
-                      abs_t,
-                      abs_h2o,
-                      vmr,
-                      verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Full model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_N2_SelfContStandardType(MatrixView pxsec,
+                                          const String &name,
+                                          ConstVectorView parameters,
+                                          const String &model,
+                                          ConstVectorView f_grid,
+                                          ConstVectorView abs_p,
+                                          ConstVectorView abs_t,
+                                          ConstVectorView,
+                                          ConstVectorView,
+                                          ConstVectorView,
+                                          ConstVectorView vmr,
+                                          const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // data information about this continuum:
+  // A completely general expression for the N2 continuum
+  //
+  // specific continuum parameters and units:
+  // OUTPUT
+  //     pxsec          : [1/m],
+  // INPUT
+  //     parameters[0] : continuum coefficient (C)  [1/m * 1/(Hz*Pa)]
+  //     parameters[1] : frequency exponent    (xf) [1]
+  //     parameters[2] : temperature exponent  (xt) [1]
+  //     parameters[3] : pressure exponent     (xp) [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  const int Nparam = 4;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    Standard_N2_self_continuum(pxsec,
+                               parameters[0],
+                               parameters[1],
+                               parameters[2],
+                               parameters[3],
+                               model,
+                               f_grid,
+                               abs_p,
+                               abs_t,
+                               vmr,
+                               verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    Standard_N2_self_continuum(pxsec,
+                               0.000,
+                               0.000,
+                               0.000,
+                               0.000,
+                               model,
+                               f_grid,
+                               abs_p,
+                               abs_t,
+                               vmr,
+                               verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("O2-TRE05" == name) {
-    //  H. J. Liebe and G. A. Hufford and M. G. Cotton,
-    //  "Propagation modeling of moist air and suspended water/ice
-    //   particles at frequencies below 1000 GHz",
-    //  AGARD 52nd Specialists Meeting of the Electromagnetic Wave
-    //  Propagation Panel, Palma de Mallorca, Spain, 1993, May 17-21
-    //
-    //  specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum term scale factor,   default CC = 1.000 [1]
-    //     parameters[1] : line strength scale factor,    default CL = 1.000 [1]
-    //     parameters[2] : line broadening scale factor,  default CW = 1.000 [1]
-    //     parameters[3] : line coupling scale factor,    default CO = 1.000 [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     abs_h2o,      : [1]
-    //     vmr           : [1]
-    //
-
-    if (abs_h2o.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires H2O-vmr, but no tag group contains H2O!";
-      throw runtime_error(os.str());
-    }
+}
 
-    const int Nparam = 4;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Full model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      TRE05O2AbsModel(pxsec,
-                      parameters[0],  // continuum term scale factor
-                      parameters[1],  // line strength scale factor
-                      parameters[2],  // line broadening scale factor
-                      parameters[3],  // line coupling scale factor
-                      model,
-                      f_grid,
-                      abs_p,
-                      abs_t,
-                      abs_h2o,
-                      vmr,
-                      verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Full model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Full model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      TRE05O2AbsModel(pxsec,
-                      0.00,
-                      0.00,
-                      0.00,
-                      0.00,
-                      model,
-                      f_grid,
-                      abs_p,
-                      abs_t,
-                      abs_h2o,
-                      vmr,
-                      verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Full model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_N2_SelfContBorysow(MatrixView pxsec,
+                                     const String &name,
+                                     ConstVectorView parameters,
+                                     const String &model,
+                                     ConstVectorView f_grid,
+                                     ConstVectorView abs_p,
+                                     ConstVectorView abs_t,
+                                     ConstVectorView,
+                                     ConstVectorView,
+                                     ConstVectorView,
+                                     ConstVectorView vmr,
+                                     const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // data information about this continuum:
+  // A. Borysow and L. Frommhold, The Astrophysical Journal,
+  // Vol. 311, pp.1043-1057, 1986
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    BF86_CIA_N2(pxsec,
+                parameters[0],  // scaling factor
+                model,
+                f_grid,
+                abs_p,
+                abs_t,
+                vmr,
+                verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    BF86_CIA_N2(pxsec, 0.0, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters. "
+       << "\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("O2-MPM92" == name) {
-    //   H. J. Liebe, P. W. Rosenkranz and G. A. Hufford,
-    //   Atmospheric 60-GHz Oxygen Spectrum: New Laboratory
-    //   Measurements and Line Parameters
-    //   JQSRT, Vol 48, pp. 629-643, 1992
-    //
-    //  specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum term scale factor,   default CC = 1.000 [1]
-    //     parameters[1] : line strength scale factor,    default CL = 1.000 [1]
-    //     parameters[2] : line broadening scale factor,  default CW = 1.000 [1]
-    //     parameters[3] : line coupling scale factor,    default CO = 1.000 [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     abs_h2o,      : [1]
-    //     vmr           : [1]
-    //
-
-    if (abs_h2o.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires H2O-vmr, but no tag group contains H2O!";
-      throw runtime_error(os.str());
-    }
+}
 
-    const int Nparam = 4;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Full model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      MPM92O2AbsModel(pxsec,
-                      parameters[0],  // continuum term scale factor
-                      parameters[1],  // line strength scale factor
-                      parameters[2],  // line broadening scale factor
-                      parameters[3],  // line coupling scale factor
-                      model,
-                      f_grid,
-                      abs_p,
-                      abs_t,
-                      abs_h2o,
-                      vmr,
-                      verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Full model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Full model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      MPM92O2AbsModel(pxsec,
-                      0.00,
-                      0.00,
-                      0.00,
-                      0.00,
-                      model,
-                      f_grid,
-                      abs_p,
-                      abs_t,
-                      abs_h2o,
-                      vmr,
-                      verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Full model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_N2_CIArotCKDMT100(MatrixView pxsec,
+                                    const String &name,
+                                    ConstVectorView parameters,
+                                    const String &model,
+                                    ConstVectorView f_grid,
+                                    ConstVectorView abs_p,
+                                    ConstVectorView abs_t,
+                                    ConstVectorView,
+                                    ConstVectorView,
+                                    ConstVectorView,
+                                    ConstVectorView vmr,
+                                    const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // data information about this continuum:
+  // A. Borysow and L. Frommhold, The Astrophysical Journal,
+  // Vol. 311, pp.1043-1057, 1986
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_mt_CIArot_n2(pxsec,
+                     parameters[0],  // scaling factor
+                     model,
+                     f_grid,
+                     abs_p,
+                     abs_t,
+                     vmr,
+                     verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_mt_CIArot_n2(pxsec, 0.0, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters. "
+       << "\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("O2-MPM89" == name) {
-    //   H. J. Liebe,
-    //   MPM - an atmospheric millimeter-wave propagation model,
-    //   Int. J. Infrared and Mill. Waves, Vol 10, pp. 631-650, 1989.
-    //
-    //  specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum term scale factor,   default CC = 1.000 [1]
-    //     parameters[1] : line strength scale factor,    default CL = 1.000 [1]
-    //     parameters[2] : line broadening scale factor,  default CW = 1.000 [1]
-    //     parameters[3] : line coupling scale factor,    default CO = 1.000 [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     abs_h2o,      : [1]
-    //     vmr           : [1]
-    //
-
-    if (abs_h2o.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires H2O-vmr, but no tag group contains H2O!";
-      throw runtime_error(os.str());
-    }
+}
 
-    const int Nparam = 4;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Full model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      MPM89O2AbsModel(pxsec,
-                      parameters[0],  // continuum term scale factor
-                      parameters[1],  // line strength scale factor
-                      parameters[2],  // line broadening scale factor
-                      parameters[3],  // line coupling scale factor
-                      model,
-                      f_grid,
-                      abs_p,
-                      abs_t,
-                      abs_h2o,
-                      vmr,
-                      verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Full model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Full model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      MPM89O2AbsModel(pxsec,
-                      0.00,
-                      0.00,
-                      0.00,
-                      0.00,
-                      model,
-                      f_grid,
-                      abs_p,
-                      abs_t,
-                      abs_h2o,
-                      vmr,
-                      verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Full model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_N2_CIAfunCKDMT100(MatrixView pxsec,
+                                    const String &name,
+                                    ConstVectorView parameters,
+                                    const String &model,
+                                    ConstVectorView f_grid,
+                                    ConstVectorView abs_p,
+                                    ConstVectorView abs_t,
+                                    ConstVectorView,
+                                    ConstVectorView,
+                                    ConstVectorView,
+                                    ConstVectorView vmr,
+                                    const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // data information about this continuum:
+  // Lafferty, W.J., A.M. Solodov,A. Weber, W.B. Olson and J._M. Hartmann,
+  // Infrared collision-induced absorption by
+  // N2 near 4.3 microns for atmospheric applications:
+  // Measurements and emprirical modeling,
+  // Appl. Optics, 35, 5911-5917, (1996)
+
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_mt_CIAfun_n2(pxsec,
+                     parameters[0],  // scaling factor
+                     model,
+                     f_grid,
+                     abs_p,
+                     abs_t,
+                     vmr,
+                     verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_mt_CIAfun_n2(pxsec, 0.0, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters. "
+       << "\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("O2-MPM87" == name) {
-    //   H. J. Liebe and D. H. Layton,
-    //   Millimeter-wave properties of the atmosphere:
-    //   Laboratory studies and propagation modelling,
-    //   NITA Report 87-224,
-    //   U.S. Dept. of Commerce, National Telecommunications and Information
-    //   Administration, Institute for Communication Sciences, rep. 87-224,
-    //   325 Broadway, Boulder, CO 80303-3328
-    //
-    //  specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum term scale factor,   default CC = 1.000 [1]
-    //     parameters[1] : line strength scale factor,    default CL = 1.000 [1]
-    //     parameters[2] : line broadening scale factor,  default CW = 1.000 [1]
-    //     parameters[3] : line coupling scale factor,    default CO = 1.000 [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     abs_h2o,      : [1]
-    //     vmr           : [1]
-    //
-
-    if (abs_h2o.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires H2O-vmr, but no tag group contains H2O!";
-      throw runtime_error(os.str());
-    }
+}
 
-    const int Nparam = 4;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Full model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      MPM87O2AbsModel(pxsec,
-                      parameters[0],  // continuum term scale factor
-                      parameters[1],  // line strength scale factor
-                      parameters[2],  // line broadening scale factor
-                      parameters[3],  // line coupling scale factor
-                      model,
-                      f_grid,
-                      abs_p,
-                      abs_t,
-                      abs_h2o,
-                      vmr,
-                      verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Full model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Full model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      MPM87O2AbsModel(pxsec,
-                      0.00,
-                      0.00,
-                      0.00,
-                      0.00,
-                      model,
-                      f_grid,
-                      abs_p,
-                      abs_t,
-                      abs_h2o,
-                      vmr,
-                      verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Full model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_N2_CIArotCKDMT252(MatrixView pxsec,
+                                    const String &name,
+                                    ConstVectorView parameters,
+                                    const String &model,
+                                    ConstVectorView f_grid,
+                                    ConstVectorView abs_p,
+                                    ConstVectorView abs_t,
+                                    ConstVectorView,
+                                    ConstVectorView abs_h2o,
+                                    ConstVectorView abs_o2,
+                                    ConstVectorView vmr,
+                                    const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // data information about this continuum:
+  // A. Borysow and L. Frommhold, The Astrophysical Journal,
+  // Vol. 311, pp.1043-1057, 1986
+
+  if (abs_o2.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires O2-vmr, but no tag group contains O2!";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("O2-MPM85" == name) {
-    //   H. J. Liebe and D. H. Layton,
-    //   An updated model for millimeter wave propagation in moist air
-    //   Radio Science, vol. 20, pp. 1069-1089, 1985
-    //
-    //  specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum term scale factor,   default CC = 1.000 [1]
-    //     parameters[1] : line strength scale factor,    default CL = 1.000 [1]
-    //     parameters[2] : line broadening scale factor,  default CW = 1.000 [1]
-    //     parameters[3] : line coupling scale factor,    default CO = 1.000 [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     abs_h2o,      : [1]
-    //     vmr           : [1]
-    //
-
-    if (abs_h2o.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires H2O-vmr, but no tag group contains H2O!";
-      throw runtime_error(os.str());
-    }
 
-    const int Nparam = 4;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Full model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      MPM85O2AbsModel(pxsec,
-                      parameters[0],  // continuum term scale factor
-                      parameters[1],  // line strength scale factor
-                      parameters[2],  // line broadening scale factor
-                      parameters[3],  // line coupling scale factor
-                      model,
-                      f_grid,
-                      abs_p,
-                      abs_t,
-                      abs_h2o,
-                      vmr,
-                      verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Full model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Full model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      MPM85O2AbsModel(pxsec,
-                      0.00,
-                      0.00,
-                      0.00,
-                      0.00,
-                      model,
-                      f_grid,
-                      abs_p,
-                      abs_t,
-                      abs_h2o,
-                      vmr,
-                      verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Full model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+  if (abs_h2o.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires H2O-vmr, but no tag group contains H2O!";
+    throw runtime_error(os.str());
   }
-  // ============= N2 continuum =========================================================
-  else if ("N2-SelfContMPM93" == name) {
-    // MPM93 N2 continuum:
-    // see publication side of National Telecommunications and Information Administration
-    //   http://www.its.bldrdoc.gov/pub/all_pubs/all_pubs.html
-    // and ftp side for downloading the MPM93 original source code:
-    //   ftp://ftp.its.bldrdoc.gov/pub/mpm93/
-    //
-    //  specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : strength parameter   [1/m * 1/(Hz*Pa)]
-    //     parameters[1] : broadening parameter [1]
-    //     parameters[2] : temperature exponent [1]
-    //     parameters[3] : frequency exponent   [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     abs_h2o       : [1]
-    //     vmr           : [1]
-    //
-
-    if (abs_h2o.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires H2O-vmr, but no tag group contains H2O!";
-      throw runtime_error(os.str());
-    }
 
-    const int Nparam = 4;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      MPM93_N2_continuum(pxsec,
-                         parameters[0],
-                         parameters[1],
-                         parameters[2],
-                         parameters[3],
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_mt_250_CIArot_n2(pxsec,
+                         parameters[0],  // scaling factor
                          model,
                          f_grid,
                          abs_p,
                          abs_t,
-                         abs_h2o,
                          vmr,
+                         abs_h2o,
+                         abs_o2,
                          verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model == "MPM93Scale") &&
-               (parameters.nelem() == 1))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      MPM93_N2_continuum(pxsec,
-                         parameters[0],
-                         0.00,
-                         0.00,
-                         0.00,
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_mt_250_CIArot_n2(pxsec,
+                         0.0,
                          model,
                          f_grid,
                          abs_p,
                          abs_t,
-                         abs_h2o,
                          vmr,
+                         abs_h2o,
+                         abs_o2,
                          verbosity);
-    } else if ((model == "MPM93Scale") &&
-               (parameters.nelem() != 1))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires 1 scaling input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") && (model != "MPM93Scale") &&
-               (parameters.nelem() == 0))  // --
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      MPM93_N2_continuum(pxsec,
-                         0.00,
-                         0.00,
-                         0.00,
-                         0.00,
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters. "
+       << "\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
+  }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_N2_CIAfunCKDMT252(MatrixView pxsec,
+                                    const String &name,
+                                    ConstVectorView parameters,
+                                    const String &model,
+                                    ConstVectorView f_grid,
+                                    ConstVectorView abs_p,
+                                    ConstVectorView abs_t,
+                                    ConstVectorView,
+                                    ConstVectorView abs_h2o,
+                                    ConstVectorView abs_o2,
+                                    ConstVectorView vmr,
+                                    const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // data information about this continuum:
+  // Lafferty, W.J., A.M. Solodov,A. Weber, W.B. Olson and J._M. Hartmann,
+  // Infrared collision-induced absorption by
+  // N2 near 4.3 microns for atmospheric applications:
+  // Measurements and emprirical modeling,
+  // Appl. Optics, 35, 5911-5917, (1996)
+
+  if (abs_o2.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires O2-vmr, but no tag group contains O2!";
+    throw runtime_error(os.str());
+  }
+
+  if (abs_h2o.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires H2O-vmr, but no tag group contains H2O!";
+    throw runtime_error(os.str());
+  }
+
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_mt_250_CIAfun_n2(pxsec,
+                         parameters[0],  // scaling factor
                          model,
                          f_grid,
                          abs_p,
                          abs_t,
+                         vmr,
                          abs_h2o,
+                         abs_o2,
+                         verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_mt_250_CIAfun_n2(pxsec,
+                         0.0,
+                         model,
+                         f_grid,
+                         abs_p,
+                         abs_t,
                          vmr,
+                         abs_h2o,
+                         abs_o2,
                          verbosity);
-    }
-    /* --------------------------------------------------------------------------
-         else if ( (model != "user") && (parameters.nelem() != 0) ) // --------------------
-         {
-         ostringstream os;
-         os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-         throw runtime_error(os.str());
-         }
-         ----------------------------------------------------------------------*/
-  }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("N2-DryContATM01" == name) {
-    // data information about this continuum:
-    // Pardo et al. model model (IEEE, Trans. Ant. Prop.,
-    // Vol 49, No 12, pp. 1683-1694, 2001)
-    //
-    // specific continuum parameters and units:
-    //  a) output
-    //     pxsec          : [1/m],
-    //  b) input
-    //     parameters[0] : continuum strength coefficient  [1/m * 1/(Hz*Pa)]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]   N2 vmr
-    //     abs_h2o       : [1]   H2O vmr
-    //
-
-    if (abs_h2o.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires H2O-vmr, but no tag group contains H2O!";
-      throw runtime_error(os.str());
-    }
-
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      Pardo_ATM_N2_dry_continuum(pxsec,
-                                 parameters[0],  // coefficient
-                                 model,
-                                 f_grid,
-                                 abs_p,
-                                 abs_t,
-                                 vmr,
-                                 abs_h2o,
-                                 verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      Pardo_ATM_N2_dry_continuum(pxsec,
-                                 0.000,  // coefficient
-                                 model,
-                                 f_grid,
-                                 abs_p,
-                                 abs_t,
-                                 vmr,
-                                 abs_h2o,
-                                 verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
-  }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("N2-SelfContPWR93" == name) {
-    // data information about this continuum:
-    // P. W. Rosenkranz Chapter 2, pp 74, in M. A. Janssen,
-    // "Atmospheric Remote Sensing by Microwave Radiometry",
-    // John Wiley & Sons, Inc., 1993, ISBN 0-471-62891-3
-    //
-    // specific continuum parameters and units:
-    //  a) output
-    //     pxsec          : [1/m],
-    //  b) input
-    //     parameters[0] : continuum strength coefficient  [1/m * 1/(Hz*Pa)]
-    //     parameters[1] : continuum temperature exponent  [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    const int Nparam = 2;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      Rosenkranz_N2_self_continuum(pxsec,
-                                   parameters[0],  // coefficient
-                                   parameters[1],  // temp. exponent
-                                   model,
-                                   f_grid,
-                                   abs_p,
-                                   abs_t,
-                                   vmr,
-                                   verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      Rosenkranz_N2_self_continuum(
-          pxsec, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
-  }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("N2-SelfContStandardType" == name) {
-    // data information about this continuum:
-    // A completely general expression for the N2 continuum
-    //
-    // specific continuum parameters and units:
-    // OUTPUT
-    //     pxsec          : [1/m],
-    // INPUT
-    //     parameters[0] : continuum coefficient (C)  [1/m * 1/(Hz*Pa)]
-    //     parameters[1] : frequency exponent    (xf) [1]
-    //     parameters[2] : temperature exponent  (xt) [1]
-    //     parameters[3] : pressure exponent     (xp) [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    const int Nparam = 4;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      Standard_N2_self_continuum(pxsec,
-                                 parameters[0],
-                                 parameters[1],
-                                 parameters[2],
-                                 parameters[3],
-                                 model,
-                                 f_grid,
-                                 abs_p,
-                                 abs_t,
-                                 vmr,
-                                 verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      Standard_N2_self_continuum(pxsec,
-                                 0.000,
-                                 0.000,
-                                 0.000,
-                                 0.000,
-                                 model,
-                                 f_grid,
-                                 abs_p,
-                                 abs_t,
-                                 vmr,
-                                 verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters. "
+       << "\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("N2-SelfContBorysow" == name) {
-    // data information about this continuum:
-    // A. Borysow and L. Frommhold, The Astrophysical Journal,
-    // Vol. 311, pp.1043-1057, 1986
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      BF86_CIA_N2(pxsec,
-                  parameters[0],  // scaling factor
-                  model,
-                  f_grid,
-                  abs_p,
-                  abs_t,
-                  vmr,
-                  verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      BF86_CIA_N2(pxsec, 0.0, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters. "
-         << "\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+}
+
+// ============= CO2 continuum ========================================================
+static void pxsec_CO2_CKD241(MatrixView pxsec,
+                             const String &name,
+                             ConstVectorView parameters,
+                             const String &model,
+                             ConstVectorView f_grid,
+                             ConstVectorView abs_p,
+                             ConstVectorView abs_t,
+                             ConstVectorView,
+                             ConstVectorView,
+                             ConstVectorView,
+                             ConstVectorView vmr,
+                             const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // data information about this continuum:
+  // CKDv2.4.1 model at http://www.rtweb.aer.com/continuum_frame.html
+  // This continuum accounts for the far wings of the many COS lines/bands since
+  // the line is used with a cutoff in the line shape with +/- 25 cm^-1.
+  //
+  // specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum strength coefficient [1/m * 1/(Hz*Pa)]
+  //     parameters[1] : continuum temperature exponent  [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_241_co2(pxsec,
+                parameters[0],  // abs. scaling
+                model,
+                f_grid,
+                abs_p,
+                abs_t,
+                vmr,
+                verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_241_co2(pxsec, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters. "
+       << "\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("N2-CIArotCKDMT100" == name) {
-    // data information about this continuum:
-    // A. Borysow and L. Frommhold, The Astrophysical Journal,
-    // Vol. 311, pp.1043-1057, 1986
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_mt_CIArot_n2(pxsec,
-                       parameters[0],  // scaling factor
-                       model,
-                       f_grid,
-                       abs_p,
-                       abs_t,
-                       vmr,
-                       verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_mt_CIArot_n2(pxsec, 0.0, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters. "
-         << "\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_CO2_CKDMT100(MatrixView pxsec,
+                               const String &name,
+                               ConstVectorView parameters,
+                               const String &model,
+                               ConstVectorView f_grid,
+                               ConstVectorView abs_p,
+                               ConstVectorView abs_t,
+                               ConstVectorView,
+                               ConstVectorView,
+                               ConstVectorView,
+                               ConstVectorView vmr,
+                               const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // data information about this continuum:
+  // CKD model at http://www.rtweb.aer.com/continuum_frame.html
+  // This continuum accounts for the far wings of the many COS lines/bands since
+  // the line is used with a cutoff in the line shape with +/- 25 cm^-1.
+  //
+  // specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum strength coefficient [1/m * 1/(Hz*Pa)]
+  //     parameters[1] : continuum temperature exponent  [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_mt_co2(pxsec,
+               parameters[0],  // abs. scaling
+               model,
+               f_grid,
+               abs_p,
+               abs_t,
+               vmr,
+               verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_mt_co2(pxsec, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters. "
+       << "\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("N2-CIAfunCKDMT100" == name) {
-    // data information about this continuum:
-    // Lafferty, W.J., A.M. Solodov,A. Weber, W.B. Olson and J._M. Hartmann,
-    // Infrared collision-induced absorption by
-    // N2 near 4.3 microns for atmospheric applications:
-    // Measurements and emprirical modeling,
-    // Appl. Optics, 35, 5911-5917, (1996)
-
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_mt_CIAfun_n2(pxsec,
-                       parameters[0],  // scaling factor
-                       model,
-                       f_grid,
-                       abs_p,
-                       abs_t,
-                       vmr,
-                       verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_mt_CIAfun_n2(pxsec, 0.0, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters. "
-         << "\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+}
+
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_CO2_CKDMT252(MatrixView pxsec,
+                               const String &name,
+                               ConstVectorView parameters,
+                               const String &model,
+                               ConstVectorView f_grid,
+                               ConstVectorView abs_p,
+                               ConstVectorView abs_t,
+                               ConstVectorView,
+                               ConstVectorView,
+                               ConstVectorView,
+                               ConstVectorView vmr,
+                               const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // data information about this continuum:
+  // CKD model at http://www.rtweb.aer.com/continuum_frame.html
+  // This continuum accounts for the far wings of the many COS lines/bands since
+  // the line is used with a cutoff in the line shape with +/- 25 cm^-1.
+  //
+  // specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum strength coefficient [1/m * 1/(Hz*Pa)]
+  //     parameters[1] : continuum temperature exponent  [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  const int Nparam = 1;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    CKD_mt_250_co2(pxsec,
+                   parameters[0],  // abs. scaling
+                   model,
+                   f_grid,
+                   abs_p,
+                   abs_t,
+                   vmr,
+                   verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    CKD_mt_250_co2(pxsec, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters. "
+       << "\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("N2-CIArotCKDMT252" == name) {
-    // data information about this continuum:
-    // A. Borysow and L. Frommhold, The Astrophysical Journal,
-    // Vol. 311, pp.1043-1057, 1986
-
-    if (abs_o2.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires O2-vmr, but no tag group contains O2!";
-      throw runtime_error(os.str());
-    }
-
-    if (abs_h2o.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires H2O-vmr, but no tag group contains H2O!";
-      throw runtime_error(os.str());
-    }
+}
 
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_mt_250_CIArot_n2(pxsec,
-                           parameters[0],  // scaling factor
-                           model,
-                           f_grid,
-                           abs_p,
-                           abs_t,
-                           vmr,
-                           abs_h2o,
-                           abs_o2,
-                           verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_mt_250_CIArot_n2(pxsec,
-                           0.0,
-                           model,
-                           f_grid,
-                           abs_p,
-                           abs_t,
-                           vmr,
-                           abs_h2o,
-                           abs_o2,
-                           verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters. "
-         << "\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_CO2_SelfContPWR93(MatrixView pxsec,
+                                    const String &name,
+                                    ConstVectorView parameters,
+                                    const String &model,
+                                    ConstVectorView f_grid,
+                                    ConstVectorView abs_p,
+                                    ConstVectorView abs_t,
+                                    ConstVectorView,
+                                    ConstVectorView,
+                                    ConstVectorView,
+                                    ConstVectorView vmr,
+                                    const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // data information about this continuum:
+  // P. W. Rosenkranz Chapter 2, pp 74, in M. A. Janssen,
+  // "Atmospheric Remote Sensing by Microwave Radiometry",
+  // John Wiley & Sons, Inc., 1993, ISBN 0-471-62891-3
+  //
+  // specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum strength coefficient [1/m * 1/(Hz*Pa)]
+  //     parameters[1] : continuum temperature exponent  [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  const int Nparam = 2;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    Rosenkranz_CO2_self_continuum(pxsec,
+                                  parameters[0],  // coefficient
+                                  parameters[1],  // temp. exponent
+                                  model,
+                                  f_grid,
+                                  abs_p,
+                                  abs_t,
+                                  vmr,
+                                  verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    Rosenkranz_CO2_self_continuum(
+        pxsec, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters. "
+       << "\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("N2-CIAfunCKDMT252" == name) {
-    // data information about this continuum:
-    // Lafferty, W.J., A.M. Solodov,A. Weber, W.B. Olson and J._M. Hartmann,
-    // Infrared collision-induced absorption by
-    // N2 near 4.3 microns for atmospheric applications:
-    // Measurements and emprirical modeling,
-    // Appl. Optics, 35, 5911-5917, (1996)
-
-    if (abs_o2.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires O2-vmr, but no tag group contains O2!";
-      throw runtime_error(os.str());
-    }
+}
 
-    if (abs_h2o.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires H2O-vmr, but no tag group contains H2O!";
-      throw runtime_error(os.str());
-    }
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_CO2_ForeignContPWR93(MatrixView pxsec,
+                                       const String &name,
+                                       ConstVectorView parameters,
+                                       const String &model,
+                                       ConstVectorView f_grid,
+                                       ConstVectorView abs_p,
+                                       ConstVectorView abs_t,
+                                       ConstVectorView abs_n2,
+                                       ConstVectorView,
+                                       ConstVectorView,
+                                       ConstVectorView vmr,
+                                       const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // data information about this continuum:
+  // P. W. Rosenkranz Chapter 2, pp 74, in M. A. Janssen,
+  // "Atmospheric Remote Sensing by Microwave Radiometry",
+  // John Wiley & Sons, Inc., 1993, ISBN 0-471-62891-3
+  //
+  // specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum strength coefficient [1/m * 1/(Hz*Pa)]
+  //     parameters[1] : continuum temperature exponent  [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     abs_n2        : [1]
+  //     vmr           : [1]
+  //
 
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_mt_250_CIAfun_n2(pxsec,
-                           parameters[0],  // scaling factor
-                           model,
-                           f_grid,
-                           abs_p,
-                           abs_t,
-                           vmr,
-                           abs_h2o,
-                           abs_o2,
-                           verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_mt_250_CIAfun_n2(pxsec,
-                           0.0,
-                           model,
-                           f_grid,
-                           abs_p,
-                           abs_t,
-                           vmr,
-                           abs_h2o,
-                           abs_o2,
-                           verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters. "
-         << "\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+  if (abs_n2.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires N2-vmr, but no tag group contains N2!";
+    throw runtime_error(os.str());
   }
 
-  // ============= CO2 continuum ========================================================
-  else if ("CO2-CKD241" == name) {
-    // data information about this continuum:
-    // CKDv2.4.1 model at http://www.rtweb.aer.com/continuum_frame.html
-    // This continuum accounts for the far wings of the many COS lines/bands since
-    // the line is used with a cutoff in the line shape with +/- 25 cm^-1.
-    //
-    // specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum strength coefficient [1/m * 1/(Hz*Pa)]
-    //     parameters[1] : continuum temperature exponent  [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_241_co2(pxsec,
-                  parameters[0],  // abs. scaling
-                  model,
-                  f_grid,
-                  abs_p,
-                  abs_t,
-                  vmr,
-                  verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_241_co2(pxsec, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters. "
-         << "\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
-  }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("CO2-CKDMT100" == name) {
-    // data information about this continuum:
-    // CKD model at http://www.rtweb.aer.com/continuum_frame.html
-    // This continuum accounts for the far wings of the many COS lines/bands since
-    // the line is used with a cutoff in the line shape with +/- 25 cm^-1.
-    //
-    // specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum strength coefficient [1/m * 1/(Hz*Pa)]
-    //     parameters[1] : continuum temperature exponent  [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_mt_co2(pxsec,
-                 parameters[0],  // abs. scaling
-                 model,
-                 f_grid,
-                 abs_p,
-                 abs_t,
-                 vmr,
-                 verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_mt_co2(pxsec, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters. "
-         << "\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
-  }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("CO2-CKDMT252" == name) {
-    // data information about this continuum:
-    // CKD model at http://www.rtweb.aer.com/continuum_frame.html
-    // This continuum accounts for the far wings of the many COS lines/bands since
-    // the line is used with a cutoff in the line shape with +/- 25 cm^-1.
-    //
-    // specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum strength coefficient [1/m * 1/(Hz*Pa)]
-    //     parameters[1] : continuum temperature exponent  [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    const int Nparam = 1;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      CKD_mt_250_co2(pxsec,
-                     parameters[0],  // abs. scaling
-                     model,
-                     f_grid,
-                     abs_p,
-                     abs_t,
-                     vmr,
-                     verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      CKD_mt_250_co2(pxsec, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters. "
-         << "\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+  const int Nparam = 2;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    Rosenkranz_CO2_foreign_continuum(pxsec,
+                                     parameters[0],
+                                     parameters[1],
+                                     model,
+                                     f_grid,
+                                     abs_p,
+                                     abs_t,
+                                     abs_n2,
+                                     vmr,
+                                     verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    Rosenkranz_CO2_foreign_continuum(pxsec,
+                                     0.00,
+                                     0.00,
+                                     model,
+                                     f_grid,
+                                     abs_p,
+                                     abs_t,
+                                     abs_n2,
+                                     vmr,
+                                     verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters. "
+       << "\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
+}
 
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("CO2-SelfContPWR93" == name) {
-    // data information about this continuum:
-    // P. W. Rosenkranz Chapter 2, pp 74, in M. A. Janssen,
-    // "Atmospheric Remote Sensing by Microwave Radiometry",
-    // John Wiley & Sons, Inc., 1993, ISBN 0-471-62891-3
-    //
-    // specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum strength coefficient [1/m * 1/(Hz*Pa)]
-    //     parameters[1] : continuum temperature exponent  [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    const int Nparam = 2;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      Rosenkranz_CO2_self_continuum(pxsec,
-                                    parameters[0],  // coefficient
-                                    parameters[1],  // temp. exponent
-                                    model,
-                                    f_grid,
-                                    abs_p,
-                                    abs_t,
-                                    vmr,
-                                    verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      Rosenkranz_CO2_self_continuum(
-          pxsec, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters. "
-         << "\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_CO2_SelfContHo66(MatrixView pxsec,
+                                   const String &name,
+                                   ConstVectorView parameters,
+                                   const String &model,
+                                   ConstVectorView f_grid,
+                                   ConstVectorView abs_p,
+                                   ConstVectorView abs_t,
+                                   ConstVectorView,
+                                   ConstVectorView,
+                                   ConstVectorView,
+                                   ConstVectorView vmr,
+                                   const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // data information about this continuum:
+  // Reference: Ho, Kaufman and Thaddeus, "Laboratory measurements of
+  // microwave absorption in models of the atmosphere of Venus", JGR, 1966.
+  //
+  // specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum strength coefficient [1/m * 1/(Hz*Pa)]
+  //     parameters[1] : continuum temperature exponent  [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  const int Nparam = 2;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    Ho66_CO2_self_continuum(pxsec,
+                            parameters[0],  // coefficient
+                            parameters[1],  // temp. exponent
+                            model,
+                            f_grid,
+                            abs_p,
+                            abs_t,
+                            vmr,
+                            verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    Ho66_CO2_self_continuum(
+        pxsec, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters. "
+       << "\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("CO2-ForeignContPWR93" == name) {
-    // data information about this continuum:
-    // P. W. Rosenkranz Chapter 2, pp 74, in M. A. Janssen,
-    // "Atmospheric Remote Sensing by Microwave Radiometry",
-    // John Wiley & Sons, Inc., 1993, ISBN 0-471-62891-3
-    //
-    // specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum strength coefficient [1/m * 1/(Hz*Pa)]
-    //     parameters[1] : continuum temperature exponent  [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     abs_n2        : [1]
-    //     vmr           : [1]
-    //
-
-    if (abs_n2.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires N2-vmr, but no tag group contains N2!";
-      throw runtime_error(os.str());
-    }
+}
 
-    const int Nparam = 2;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      Rosenkranz_CO2_foreign_continuum(pxsec,
-                                       parameters[0],
-                                       parameters[1],
-                                       model,
-                                       f_grid,
-                                       abs_p,
-                                       abs_t,
-                                       abs_n2,
-                                       vmr,
-                                       verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      Rosenkranz_CO2_foreign_continuum(pxsec,
-                                       0.00,
-                                       0.00,
-                                       model,
-                                       f_grid,
-                                       abs_p,
-                                       abs_t,
-                                       abs_n2,
-                                       vmr,
-                                       verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters. "
-         << "\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
-  }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("CO2-SelfContHo66" == name) {
-    // data information about this continuum:
-    // Reference: Ho, Kaufman and Thaddeus, "Laboratory measurements of
-    // microwave absorption in models of the atmosphere of Venus", JGR, 1966.
-    //
-    // specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum strength coefficient [1/m * 1/(Hz*Pa)]
-    //     parameters[1] : continuum temperature exponent  [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    const int Nparam = 2;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      Ho66_CO2_self_continuum(pxsec,
-                              parameters[0],  // coefficient
-                              parameters[1],  // temp. exponent
-                              model,
-                              f_grid,
-                              abs_p,
-                              abs_t,
-                              vmr,
-                              verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      Ho66_CO2_self_continuum(
-          pxsec, 0.00, 0.00, model, f_grid, abs_p, abs_t, vmr, verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters. "
-         << "\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
-  }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  else if ("CO2-ForeignContHo66" == name) {
-    // data information about this continuum:
-    // Reference: Ho, Kaufman and Thaddeus, "Laboratory measurements of
-    // microwave absorption in models of the atmosphere of Venus", JGR, 1966.
-    //
-    // specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : continuum strength coefficient [1/m * 1/(Hz*Pa)]
-    //     parameters[1] : continuum temperature exponent  [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     abs_n2        : [1]
-    //     vmr           : [1]
-    //
-
-    if (abs_n2.sum() < -1.) {
-      ostringstream os;
-      os << "Continuum/full model tag " << name
-         << " requires N2-vmr, but no tag group contains N2!";
-      throw runtime_error(os.str());
-    }
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void pxsec_CO2_ForeignContHo66(MatrixView pxsec,
+                                      const String &name,
+                                      ConstVectorView parameters,
+                                      const String &model,
+                                      ConstVectorView f_grid,
+                                      ConstVectorView abs_p,
+                                      ConstVectorView abs_t,
+                                      ConstVectorView abs_n2,
+                                      ConstVectorView,
+                                      ConstVectorView,
+                                      ConstVectorView vmr,
+                                      const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // data information about this continuum:
+  // Reference: Ho, Kaufman and Thaddeus, "Laboratory measurements of
+  // microwave absorption in models of the atmosphere of Venus", JGR, 1966.
+  //
+  // specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : continuum strength coefficient [1/m * 1/(Hz*Pa)]
+  //     parameters[1] : continuum temperature exponent  [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     abs_n2        : [1]
+  //     vmr           : [1]
+  //
 
-    const int Nparam = 2;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "Continuum model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      Ho66_CO2_foreign_continuum(pxsec,
-                                 parameters[0],
-                                 parameters[1],
-                                 model,
-                                 f_grid,
-                                 abs_p,
-                                 abs_t,
-                                 abs_n2,
-                                 vmr,
-                                 verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "Continuum model " << name << " requires " << Nparam << " input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "Continuum model " << name << " running with \n"
-           << "the parameters for model " << model << ".\n";
-      Ho66_CO2_foreign_continuum(pxsec,
-                                 0.00,
-                                 0.00,
-                                 model,
-                                 f_grid,
-                                 abs_p,
-                                 abs_t,
-                                 abs_n2,
-                                 vmr,
-                                 verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: Continuum model " << name << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters. "
-         << "\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 3.\n";
-      throw runtime_error(os.str());
-    }
+  if (abs_n2.sum() < -1.) {
+    ostringstream os;
+    os << "Continuum/full model tag " << name
+       << " requires N2-vmr, but no tag group contains N2!";
+    throw runtime_error(os.str());
   }
-  // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-  // ============= cloud and fog absorption from MPM93 ==================================
-  else if ("liquidcloud-MPM93" == name) {
-    // Suspended water droplet absorption parameterization from MPM93 model
-    // H. J. Liebe and G. A. Hufford and M. G. Cotton,
-    // "Propagation modeling of moist air and suspended water/ice
-    //  particles at frequencies below 1000 GHz",
-    // AGARD 52nd Specialists Meeting of the Electromagnetic Wave
-    // Propagation Panel, Palma de Mallorca, Spain, 1993, May 17-21
-    //
-    // specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : [1]
-    //     parameters[1] : [1]
-    //     parameters[2] : [1]
-    //     model        : [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    // liquid water droplet parameters:
-    // suspended water droplet density   range: 0-5 g/m
-    //
-    // valid atmospheric condition:
-    // temperature      : 210 to 373 K
-    //
-    for (Index s = 0; s < f_grid.nelem(); ++s) {
-      if (f_grid[s] > 1e12) {
-        ostringstream os;
-        os << "Liquid cloud absorption model MPM93 only valid at\n"
-              "frequencies up to 1THz. Yours are above.";
-        throw runtime_error(os.str());
-      }
-    }
-    for (Index s = 0; s < abs_t.nelem(); ++s) {
-      if ((abs_t[s] < 210. || abs_t[s] > 373.) &&
-          abs(vmr[s]) > LIQUID_AND_ICE_TREAT_AS_ZERO) {
-        ostringstream os;
-        os << "Liquid cloud absorption model MPM93 only valid at\n"
-           << "temperatures between 210 and 373K.\n"
-           << "LWC values outside this temperature range must be < "
-           << LIQUID_AND_ICE_TREAT_AS_ZERO << " kg/m3.\n"
-           << "Your value at " << abs_t[s] << "K is: " << vmr[s] << " kg/m3.";
-        throw runtime_error(os.str());
-      }
-    }
 
-    const int Nparam = 3;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // --------------------
-    {
-      MPM93WaterDropletAbs(pxsec,
-                           parameters[0],  // scaling factror
-                           parameters[1],  // scaling factror
-                           parameters[2],  // scaling factror
-                           model,          // model option
-                           f_grid,
-                           abs_p,
-                           abs_t,
-                           vmr,
-                           verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
-      ostringstream os;
-      os << "MPM93 liquid water cloud absorption model " << name
-         << " requires\n"
-         << Nparam << " input parameter for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "MPM93 liquid water cloud absorption model " << name
-           << " running with \n"
-           << "the parameter for model " << model << ".\n";
-      MPM93WaterDropletAbs(pxsec,
-                           0.000,  // scaling factror
-                           0.000,  // scaling factror
-                           0.000,  // scaling factror
-                           model,  // model option
-                           f_grid,
-                           abs_p,
-                           abs_t,
-                           vmr,
-                           verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
-      ostringstream os;
-      os << "ERROR: MPM93 liquid water cloud absorption model " << name
-         << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 4.\n";
-      throw runtime_error(os.str());
-    }
+  const int Nparam = 2;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "Continuum model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    Ho66_CO2_foreign_continuum(pxsec,
+                               parameters[0],
+                               parameters[1],
+                               model,
+                               f_grid,
+                               abs_p,
+                               abs_t,
+                               abs_n2,
+                               vmr,
+                               verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "Continuum model " << name << " requires " << Nparam << " input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "Continuum model " << name << " running with \n"
+         << "the parameters for model " << model << ".\n";
+    Ho66_CO2_foreign_continuum(pxsec,
+                               0.00,
+                               0.00,
+                               model,
+                               f_grid,
+                               abs_p,
+                               abs_t,
+                               abs_n2,
+                               vmr,
+                               verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: Continuum model " << name << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters. "
+       << "\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 3.\n";
+    throw runtime_error(os.str());
   }
+}
 
-  // ============= cloud and fog absorption from ELL07 ================================
-  else if ("liquidcloud-ELL07" == name) {
-    // Suspended water droplet absorption parameterization from ELL07 model
-    // W. J. Ellison
-    // "Permittivity of Pure Water, at Standard Atmospheric Pressure, over the
-    //  Frequency Range 0-25 THz and Temperature Range 0-100C"
-    // J. Phys. Chem. Ref. Data, Vol. 36, No. 1, 2007
-
-    // specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     model        : [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    // liquid water droplet parameters:
-    // suspended water droplet density   range: 0-5 g/m
-    //
-    // valid atmospheric condition:
-    // temperature      : 210 to 373 K
-    //
-    for (Index s = 0; s < f_grid.nelem(); ++s) {
-      if (f_grid[s] > 25e12) {
-        ostringstream os;
-        os << "Liquid cloud absorption model ELL07 only valid at\n"
-              "frequencies up to 25THz. Yours are above.";
-        throw runtime_error(os.str());
-      }
-    }
-    for (Index s = 0; s < abs_t.nelem(); ++s) {
-      if ((abs_t[s] < 210. || abs_t[s] > 373.) &&
-          abs(vmr[s]) > LIQUID_AND_ICE_TREAT_AS_ZERO) {
-        ostringstream os;
-        os << "Liquid cloud absorption model ELL07 only valid at\n"
-           << "temperatures between 210 and 373K.\n"
-           << "LWC values outside this temperature range must be < "
-           << LIQUID_AND_ICE_TREAT_AS_ZERO << " kg/m3.\n"
-           << "Your value at " << abs_t[s] << "K is: " << vmr[s] << " kg/m3.";
-        throw runtime_error(os.str());
-      }
-    }
-
-    if ((model == "ELL07") &&
-        (parameters.nelem() == 0))  // --------------------
-    {
-      ELL07WaterDropletAbs(pxsec,
-                           model,  // model option
-                           f_grid,
-                           abs_p,
-                           abs_t,
-                           vmr,
-                           verbosity);
-    } else if ((model == "ELL07") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
+// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// ============= cloud and fog absorption from MPM93 ==================================
+static void pxsec_liquidcloud_MPM93(MatrixView pxsec,
+                                    const String &name,
+                                    ConstVectorView parameters,
+                                    const String &model,
+                                    ConstVectorView f_grid,
+                                    ConstVectorView abs_p,
+                                    ConstVectorView abs_t,
+                                    ConstVectorView,
+                                    ConstVectorView,
+                                    ConstVectorView,
+                                    ConstVectorView vmr,
+                                    const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // Suspended water droplet absorption parameterization from MPM93 model
+  // H. J. Liebe and G. A. Hufford and M. G. Cotton,
+  // "Propagation modeling of moist air and suspended water/ice
+  //  particles at frequencies below 1000 GHz",
+  // AGARD 52nd Specialists Meeting of the Electromagnetic Wave
+  // Propagation Panel, Palma de Mallorca, Spain, 1993, May 17-21
+  //
+  // specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : [1]
+  //     parameters[1] : [1]
+  //     parameters[2] : [1]
+  //     model        : [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  // liquid water droplet parameters:
+  // suspended water droplet density   range: 0-5 g/m
+  //
+  // valid atmospheric condition:
+  // temperature      : 210 to 373 K
+  //
+  for (Index s = 0; s < f_grid.nelem(); ++s) {
+    if (f_grid[s] > 1e12) {
       ostringstream os;
-      os << "ERROR: ELL07 liquid water cloud absorption model " << name
-         << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 4.";
+      os << "Liquid cloud absorption model MPM93 only valid at\n"
+            "frequencies up to 1THz. Yours are above.";
       throw runtime_error(os.str());
-    } else {
+    }
+  }
+  for (Index s = 0; s < abs_t.nelem(); ++s) {
+    if ((abs_t[s] < 210. || abs_t[s] > 373.) &&
+        abs(vmr[s]) > LIQUID_AND_ICE_TREAT_AS_ZERO) {
       ostringstream os;
-      os << "ERROR: ELL07 liquid water cloud absorption model " << name
-         << " has no model " << model;
+      os << "Liquid cloud absorption model MPM93 only valid at\n"
+         << "temperatures between 210 and 373K.\n"
+         << "LWC values outside this temperature range must be < "
+         << LIQUID_AND_ICE_TREAT_AS_ZERO << " kg/m3.\n"
+         << "Your value at " << abs_t[s] << "K is: " << vmr[s] << " kg/m3.";
       throw runtime_error(os.str());
     }
   }
 
-  // ============= ice particle absorption from MPM93 ===================================
-  else if ("icecloud-MPM93" == name) {
-    // Ice particle absorption parameterization from MPM93 model
-    // H. J. Liebe and G. A. Hufford and M. G. Cotton,
-    // "Propagation modeling of moist air and suspended water/ice
-    //  particles at frequencies below 1000 GHz",
-    // AGARD 52nd Specialists Meeting of the Electromagnetic Wave
-    // Propagation Panel, Palma de Mallorca, Spain, 1993, May 17-21
-    //
-    // specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : [1]
-    //     parameters[1] : [1]
-    //     parameters[2] : [1]
-    //     model        : [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [1]
-    //
-    // ice crystal parameters:
-    // suspended water droplet density   range: 0-10 g/m
-    // specific droplet weight           value:    1 g/cm
-    //
-    // valid atmospheric condition:
-    // temperature      : 233 to 323 K
-    // relative humidity:   1 to 100 %
-    //
-    for (Index s = 0; s < f_grid.nelem(); ++s) {
-      if (f_grid[s] > 1e12) {
-        ostringstream os;
-        os << "Ice cloud absorption model MPM93 only valid at\n"
-              "frequencies up to 1THz. Yours are above.";
-        throw runtime_error(os.str());
-      }
-    }
-
-    const int Nparam = 3;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // ---------------------
-    {
-      MPM93IceCrystalAbs(pxsec,
+  const int Nparam = 3;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // --------------------
+  {
+    MPM93WaterDropletAbs(pxsec,
                          parameters[0],  // scaling factror
                          parameters[1],  // scaling factror
                          parameters[2],  // scaling factror
@@ -20221,18 +20743,22 @@ void xsec_continuum_tag(MatrixView xsec,
                          abs_t,
                          vmr,
                          verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // ----------------
-    {
-      ostringstream os;
-      os << "MPM93 ice water cloud absorption model " << name << " requires \n"
-         << Nparam << " input parameter for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
-      throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      MPM93IceCrystalAbs(pxsec,
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "MPM93 liquid water cloud absorption model " << name
+       << " requires\n"
+       << Nparam << " input parameter for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "MPM93 liquid water cloud absorption model " << name
+         << " running with \n"
+         << "the parameter for model " << model << ".\n";
+    MPM93WaterDropletAbs(pxsec,
                          0.000,  // scaling factror
                          0.000,  // scaling factror
                          0.000,  // scaling factror
@@ -20242,112 +20768,380 @@ void xsec_continuum_tag(MatrixView xsec,
                          abs_t,
                          vmr,
                          verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: MPM93 liquid water cloud absorption model " << name
+       << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 4.\n";
+    throw runtime_error(os.str());
+  }
+}
+
+// ============= cloud and fog absorption from ELL07 ================================
+static void pxsec_liquidcloud_ELL07(MatrixView pxsec,
+                                    const String &name,
+                                    ConstVectorView parameters,
+                                    const String &model,
+                                    ConstVectorView f_grid,
+                                    ConstVectorView abs_p,
+                                    ConstVectorView abs_t,
+                                    ConstVectorView,
+                                    ConstVectorView,
+                                    ConstVectorView,
+                                    ConstVectorView vmr,
+                                    const Verbosity &verbosity) {
+  // Suspended water droplet absorption parameterization from ELL07 model
+  // W. J. Ellison
+  // "Permittivity of Pure Water, at Standard Atmospheric Pressure, over the
+  //  Frequency Range 0-25 THz and Temperature Range 0-100C"
+  // J. Phys. Chem. Ref. Data, Vol. 36, No. 1, 2007
+
+  // specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     model        : [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  // liquid water droplet parameters:
+  // suspended water droplet density   range: 0-5 g/m
+  //
+  // valid atmospheric condition:
+  // temperature      : 210 to 373 K
+  //
+  for (Index s = 0; s < f_grid.nelem(); ++s) {
+    if (f_grid[s] > 25e12) {
       ostringstream os;
-      os << "ERROR: MPM93 ice water cloud absorption model " << name
-         << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 4.\n";
+      os << "Liquid cloud absorption model ELL07 only valid at\n"
+            "frequencies up to 25THz. Yours are above.";
       throw runtime_error(os.str());
     }
   }
-
-  // ============= rain extinction from MPM93 ===========================================
-  else if ("rain-MPM93" == name) {
-    // Rain extinction parameterization from MPM93 model, described in
-    //  H. J. Liebe,
-    //  "MPM - An Atmospheric Millimeter-Wave Propagation Model",
-    //  Int. J. Infrared and Millimeter Waves, vol. 10(6),
-    //  pp. 631-650, 1989
-    // and based on
-    //  Olsen, R.L., D.V. Rogers, and D. B. Hodge, "The aR^b relation in the
-    //  calculation of rain attenuation", IEEE Trans. Antennas Propagat.,
-    // vol. AP-26, pp. 318-329, 1978.
-    //
-    // specific continuum parameters and units:
-    //  OUTPUT
-    //     pxsec          : [1/m],
-    //  INPUT
-    //     parameters[0] : [1]
-    //     parameters[1] : [1]
-    //     parameters[2] : [1]
-    //     model         : [1]
-    //     f_grid        : [Hz]
-    //     abs_p         : [Pa]
-    //     abs_t         : [K]
-    //     vmr           : [kg/m2/s]
-    //
-    // rain parameters:
-    // rain rate                         range: 0-150 mm/h (=0-0.42 kg/m2/s)
-    //
-    // valid atmospheric condition:
-    // temperature      : (preferably above 273 K...)
-    //
-    for (Index s = 0; s < f_grid.nelem(); ++s) {
-      if (f_grid[s] > 1e12) {
-        ostringstream os;
-        os << "Rain absorption model MPM93 only valid at\n"
-              "frequencies up to 1THz. Yours is above.";
-        throw runtime_error(os.str());
-      }
+  for (Index s = 0; s < abs_t.nelem(); ++s) {
+    if ((abs_t[s] < 210. || abs_t[s] > 373.) &&
+        abs(vmr[s]) > LIQUID_AND_ICE_TREAT_AS_ZERO) {
+      ostringstream os;
+      os << "Liquid cloud absorption model ELL07 only valid at\n"
+         << "temperatures between 210 and 373K.\n"
+         << "LWC values outside this temperature range must be < "
+         << LIQUID_AND_ICE_TREAT_AS_ZERO << " kg/m3.\n"
+         << "Your value at " << abs_t[s] << "K is: " << vmr[s] << " kg/m3.";
+      throw runtime_error(os.str());
     }
-    const int Nparam = 3;
-    if ((model == "user") &&
-        (parameters.nelem() == Nparam))  // -------------------------
-    {
-      out3 << "MPM93 rain extinction model " << name << " is running with \n"
-           << "user defined parameters according to model " << model << ".\n";
-      MPM93RainExt(pxsec,
-                   parameters[0],  // scaling factor
-                   parameters[1],  // scaling factor
-                   parameters[2],  // scaling factor
-                   model,          // model option
-                   f_grid,
-                   abs_p,
-                   abs_t,
-                   vmr,
-                   verbosity);
-    } else if ((model == "user") &&
-               (parameters.nelem() != Nparam))  // --------------------
-    {
+  }
+
+  if ((model == "ELL07") &&
+      (parameters.nelem() == 0))  // --------------------
+  {
+    ELL07WaterDropletAbs(pxsec,
+                         model,  // model option
+                         f_grid,
+                         abs_p,
+                         abs_t,
+                         vmr,
+                         verbosity);
+  } else if ((model == "ELL07") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: ELL07 liquid water cloud absorption model " << name
+       << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 4.";
+    throw runtime_error(os.str());
+  } else {
+    ostringstream os;
+    os << "ERROR: ELL07 liquid water cloud absorption model " << name
+       << " has no model " << model;
+    throw runtime_error(os.str());
+  }
+}
+
+// ============= ice particle absorption from MPM93 ===================================
+static void pxsec_icecloud_MPM93(MatrixView pxsec,
+                                 const String &name,
+                                 ConstVectorView parameters,
+                                 const String &model,
+                                 ConstVectorView f_grid,
+                                 ConstVectorView abs_p,
+                                 ConstVectorView abs_t,
+                                 ConstVectorView,
+                                 ConstVectorView,
+                                 ConstVectorView,
+                                 ConstVectorView vmr,
+                                 const Verbosity &verbosity) {
+  // Ice particle absorption parameterization from MPM93 model
+  // H. J. Liebe and G. A. Hufford and M. G. Cotton,
+  // "Propagation modeling of moist air and suspended water/ice
+  //  particles at frequencies below 1000 GHz",
+  // AGARD 52nd Specialists Meeting of the Electromagnetic Wave
+  // Propagation Panel, Palma de Mallorca, Spain, 1993, May 17-21
+  //
+  // specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : [1]
+  //     parameters[1] : [1]
+  //     parameters[2] : [1]
+  //     model        : [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [1]
+  //
+  // ice crystal parameters:
+  // suspended water droplet density   range: 0-10 g/m
+  // specific droplet weight           value:    1 g/cm
+  //
+  // valid atmospheric condition:
+  // temperature      : 233 to 323 K
+  // relative humidity:   1 to 100 %
+  //
+  for (Index s = 0; s < f_grid.nelem(); ++s) {
+    if (f_grid[s] > 1e12) {
       ostringstream os;
-      os << "MPM93 rain extinction model  " << name << " requires \n"
-         << Nparam << " input parameter for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n";
+      os << "Ice cloud absorption model MPM93 only valid at\n"
+            "frequencies up to 1THz. Yours are above.";
       throw runtime_error(os.str());
-    } else if ((model != "user") &&
-               (parameters.nelem() == 0))  // --------------------
-    {
-      out3 << "MPM93 rain extinction model " << name << " running with \n"
-           << "the parameter for model " << model << ".\n";
-      MPM93RainExt(pxsec,
-                   0.000,  // scaling factor
-                   0.000,  // scaling factor
-                   0.000,  // scaling factor
-                   model,  // model option
-                   f_grid,
-                   abs_p,
-                   abs_t,
-                   vmr,
-                   verbosity);
-    } else if ((model != "user") &&
-               (parameters.nelem() != 0))  // --------------------
-    {
+    }
+  }
+
+  const int Nparam = 3;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // ---------------------
+  {
+    MPM93IceCrystalAbs(pxsec,
+                       parameters[0],  // scaling factror
+                       parameters[1],  // scaling factror
+                       parameters[2],  // scaling factror
+                       model,          // model option
+                       f_grid,
+                       abs_p,
+                       abs_t,
+                       vmr,
+                       verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // ----------------
+  {
+    ostringstream os;
+    os << "MPM93 ice water cloud absorption model " << name << " requires \n"
+       << Nparam << " input parameter for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    MPM93IceCrystalAbs(pxsec,
+                       0.000,  // scaling factror
+                       0.000,  // scaling factror
+                       0.000,  // scaling factror
+                       model,  // model option
+                       f_grid,
+                       abs_p,
+                       abs_t,
+                       vmr,
+                       verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
+  {
+    ostringstream os;
+    os << "ERROR: MPM93 ice water cloud absorption model " << name
+       << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 4.\n";
+    throw runtime_error(os.str());
+  }
+}
+
+// ============= rain extinction from MPM93 ===========================================
+static void pxsec_rain_MPM93(MatrixView pxsec,
+                             const String &name,
+                             ConstVectorView parameters,
+                             const String &model,
+                             ConstVectorView f_grid,
+                             ConstVectorView abs_p,
+                             ConstVectorView abs_t,
+                             ConstVectorView,
+                             ConstVectorView,
+                             ConstVectorView,
+                             ConstVectorView vmr,
+                             const Verbosity &verbosity) {
+  CREATE_OUT3;
+  // Rain extinction parameterization from MPM93 model, described in
+  //  H. J. Liebe,
+  //  "MPM - An Atmospheric Millimeter-Wave Propagation Model",
+  //  Int. J. Infrared and Millimeter Waves, vol. 10(6),
+  //  pp. 631-650, 1989
+  // and based on
+  //  Olsen, R.L., D.V. Rogers, and D. B. Hodge, "The aR^b relation in the
+  //  calculation of rain attenuation", IEEE Trans. Antennas Propagat.,
+  // vol. AP-26, pp. 318-329, 1978.
+  //
+  // specific continuum parameters and units:
+  //  OUTPUT
+  //     pxsec          : [1/m],
+  //  INPUT
+  //     parameters[0] : [1]
+  //     parameters[1] : [1]
+  //     parameters[2] : [1]
+  //     model         : [1]
+  //     f_grid        : [Hz]
+  //     abs_p         : [Pa]
+  //     abs_t         : [K]
+  //     vmr           : [kg/m2/s]
+  //
+  // rain parameters:
+  // rain rate                         range: 0-150 mm/h (=0-0.42 kg/m2/s)
+  //
+  // valid atmospheric condition:
+  // temperature      : (preferably above 273 K...)
+  //
+  for (Index s = 0; s < f_grid.nelem(); ++s) {
+    if (f_grid[s] > 1e12) {
       ostringstream os;
-      os << "ERROR: MPM93 rain extinction model " << name
-         << " requires NO input\n"
-         << "parameters for the model " << model << ",\n"
-         << "but you specified " << parameters.nelem() << " parameters.\n"
-         << "This ambiguity can not be solved by arts.\n"
-         << "Please see the arts user guide chapter 4.\n";
+      os << "Rain absorption model MPM93 only valid at\n"
+            "frequencies up to 1THz. Yours is above.";
       throw runtime_error(os.str());
     }
-  } else  // -----------------------------------------------------------------------
+  }
+  const int Nparam = 3;
+  if ((model == "user") &&
+      (parameters.nelem() == Nparam))  // -------------------------
+  {
+    out3 << "MPM93 rain extinction model " << name << " is running with \n"
+         << "user defined parameters according to model " << model << ".\n";
+    MPM93RainExt(pxsec,
+                 parameters[0],  // scaling factor
+                 parameters[1],  // scaling factor
+                 parameters[2],  // scaling factor
+                 model,          // model option
+                 f_grid,
+                 abs_p,
+                 abs_t,
+                 vmr,
+                 verbosity);
+  } else if ((model == "user") &&
+             (parameters.nelem() != Nparam))  // --------------------
+  {
+    ostringstream os;
+    os << "MPM93 rain extinction model  " << name << " requires \n"
+       << Nparam << " input parameter for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n";
+    throw runtime_error(os.str());
+  } else if ((model != "user") &&
+             (parameters.nelem() == 0))  // --------------------
+  {
+    out3 << "MPM93 rain extinction model " << name << " running with \n"
+         << "the parameter for model " << model << ".\n";
+    MPM93RainExt(pxsec,
+                 0.000,  // scaling factor
+                 0.000,  // scaling factor
+                 0.000,  // scaling factor
+                 model,  // model option
+                 f_grid,
+                 abs_p,
+                 abs_t,
+                 vmr,
+                 verbosity);
+  } else if ((model != "user") &&
+             (parameters.nelem() != 0))  // --------------------
   {
+    ostringstream os;
+    os << "ERROR: MPM93 rain extinction model " << name
+       << " requires NO input\n"
+       << "parameters for the model " << model << ",\n"
+       << "but you specified " << parameters.nelem() << " parameters.\n"
+       << "This ambiguity can not be solved by arts.\n"
+       << "Please see the arts user guide chapter 4.\n";
+    throw runtime_error(os.str());
+  }
+}
+
+/**
+   Finds the function for a continuum or full model tag.
+
+   \param  name  The name of the model (derived from the tag name)
+
+   \return The function calculating the pseudo cross sections of the model.
+
+   \throw runtime_error The model is not implemented.
+ */
+ContinuumTagFunction continuum_tag_function(const String &name) {
+  static const std::map<String, ContinuumTagFunction> functions{
+      {"H2O-SelfContStandardType", pxsec_H2O_SelfContStandardType},
+      {"H2O-ForeignContStandardType", pxsec_H2O_ForeignContStandardType},
+      {"H2O-ForeignContMaTippingType", pxsec_H2O_ForeignContMaTippingType},
+      {"H2O-ContMPM93", pxsec_H2O_ContMPM93},
+      {"H2O-ForeignContATM01", pxsec_H2O_ForeignContATM01},
+      {"H2O-SelfContCKD222", pxsec_H2O_SelfContCKD222},
+      {"H2O-ForeignContCKD222", pxsec_H2O_ForeignContCKD222},
+      {"H2O-SelfContCKD242", pxsec_H2O_SelfContCKD242},
+      {"H2O-ForeignContCKD242", pxsec_H2O_ForeignContCKD242},
+      {"H2O-SelfContCKDMT100", pxsec_H2O_SelfContCKDMT100},
+      {"H2O-ForeignContCKDMT100", pxsec_H2O_ForeignContCKDMT100},
+      {"H2O-SelfContCKDMT252", pxsec_H2O_SelfContCKDMT252},
+      {"H2O-ForeignContCKDMT252", pxsec_H2O_ForeignContCKDMT252},
+      {"H2O-SelfContCKDMT320", pxsec_H2O_SelfContCKDMT320},
+      {"H2O-ForeignContCKDMT320", pxsec_H2O_ForeignContCKDMT320},
+      {"H2O-SelfContCKD24", pxsec_H2O_SelfContCKD24},
+      {"H2O-ForeignContCKD24", pxsec_H2O_ForeignContCKD24},
+      {"H2O-CP98", pxsec_H2O_CP98},
+      {"H2O-MPM87", pxsec_H2O_MPM87},
+      {"H2O-MPM89", pxsec_H2O_MPM89},
+      {"H2O-MPM93", pxsec_H2O_MPM93},
+      {"H2O-PWR98", pxsec_H2O_PWR98},
+      {"O2-CIAfunCKDMT100", pxsec_O2_CIAfunCKDMT100},
+      {"O2-v0v0CKDMT100", pxsec_O2_v0v0CKDMT100},
+      {"O2-v1v0CKDMT100", pxsec_O2_v1v0CKDMT100},
+      {"O2-visCKDMT252", pxsec_O2_visCKDMT252},
+      {"O2-SelfContStandardType", pxsec_O2_SelfContStandardType},
+      {"O2-SelfContMPM93", pxsec_O2_SelfContMPM93},
+      {"O2-SelfContPWR93", pxsec_O2_SelfContPWR93},
+      {"O2-PWR88", pxsec_O2_PWR88},
+      {"O2-PWR93", pxsec_O2_PWR93},
+      {"O2-PWR98", pxsec_O2_PWR98},
+      {"O2-MPM93", pxsec_O2_MPM93},
+      {"O2-TRE05", pxsec_O2_TRE05},
+      {"O2-MPM92", pxsec_O2_MPM92},
+      {"O2-MPM89", pxsec_O2_MPM89},
+      {"O2-MPM87", pxsec_O2_MPM87},
+      {"O2-MPM85", pxsec_O2_MPM85},
+      {"N2-SelfContMPM93", pxsec_N2_SelfContMPM93},
+      {"N2-DryContATM01", pxsec_N2_DryContATM01},
+      {"N2-SelfContPWR93", pxsec_N2_SelfContPWR93},
+      {"N2-SelfContStandardType", pxsec_N2_SelfContStandardType},
+      {"N2-SelfContBorysow", pxsec_N2_SelfContBorysow},
+      {"N2-CIArotCKDMT100", pxsec_N2_CIArotCKDMT100},
+      {"N2-CIAfunCKDMT100", pxsec_N2_CIAfunCKDMT100},
+      {"N2-CIArotCKDMT252", pxsec_N2_CIArotCKDMT252},
+      {"N2-CIAfunCKDMT252", pxsec_N2_CIAfunCKDMT252},
+      {"CO2-CKD241", pxsec_CO2_CKD241},
+      {"CO2-CKDMT100", pxsec_CO2_CKDMT100},
+      {"CO2-CKDMT252", pxsec_CO2_CKDMT252},
+      {"CO2-SelfContPWR93", pxsec_CO2_SelfContPWR93},
+      {"CO2-ForeignContPWR93", pxsec_CO2_ForeignContPWR93},
+      {"CO2-SelfContHo66", pxsec_CO2_SelfContHo66},
+      {"CO2-ForeignContHo66", pxsec_CO2_ForeignContHo66},
+      {"liquidcloud-MPM93", pxsec_liquidcloud_MPM93},
+      {"liquidcloud-ELL07", pxsec_liquidcloud_ELL07},
+      {"icecloud-MPM93", pxsec_icecloud_MPM93},
+      {"rain-MPM93", pxsec_rain_MPM93}};
+
+  const auto it = functions.find(name);
+  if (it == functions.end()) {
     // none of the continuum or full model tags were selected -> error message.
     ostringstream os;
     os << "ERROR: Continuum/ full model tag `" << name
@@ -20355,6 +21149,80 @@ void xsec_continuum_tag(MatrixView xsec,
     throw runtime_error(os.str());
   }
 
+  return it->second;
+}
+
+/**
+    Calculates model absorption for one continuum or full model tag.
+    Note, that only one tag can be taken at a time.
+
+    Calculated is the true absorption cross section, that means you have to
+    multiply this with n*VMR in order to get the absorption
+    coefficient in units of 1/m.
+
+    This is the type of xsec that is used all over ARTS, but not what
+    is used by the internal continuum functions! (We have to divide
+    the output of the internal continuum functions by the number
+    density n.)
+
+    \retval xsec       Cross section of one continuum tag,<br>
+                       xsec = alpha / (n*VMR)  [m^2]. This is both input
+                       and output! (The function adds the continuum
+                       absorption cross section to the previous
+                       content of xsec.)
+
+    \param  function   The function of the model, from continuum_tag_function
+    \param  name       The name of the model to calculate (derived from the tag name)
+    \param  parameters model parameters, as defined in method
+                       abs_cont_parameters.
+    \param  model      model, related to model parameters
+    \param  f_grid     Frequency grid [Hz]
+    \param  abs_p      Pressure grid [Pa]
+    \param  abs_t      Temperatures associated with the pressure grid, abs_p [K]
+    \param  abs_n2     Total volume mixing ratio profile of molecular nitrogen.<br>
+                       This will be needed only for the CO2 foreign continuum [1]<br>
+                       however one is forced to give this input [1]
+    \param  abs_h2o    Total volume mixing ratio profile of water vapor.<br>
+                       This will be needed only for the oxygen continuum <br>
+                       however one is forced to give this input [1]
+    \param  vmr        Volume mixing ratio profile of the actual species [1]
+
+   \author Stefan Buehler, Thomas Kuhn
+   \date 2001-11-05
+ */
+void xsec_continuum_tag(MatrixView xsec,
+                        ContinuumTagFunction function,
+                        const String &name,
+                        ConstVectorView parameters,
+                        const String &model,
+                        ConstVectorView f_grid,
+                        ConstVectorView abs_p,
+                        ConstVectorView abs_t,
+                        ConstVectorView abs_n2,
+                        ConstVectorView abs_h2o,
+                        ConstVectorView abs_o2,
+                        ConstVectorView vmr,
+                        const Verbosity &verbosity) {
+  // Set up a lokal variable pxsec for the pseudo cross sections, that
+  // are used by the internal contiuum functions. It is important that
+  // we also inititialize this to zero here, since the continuum
+  // routines just add to this.
+  // The dimensions of this are [n_frequencies,n_pressures].
+  Matrix pxsec(xsec.nrows(), xsec.ncols(), 0.0);
+
+  function(pxsec,
+           name,
+           parameters,
+           model,
+           f_grid,
+           abs_p,
+           abs_t,
+           abs_n2,
+           abs_h2o,
+           abs_o2,
+           vmr,
+           verbosity);
+
   // We have to divide the result from the internal continuum model by
   // the number density n to convert it from pseudo cross section to a
   // true cross section.
@@ -20378,6 +21246,39 @@ void xsec_continuum_tag(MatrixView xsec,
   }
 }
 
+/**
+    Calculates model absorption for one continuum or full model tag,
+    finding the model function by its name.
+
+    See the other version of this function for the parameters.
+ */
+void xsec_continuum_tag(MatrixView xsec,
+                        const String &name,
+                        ConstVectorView parameters,
+                        const String &model,
+                        ConstVectorView f_grid,
+                        ConstVectorView abs_p,
+                        ConstVectorView abs_t,
+                        ConstVectorView abs_n2,
+                        ConstVectorView abs_h2o,
+                        ConstVectorView abs_o2,
+                        ConstVectorView vmr,
+                        const Verbosity &verbosity) {
+  xsec_continuum_tag(xsec,
+                     continuum_tag_function(name),
+                     name,
+                     parameters,
+                     model,
+                     f_grid,
+                     abs_p,
+                     abs_t,
+                     abs_n2,
+                     abs_h2o,
+                     abs_o2,
+                     vmr,
+                     verbosity);
+}
+
 // #################################################################################
 
 /**
@@ -40,6 +40,41 @@
 // entry function to all continua and full model functions
 ////////////////////////////////////////////////////////////////////////////
 
+//! Function calculating the pseudo cross sections of one continuum tag
+/*!
+  The function adds the absorption coefficient of the model to pxsec
+  [1/m], with dimensions [n_frequencies,n_pressures]. The other
+  parameters are those of xsec_continuum_tag.
+*/
+typedef void (*ContinuumTagFunction)(MatrixView pxsec,
+                                     const String& name,
+                                     ConstVectorView parameters,
+                                     const String& model,
+                                     ConstVectorView f_grid,
+                                     ConstVectorView abs_p,
+                                     ConstVectorView abs_t,
+                                     ConstVectorView abs_n2,
+                                     ConstVectorView abs_h2o,
+                                     ConstVectorView abs_o2,
+                                     ConstVectorView vmr,
+                                     const Verbosity& verbosity);
+
+ContinuumTagFunction continuum_tag_function(const String& name);
+
+void xsec_continuum_tag(MatrixView xsec,                 // calculated x-section
+                        ContinuumTagFunction function,   // model function
+                        const String& name,              // model name
+                        ConstVectorView parameters,      // model
+                        const String& model,             // model option
+                        ConstVectorView f_grid,          // frequency vector
+                        ConstVectorView abs_p,           // pressure vector
+                        ConstVectorView abs_t,           // temperature vector
+                        ConstVectorView abs_n2,          // N2 vmr profile
+                        ConstVectorView abs_h2o,         // H2O vmr profile
+                        ConstVectorView abs_o2,          // H2O vmr profile
+                        ConstVectorView vmr,             // species vmr profile
+                        const Verbosity& verbosity);
+
 void xsec_continuum_tag(MatrixView xsec,             // calculated x-section
                         const String& name,          // model name
                         ConstVectorView parameters,  // model
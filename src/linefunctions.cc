@@ -35,12 +35,117 @@
 #include "linefunctions.h"
 #include <Eigen/Core>
 #include <Faddeeva/Faddeeva.hh>
+#include <algorithm>
+#include <array>
+#include <sstream>
+#include "arts_omp.h"
 #include "constants.h"
 #include "linescaling.h"
+#include "logic.h"
 
 /** The Faddeeva function */
 inline Complex w(Complex z) noexcept { return Faddeeva::w(z); }
 
+/** Smallest argument of exp with a non-zero result */
+constexpr Numeric min_exp_argument = -745.2;
+
+/** Weideman's (1994) N = 32 parameter L = sqrt(N / sqrt(2)) */
+constexpr Numeric weideman_L = 4.756828460010884;
+
+/** Weideman's (1994) N = 32 series coefficients, highest order first */
+constexpr std::array<Numeric, 32> weideman_a{
+    -1.30317978630500875e-12, 3.74088129316536249e-12, 8.03036789996388945e-12,
+    -2.15436320778387687e-11, -5.54423594816646238e-11, 1.16582510935237737e-10,
+    4.15374309183345315e-10, -5.23102048119632885e-10, -3.20801509172336887e-09,
+    8.12488945684665156e-10, 2.37975567798974168e-08, 2.29304390650999664e-08,
+    -1.48130789151209774e-07, -4.18407637021697758e-07, 4.25583313757500854e-07,
+    4.40153173157854990e-06, 6.82103194400198485e-06, -2.14096192017107501e-05,
+    -1.30754492546153456e-04, -2.45329802700214317e-04, 3.92591360700703107e-04,
+    4.51954110534921738e-03, 1.90061557848454077e-02, 5.73044035298372195e-02,
+    1.40607162268937685e-01, 2.95444510715087316e-01, 5.46013972063934094e-01,
+    9.01925489364799882e-01, 1.34554416923454490e+00, 1.82566962963248147e+00,
+    2.26353729990026764e+00, 2.57225340812456960e+00};
+
+void Linefunctions::w_fast(Eigen::Ref<Eigen::VectorXcd> W,
+                           const Eigen::Ref<const Eigen::VectorXcd> z) noexcept {
+  const Index n = z.size();
+  if (not n) return;
+  
+  // Im(z) is the same for all z of a line shape, so the sign is checked once
+  const bool lower = z[0].imag() < 0;
+  const Numeric sgn = lower ? -1 : 1;
+  
+  for (Index i = 0; i < n; i++) {
+    const Numeric x = sgn * z[i].real();
+    const Numeric y = sgn * z[i].imag();
+    
+    if (std::abs(x) + y < 8) {
+      // Weideman: Z = (L + iz) / (L - iz), w = 2p(Z) / (L - iz)^2 + 1 / (sqrt(pi) (L - iz))
+      const Numeric dr = weideman_L + y, di = -x;
+      const Numeric inv_d2 = 1.0 / (dr * dr + di * di);
+      const Numeric ir = dr * inv_d2, ii = -di * inv_d2;
+      const Numeric nr = weideman_L - y, ni = x;
+      const Numeric Zr = nr * ir - ni * ii, Zi = nr * ii + ni * ir;
+      Numeric pr = weideman_a[0], pi = 0;
+      for (std::size_t k = 1; k < weideman_a.size(); k++) {
+        const Numeric tr = pr * Zr - pi * Zi + weideman_a[k];
+        pi = pr * Zi + pi * Zr;
+        pr = tr;
+      }
+      const Numeric i2r = ir * ir - ii * ii, i2i = 2 * ir * ii;
+      W[i] = Complex(2 * (pr * i2r - pi * i2i) + Constant::inv_sqrt_pi * ir,
+                     2 * (pr * i2i + pi * i2r) + Constant::inv_sqrt_pi * ii);
+    } else if (std::abs(x) + y > 1e7) {
+      // w = i / (sqrt(pi) z) to machine precision, scaled to avoid overflow
+      if (std::abs(x) > y) {
+        const Numeric r = y / x;
+        const Numeric d = Constant::inv_sqrt_pi / (x + r * y);
+        W[i] = Complex(r * d, d);
+      } else {
+        const Numeric r = x / y;
+        const Numeric d = Constant::inv_sqrt_pi / (r * x + y);
+        W[i] = Complex(d, r * d);
+      }
+    } else {
+      // Laplace continued fraction: w = i / (sqrt(pi) (z - (1/2) / (z - 1 / (z - ...))))
+      // evaluated forward as the ratio of its convergents B / A to avoid divisions
+      Numeric Ar = x, Ai = y, Apr = 1, Api = 0;
+      Numeric Br = 1, Bi = 0, Bpr = 0, Bpi = 0;
+      const Numeric s = std::abs(x) + y;
+      const Index K = s < 10 ? 10 : s < 50 ? 8 : 3;
+      for (Index k = 1; k <= K; k++) {
+        const Numeric a = 0.5 * Numeric(k);
+        const Numeric Anr = x * Ar - y * Ai - a * Apr, Ani = x * Ai + y * Ar - a * Api;
+        const Numeric Bnr = x * Br - y * Bi - a * Bpr, Bni = x * Bi + y * Br - a * Bpi;
+        Apr = Ar; Api = Ai; Ar = Anr; Ai = Ani;
+        Bpr = Br; Bpi = Bi; Br = Bnr; Bi = Bni;
+      }
+      const Numeric inv_A2 = Constant::inv_sqrt_pi / (Ar * Ar + Ai * Ai);
+      const Numeric qr = (Br * Ar + Bi * Ai) * inv_A2, qi = (Bi * Ar - Br * Ai) * inv_A2;
+      W[i] = Complex(-qi, qr);
+    }
+  }
+  
+  if (lower) {
+    for (Index i = 0; i < n; i++) {
+      // exp(-z^2) with the exponent factored as in Faddeeva::w, so that
+      // large |z| does not overflow in the intermediate squares.  Where the
+      // real exponent underflows the term is exactly zero and is skipped, as
+      // its phase -2xy can then be too large to be evaluated.  Where it
+      // overflows, components with a zero phase factor must stay zero
+      const Numeric x = z[i].real(), y = z[i].imag();
+      const Numeric er = (std::abs(y) - std::abs(x)) * (std::abs(x) + std::abs(y));
+      if (er > min_exp_argument) {
+        const Numeric e = 2 * std::exp(er), c = std::cos(2 * x * y), s = -std::sin(2 * x * y);
+        W[i] = Complex((c == 0 ? 0 : e * c) - W[i].real(),
+                       (s == 0 ? 0 : e * s) - W[i].imag());
+      } else {
+        W[i] = -W[i];
+      }
+    }
+  }
+}
+
 /** The Faddeeva function partial derivative */
 constexpr Complex dw(Complex z, Complex w) noexcept {
   return Complex(0, 2) * (Constant::inv_sqrt_pi - z * w);
@@ -112,6 +217,7 @@ void Linefunctions::set_lineshape(
               X);
       break;
     case LineShape::Type::VP:
+    case LineShape::Type::FVP:
       set_voigt(F,
                 dF,
                 data,
@@ -184,6 +290,7 @@ void Linefunctions::set_lineshape(
                       LineShape::mirroredOutput(X));
           break;
         case LineShape::Type::VP:
+        case LineShape::Type::FVP:
           set_voigt(Fm,
                     dF,
                     data,
@@ -334,7 +441,12 @@ void Linefunctions::set_voigt(
   z.noalias() = invGD * (Complex(-F0, x.G0) + f_grid.array()).matrix();
 
   // Line shape
-  F.noalias() = fac * z.unaryExpr(&w);
+  if (band.LineShapeType() == LineShape::Type::FVP) {
+    w_fast(F, z);
+    F *= fac;
+  } else {
+    F.noalias() = fac * z.unaryExpr(&w);
+  }
 
   if (nppd) {
     dw.noalias() = 2 * (Complex(0, fac * Constant::inv_sqrt_pi) -
@@ -634,7 +746,9 @@ void Linefunctions::apply_linestrength_scaling_by_lte(
     Eigen::Ref<Eigen::MatrixXcd> dF,
     Eigen::Ref<Eigen::VectorXcd> N,
     Eigen::Ref<Eigen::MatrixXcd> dN,
-    const Absorption::SingleLine& line,
+    const Numeric& F0,
+    const Numeric& I0,
+    const Numeric& E0,
     const Numeric& T,
     const Numeric& T0,
     const Numeric& isotopic_ratio,
@@ -647,13 +761,13 @@ void Linefunctions::apply_linestrength_scaling_by_lte(
     const Numeric& dQT_dT) {
   auto nppd = derivatives_data_position.nelem();
 
-  const Numeric gamma = stimulated_emission(T, line.F0());
-  const Numeric gamma_ref = stimulated_emission(T0, line.F0());
-  const Numeric K1 = boltzman_ratio(T, T0, line.E0());
+  const Numeric gamma = stimulated_emission(T, F0);
+  const Numeric gamma_ref = stimulated_emission(T0, F0);
+  const Numeric K1 = boltzman_ratio(T, T0, E0);
   const Numeric K2 = stimulated_relative_emission(gamma, gamma_ref);
 
   const Numeric invQT = 1.0 / QT;
-  const Numeric S = line.I0() * isotopic_ratio * QT0 * invQT * K1 * K2;
+  const Numeric S = I0 * isotopic_ratio * QT0 * invQT * K1 * K2;
 
   F *= S;
   dF *= S;
@@ -662,12 +776,12 @@ void Linefunctions::apply_linestrength_scaling_by_lte(
 
     if (deriv == JacPropMatType::Temperature)
       dF.col(iq).noalias() +=
-      F * (dstimulated_relative_emission_dT(gamma, gamma_ref, line.F0(), T) /
+      F * (dstimulated_relative_emission_dT(gamma, gamma_ref, F0, T) /
                    K2 +
-                   dboltzman_ratio_dT_div_boltzmann_ratio(T, line.E0()) - invQT * dQT_dT);
+                   dboltzman_ratio_dT_div_boltzmann_ratio(T, E0) - invQT * dQT_dT);
     else if (deriv == JacPropMatType::LineStrength and
              Absorption::id_in_line(band, deriv.QuantumIdentity(), line_ind))
-      dF.col(iq).noalias() = F / line.I0();  //nb. overwrite
+      dF.col(iq).noalias() = F / I0;  //nb. overwrite
     else if (deriv == JacPropMatType::LineCenter and
              Absorption::id_in_line(band, deriv.QuantumIdentity(), line_ind))
       dF.col(iq).noalias() +=
@@ -686,7 +800,9 @@ void Linefunctions::apply_linestrength_scaling_by_vibrational_nlte(
     Eigen::Ref<Eigen::MatrixXcd> dF,
     Eigen::Ref<Eigen::VectorXcd> N,
     Eigen::Ref<Eigen::MatrixXcd> dN,
-    const Absorption::SingleLine& line,
+    const Numeric& F0,
+    const Numeric& I0,
+    const Numeric& E0,
     const Numeric& T,
     const Numeric& T0,
     const Numeric& Tu,
@@ -703,12 +819,12 @@ void Linefunctions::apply_linestrength_scaling_by_vibrational_nlte(
     const Numeric& dQT_dT) {
   auto nppd = derivatives_data_position.nelem();
 
-  const Numeric gamma = stimulated_emission(T,line.F0());
-  const Numeric gamma_ref = stimulated_emission(T0,line.F0());
+  const Numeric gamma = stimulated_emission(T,F0);
+  const Numeric gamma_ref = stimulated_emission(T0,F0);
   const Numeric r_low = boltzman_ratio(Tl,T,Evl);
   const Numeric r_upp = boltzman_ratio(Tu,T,Evu);
 
-  const Numeric K1 = boltzman_ratio(T,T0,line.E0());
+  const Numeric K1 = boltzman_ratio(T,T0,E0);
   const Numeric K2 = stimulated_relative_emission(gamma,gamma_ref);
   const Numeric K3 = absorption_nlte_ratio(gamma,r_upp,r_low);
   const Numeric K4 = r_upp;
@@ -717,9 +833,9 @@ void Linefunctions::apply_linestrength_scaling_by_vibrational_nlte(
   const Numeric QT_ratio = QT0 * invQT;
 
   const Numeric dS_dS0_abs = isotopic_ratio * QT_ratio * K1 * K2 * K3;
-  const Numeric S_abs = line.I0() * dS_dS0_abs;
+  const Numeric S_abs = I0 * dS_dS0_abs;
   const Numeric dS_dS0_src = isotopic_ratio * QT_ratio * K1 * K2 * K4;
-  const Numeric S_src = line.I0() * dS_dS0_src;
+  const Numeric S_src = I0 * dS_dS0_src;
 
   dN.noalias() = dF * (S_src - S_abs);
   dF *= S_abs;
@@ -729,17 +845,17 @@ void Linefunctions::apply_linestrength_scaling_by_vibrational_nlte(
     if (deriv == JacPropMatType::Temperature) {
       const Numeric dS_dT_abs =
           S_abs *
-          (dstimulated_relative_emission_dT(gamma, gamma_ref, line.F0(), T) /
+          (dstimulated_relative_emission_dT(gamma, gamma_ref, F0, T) /
                K2 +
-               dboltzman_ratio_dT(K1, T, line.E0()) / K1 +
-               dabsorption_nlte_rate_dT(gamma, T, line.F0(), Evl, Evu, K4, r_low) /
+               dboltzman_ratio_dT(K1, T, E0) / K1 +
+               dabsorption_nlte_rate_dT(gamma, T, F0, Evl, Evu, K4, r_low) /
                K3 -
            invQT * dQT_dT);
       const Numeric dS_dT_src =
           S_src *
-          (dstimulated_relative_emission_dT(gamma, gamma_ref, line.F0(), T) /
+          (dstimulated_relative_emission_dT(gamma, gamma_ref, F0, T) /
                K2 +
-               dboltzman_ratio_dT(K1, T, line.E0()) / K1 -
+               dboltzman_ratio_dT(K1, T, E0) / K1 -
            dboltzman_ratio_dT(K4, T, Evu) / K4 - invQT * dQT_dT);
 
       dN.col(iq).noalias() += F * (dS_dT_src - dS_dT_abs);
@@ -823,18 +939,13 @@ void Linefunctions::find_cutoff_ranges(
 
   const bool need_cutoff = (fmax > fmin);
   if (need_cutoff) {
-    // Find range of simulations
-    start_cutoff = 0;
-    Index i_f_max = nf - 1;
-
-    // Loop over positions to compute the line shape cutoff point
-    while (start_cutoff < nf and fmin > f_grid[start_cutoff])
-      ++start_cutoff;
-    while (i_f_max >= start_cutoff and fmax < f_grid[i_f_max])
-      --i_f_max;
+    // Binary search for the range of simulations in the sorted grid
+    const Numeric* f_beg = f_grid.data();
+    const Numeric* f_low = std::lower_bound(f_beg, f_beg + nf, fmin);
+    const Numeric* f_upp = std::upper_bound(f_low, f_beg + nf, fmax);
 
-    //  The extent is one more than the difference between the indices of interest
-    nelem_cutoff = i_f_max - start_cutoff + 1;  // min is 0, max is nf
+    start_cutoff = Index(f_low - f_beg);
+    nelem_cutoff = Index(f_upp - f_low);  // min is 0, max is nf
   } else {
     start_cutoff = 0;
     nelem_cutoff = nf;
@@ -1288,11 +1399,27 @@ void Linefunctions::set_htp(Eigen::Ref<Eigen::VectorXcd> F,
   }
 }
 
-void Linefunctions::set_cross_section_of_band(
+namespace Linefunctions {
+/** As set_cross_section_of_lines but for several polarizations at once
+ * 
+ * Every line is set up once for all polarizations.  The Zeeman components of
+ * polarizations[ip] are then added onto sums[ip].  Without zeeman, npol must
+ * be 1 and the unsplit lines are added onto sums[0]
+ * 
+ * With far_wing, pressure broadened line shapes are replaced by the Lorentz
+ * line shape.  This is only meant for lines far from all of f_full, where
+ * the line shapes have converged to their Lorentz wings
+ */
+static void set_cross_section_of_lines_impl(
     InternalData& scratch,
-    InternalData& sum,
-    const ConstVectorView f_grid,
+    InternalData* sums,
+    const Index npol,
+    const Zeeman::Polarization* polarizations,
+    const Absorption::ZeemanComponentTable* zeeman,
+    const Eigen::Ref<const Eigen::VectorXd> f_full,
     const AbsorptionLines& band,
+    const Absorption::PackedLines& packed,
+    const Absorption::ShapeParameterTable& shape,
     const ArrayOfRetrievalQuantity& derivatives_data,
     const ArrayOfIndex& derivatives_data_active,
     const Vector& vmrs,
@@ -1306,19 +1433,20 @@ void Linefunctions::set_cross_section_of_band(
     const Numeric& QT,
     const Numeric& dQTdT,
     const Numeric& QT0,
-    const bool no_negatives,
-    const bool zeeman,
-    const Zeeman::Polarization zeeman_polarization)
+    const Index line_start,
+    const Index line_end,
+    const bool far_wing=false)
 {
   const Index nj = derivatives_data_active.nelem();
   const bool do_temperature = do_temperature_jacobian(derivatives_data);
   
-  // Sum up variable reset
-  sum.SetZero();
+  if (line_end <= line_start) return;
   
-  if (band.NumLines() == 0 or Absorption::relaxationtype_relmat(band.Population())) {
-    return;  // No line-by-line computations required/wanted
-  }
+  // The Doppler line shape has no pressure broadened wing to fall back on
+  const LineShape::Type shape_type =
+      (far_wing and band.LineShapeType() not_eq LineShape::Type::DP)
+          ? LineShape::Type::LP
+          : band.LineShapeType();
   
   // Cutoff for Eigen-library types
   Eigen::Matrix<Numeric, 1, 1> fc;
@@ -1328,15 +1456,12 @@ void Linefunctions::set_cross_section_of_band(
   auto& dNc = scratch.dNc;
   auto& datac = scratch.datac;
   
-  // Frequency grid as Eigen type
-  const auto f_full = MapToEigen(f_grid);
-  
   // Cut off range
   const Numeric fmean = (band.Cutoff() == Absorption::CutoffType::BandFixedFrequency) ? band.F_mean() : 0;
   Numeric fcut_upp, fcut_low;
   Index start, nelem;
-  fcut_upp = band.CutoffFreq(0);
-  fcut_low = band.CutoffFreqMinus(0, fmean);
+  fcut_upp = band.CutoffFreq(line_start);
+  fcut_low = band.CutoffFreqMinus(line_start, fmean);
   find_cutoff_ranges(start, nelem, f_full, fcut_low, fcut_upp);
   fc[0] = fcut_upp;
   
@@ -1346,10 +1471,10 @@ void Linefunctions::set_cross_section_of_band(
   // Placeholder nothingness
   constexpr LineShape::Output empty_output = {0, 0, 0, 0, 0, 0, 0, 0, 0};
   
-  for (Index i=0; i<band.NumLines(); i++) {
+  for (Index i=line_start; i<line_end; i++) {
     
     // Select the range of cutoff if different for each line
-    if (band.Cutoff() == Absorption::CutoffType::LineByLineOffset and i>0) {
+    if (band.Cutoff() == Absorption::CutoffType::LineByLineOffset and i>line_start) {
       fcut_upp = band.CutoffFreq(i);
       fcut_low = band.CutoffFreqMinus(i, fmean);
       find_cutoff_ranges(start, nelem, f_full, fcut_low, fcut_upp);
@@ -1365,176 +1490,558 @@ void Linefunctions::set_cross_section_of_band(
     const auto f = f_full.middleRows(start, nelem);
     
     // Pressure broadening and line mixing terms
-    const auto X = band.ShapeParameters(i, T, P, vmrs);
+    const auto X = shape.X[i];
     
     // Partial derivatives for temperature
-    const auto dXdT = do_temperature ?
-      band.ShapeParameters_dT(i, T, P, vmrs) : empty_output;
+    const auto dXdT = do_temperature ? shape.dXdT[i] : empty_output;
     
     // Partial derivatives for VMR of self (function works for any species but only do self for now)
     const auto dXdVMR = do_vmr.test ?
       band.ShapeParameters_dVMR(i, T, P, do_vmr.qid) : empty_output;
     
-    // Zeeman lines if necessary
-    const Index nz = zeeman ?
-      band.ZeemanCount(i, zeeman_polarization) : 1;
-    
-    for (Index iz=0; iz<nz; iz++) {
+    // All polarizations share the line setup above
+    for (Index ipol=0; ipol<npol; ipol++) {
+      auto& sum = sums[ipol];
+      const auto polarization = polarizations[ipol];
       
-      // Zeeman values for this sub-line
-      const Numeric Sz = zeeman ?
-        band.ZeemanStrength(i, zeeman_polarization, iz) : 1;
-      const Numeric dfdH = zeeman ?
-        band.ZeemanSplitting(i, zeeman_polarization, iz) : 0;
+      // Zeeman lines if necessary
+      const Index nz = zeeman ? zeeman->Count(i, polarization) : 1;
       
-      // Set the line shape and its derivatives
-      switch (band.LineShapeType()) {
-        case LineShape::Type::DP:
-          set_doppler(F, dF, data, f, dfdH, H, band.F0(i), DC, band, i, derivatives_data, derivatives_data_active, dDCdT);
-          if (band.Cutoff() not_eq Absorption::CutoffType::None)
-            set_doppler(Fc, dFc, datac, fc, dfdH, H, band.F0(i), DC, band, i, derivatives_data, derivatives_data_active, dDCdT);
-          break;
-        case LineShape::Type::HTP:
-        case LineShape::Type::SDVP:
-          set_htp(F, dF, f, dfdH, H, band.F0(i), DC, X, band, i, derivatives_data, derivatives_data_active, dDCdT, dXdT, dXdVMR);
-          if (band.Cutoff() not_eq Absorption::CutoffType::None)
-            set_htp(Fc, dFc, fc, dfdH, H, band.F0(i), DC, X, band, i, derivatives_data, derivatives_data_active, dDCdT, dXdT, dXdVMR);
-          break;
-        case LineShape::Type::LP:
-          set_lorentz(F, dF, data, f, dfdH, H, band.F0(i), X, band, i, derivatives_data, derivatives_data_active, dXdT, dXdVMR);
-          if (band.Cutoff() not_eq Absorption::CutoffType::None)
-            set_lorentz(Fc, dFc, datac, fc, dfdH, H, band.F0(i), X, band, i, derivatives_data, derivatives_data_active, dXdT, dXdVMR);
-          break;
-        case LineShape::Type::VP:
-          set_voigt(F, dF, data, f, dfdH, H, band.F0(i), DC, X, band, i, derivatives_data, derivatives_data_active, dDCdT, dXdT, dXdVMR);
-          if (band.Cutoff() not_eq Absorption::CutoffType::None)
-            set_voigt(Fc, dFc, datac, fc, dfdH, H, band.F0(i), DC, X, band, i, derivatives_data, derivatives_data_active, dDCdT, dXdT, dXdVMR);
-          break;
-      }
+      for (Index iz=0; iz<nz; iz++) {
+        
+        // Zeeman values for this sub-line
+        const Numeric Sz = zeeman ? zeeman->Strength(i, polarization, iz) : 1;
+        const Numeric dfdH = zeeman ? zeeman->Splitting(i, polarization, iz) : 0;
       
-      // Remove the cutoff values
-      if (band.Cutoff() not_eq Absorption::CutoffType::None) {
-        F.array() -= Fc[0];
-        for (Index ij = 0; ij < nj; ij++) {
-          dF.col(ij).array() -= dFc[ij];
+        // Set the line shape and its derivatives
+        switch (shape_type) {
+          case LineShape::Type::DP:
+            set_doppler(F, dF, data, f, dfdH, H, packed.F0(i), DC, band, i, derivatives_data, derivatives_data_active, dDCdT);
+            if (band.Cutoff() not_eq Absorption::CutoffType::None)
+              set_doppler(Fc, dFc, datac, fc, dfdH, H, packed.F0(i), DC, band, i, derivatives_data, derivatives_data_active, dDCdT);
+            break;
+          case LineShape::Type::HTP:
+          case LineShape::Type::SDVP:
+            set_htp(F, dF, f, dfdH, H, packed.F0(i), DC, X, band, i, derivatives_data, derivatives_data_active, dDCdT, dXdT, dXdVMR);
+            if (band.Cutoff() not_eq Absorption::CutoffType::None)
+              set_htp(Fc, dFc, fc, dfdH, H, packed.F0(i), DC, X, band, i, derivatives_data, derivatives_data_active, dDCdT, dXdT, dXdVMR);
+            break;
+          case LineShape::Type::LP:
+            set_lorentz(F, dF, data, f, dfdH, H, packed.F0(i), X, band, i, derivatives_data, derivatives_data_active, dXdT, dXdVMR);
+            if (band.Cutoff() not_eq Absorption::CutoffType::None)
+              set_lorentz(Fc, dFc, datac, fc, dfdH, H, packed.F0(i), X, band, i, derivatives_data, derivatives_data_active, dXdT, dXdVMR);
+            break;
+          case LineShape::Type::VP:
+          case LineShape::Type::FVP:
+            set_voigt(F, dF, data, f, dfdH, H, packed.F0(i), DC, X, band, i, derivatives_data, derivatives_data_active, dDCdT, dXdT, dXdVMR);
+            if (band.Cutoff() not_eq Absorption::CutoffType::None)
+              set_voigt(Fc, dFc, datac, fc, dfdH, H, packed.F0(i), DC, X, band, i, derivatives_data, derivatives_data_active, dDCdT, dXdT, dXdVMR);
+            break;
+        }
+      
+        // Remove the cutoff values
+        if (band.Cutoff() not_eq Absorption::CutoffType::None) {
+          F.array() -= Fc[0];
+          for (Index ij = 0; ij < nj; ij++) {
+            dF.col(ij).array() -= dFc[ij];
+          }
         }
-      }
 
-      // Set the mirrored line shape
-      const bool with_mirroring =
-      band.Mirroring() not_eq Absorption::MirroringType::None and
-      band.Mirroring() not_eq Absorption::MirroringType::Manual;
-      switch (band.Mirroring()) {
-        case Absorption::MirroringType::None:
-        case Absorption::MirroringType::Manual:
-          break;
-        case Absorption::MirroringType::Lorentz:
-          set_lorentz(N, dN, data, f, -dfdH, H, -band.F0(i), LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
-          if (band.Cutoff() not_eq Absorption::CutoffType::None)
-            set_lorentz(Nc, dNc, datac, fc, -dfdH, H, -band.F0(i), LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
-          break;
-        case Absorption::MirroringType::SameAsLineShape:
-          switch (band.LineShapeType()) {
-            case LineShape::Type::DP:
-              set_doppler(N, dN, data, f, -dfdH, H, -band.F0(i), -DC, band, i, derivatives_data, derivatives_data_active, -dDCdT);
-              if (band.Cutoff() not_eq Absorption::CutoffType::None)
-                set_doppler(Nc, dNc, datac, fc, -dfdH, H, -band.F0(i), -DC, band, i, derivatives_data, derivatives_data_active, -dDCdT);
-              break;
-            case LineShape::Type::LP:
-              set_lorentz(N, dN, data, f, -dfdH, H, -band.F0(i), LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
-              if (band.Cutoff() not_eq Absorption::CutoffType::None)
-                set_lorentz(Nc, dNc, datac, fc, -dfdH, H, -band.F0(i), LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
-              break;
-            case LineShape::Type::VP:
-              set_voigt(N, dN, data, f, -dfdH, H, -band.F0(i), -DC, LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, -dDCdT, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
-              if (band.Cutoff() not_eq Absorption::CutoffType::None)
-                set_voigt(Nc, dNc, datac, fc, -dfdH, H, -band.F0(i), -DC, LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, -dDCdT, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
-              break;
-            case LineShape::Type::HTP:
-            case LineShape::Type::SDVP:
-              // WARNING: This mirroring is not tested and it might require, e.g., FVC to be treated differently
-              set_htp(N, dN, f, -dfdH, H, -band.F0(i), -DC, LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, -dDCdT, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
-              if (band.Cutoff() not_eq Absorption::CutoffType::None)
-                set_htp(Nc, dNc, fc, -dfdH, H, -band.F0(i), -DC, LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, -dDCdT, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
-              break;
+        // Set the mirrored line shape
+        const bool with_mirroring =
+        band.Mirroring() not_eq Absorption::MirroringType::None and
+        band.Mirroring() not_eq Absorption::MirroringType::Manual;
+        switch (band.Mirroring()) {
+          case Absorption::MirroringType::None:
+          case Absorption::MirroringType::Manual:
+            break;
+          case Absorption::MirroringType::Lorentz:
+            set_lorentz(N, dN, data, f, -dfdH, H, -packed.F0(i), LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
+            if (band.Cutoff() not_eq Absorption::CutoffType::None)
+              set_lorentz(Nc, dNc, datac, fc, -dfdH, H, -packed.F0(i), LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
+            break;
+          case Absorption::MirroringType::SameAsLineShape:
+            switch (shape_type) {
+              case LineShape::Type::DP:
+                set_doppler(N, dN, data, f, -dfdH, H, -packed.F0(i), -DC, band, i, derivatives_data, derivatives_data_active, -dDCdT);
+                if (band.Cutoff() not_eq Absorption::CutoffType::None)
+                  set_doppler(Nc, dNc, datac, fc, -dfdH, H, -packed.F0(i), -DC, band, i, derivatives_data, derivatives_data_active, -dDCdT);
+                break;
+              case LineShape::Type::LP:
+                set_lorentz(N, dN, data, f, -dfdH, H, -packed.F0(i), LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
+                if (band.Cutoff() not_eq Absorption::CutoffType::None)
+                  set_lorentz(Nc, dNc, datac, fc, -dfdH, H, -packed.F0(i), LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
+                break;
+              case LineShape::Type::VP:
+              case LineShape::Type::FVP:
+                set_voigt(N, dN, data, f, -dfdH, H, -packed.F0(i), -DC, LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, -dDCdT, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
+                if (band.Cutoff() not_eq Absorption::CutoffType::None)
+                  set_voigt(Nc, dNc, datac, fc, -dfdH, H, -packed.F0(i), -DC, LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, -dDCdT, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
+                break;
+              case LineShape::Type::HTP:
+              case LineShape::Type::SDVP:
+                // WARNING: This mirroring is not tested and it might require, e.g., FVC to be treated differently
+                set_htp(N, dN, f, -dfdH, H, -packed.F0(i), -DC, LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, -dDCdT, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
+                if (band.Cutoff() not_eq Absorption::CutoffType::None)
+                  set_htp(Nc, dNc, fc, -dfdH, H, -packed.F0(i), -DC, LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, -dDCdT, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
+                break;
+            }
+            break;
+        }
+      
+        // Remove the mirrored cutoff values
+        if (band.Cutoff() not_eq Absorption::CutoffType::None and with_mirroring) {
+          N.array() -= Nc[0];
+          for (Index ij = 0; ij < nj; ij++) {
+            dN.col(ij).array() -= dNc[ij];
           }
-          break;
-      }
+        }
+
+        // Mirror and and line mixing is added together (because of conjugate)
+        if (band.LineShapeType() not_eq LineShape::Type::DP) {
+          apply_linemixing_scaling_and_mirroring(F, dF, N, dN, X, with_mirroring, band, i, derivatives_data, derivatives_data_active, dXdT, dXdVMR);
+
+          // Apply line mixing and pressure broadening partial derivatives
+          apply_lineshapemodel_jacobian_scaling(dF, band, i, derivatives_data, derivatives_data_active, T, P, vmrs);
+        }
+
+        // Normalize the lines
+        switch (band.Normalization()) {
+          case Absorption::NormalizationType::None:
+            break;
+          case Absorption::NormalizationType::VVH:
+            apply_VVH_scaling(F, dF, data, f, packed.F0(i), T, band, i, derivatives_data, derivatives_data_active);
+            break;
+          case Absorption::NormalizationType::VVW:
+            apply_VVW_scaling(F, dF, f, packed.F0(i), band, i, derivatives_data, derivatives_data_active);
+            break;
+          case Absorption::NormalizationType::RosenkranzQuadratic:
+            apply_rosenkranz_quadratic_scaling(F, dF, f, packed.F0(i), T, band, i, derivatives_data, derivatives_data_active);
+            break;
+        }
+
+        // Apply line strength by whatever method is necessary
+        switch (band.Population()) {
+          case Absorption::PopulationType::ByLTE:
+            apply_linestrength_scaling_by_lte(F, dF, N, dN, packed.F0(i), packed.I0(i), packed.E0(i), T, band.T0(), isot_ratio, QT, QT0, band, i, derivatives_data, derivatives_data_active, dQTdT);
+            break;
+          case Absorption::PopulationType::ByNLTEVibrationalTemperatures: {
+            auto nlte_data = nlte.get_vibtemp_params(band, i, T);
+            apply_linestrength_scaling_by_vibrational_nlte(F, dF, N, dN, packed.F0(i), packed.I0(i), packed.E0(i), T, band.T0(), nlte_data.T_upp, nlte_data.T_low, nlte_data.E_upp, nlte_data.E_low, isot_ratio, QT, QT0, band, i, derivatives_data, derivatives_data_active, dQTdT);
+          } break;
+          case Absorption::PopulationType::ByNLTEPopulationDistribution: {
+            auto nlte_data = nlte.get_ratio_params(band, i);
+            apply_linestrength_from_nlte_level_distributions(F, dF, N, dN, nlte_data.r_low, nlte_data.r_upp, packed.g_low(i), packed.g_upp(i), packed.A(i), packed.F0(i), T, band, i, derivatives_data, derivatives_data_active);
+          } break;
+          case Absorption::PopulationType::ByRelmatMendazaLTE:
+          case Absorption::PopulationType::ByRelmatHartmannLTE:
+            std::terminate();
+        }
       
-      // Remove the mirrored cutoff values
-      if (band.Cutoff() not_eq Absorption::CutoffType::None and with_mirroring) {
-        N.array() -= Nc[0];
-        for (Index ij = 0; ij < nj; ij++) {
-          dN.col(ij).array() -= dNc[ij];
+        // Zeeman-adjusted strength
+        if (zeeman) {
+          F *= Sz;
+          N *= Sz;
+          dF *= Sz;
+          dN *= Sz;
         }
+      
+        // Sum up the contributions
+        sum.F.segment(start, nelem).noalias() += F;
+        sum.N.segment(start, nelem).noalias() += N;
+        sum.dF.middleRows(start, nelem).noalias() += dF;
+        sum.dN.middleRows(start, nelem).noalias() += dN;
       }
+    }
+  }
+}
+}  // namespace Linefunctions
 
-      // Mirror and and line mixing is added together (because of conjugate)
-      if (band.LineShapeType() not_eq LineShape::Type::DP) {
-        apply_linemixing_scaling_and_mirroring(F, dF, N, dN, X, with_mirroring, band, i, derivatives_data, derivatives_data_active, dXdT, dXdVMR);
+void Linefunctions::set_cross_section_of_lines(
+    InternalData& scratch,
+    InternalData& sum,
+    const Eigen::Ref<const Eigen::VectorXd> f_full,
+    const AbsorptionLines& band,
+    const Absorption::PackedLines& packed,
+    const Absorption::ShapeParameterTable& shape,
+    const ArrayOfRetrievalQuantity& derivatives_data,
+    const ArrayOfIndex& derivatives_data_active,
+    const Vector& vmrs,
+    const EnergyLevelMap& nlte,
+    const Numeric& P,
+    const Numeric& T,
+    const Numeric& isot_ratio,
+    const Numeric& H,
+    const Numeric& DC,
+    const Numeric& dDCdT,
+    const Numeric& QT,
+    const Numeric& dQTdT,
+    const Numeric& QT0,
+    const Index line_start,
+    const Index line_end,
+    const Absorption::ZeemanComponentTable* zeeman,
+    const Zeeman::Polarization zeeman_polarization)
+{
+  set_cross_section_of_lines_impl(scratch, &sum, 1, &zeeman_polarization, zeeman, f_full, band, packed, shape, derivatives_data, derivatives_data_active, vmrs, nlte, P, T, isot_ratio, H, DC, dDCdT, QT, dQTdT, QT0, line_start, line_end);
+}
 
-        // Apply line mixing and pressure broadening partial derivatives
-        apply_lineshapemodel_jacobian_scaling(dF, band, i, derivatives_data, derivatives_data_active, T, P, vmrs);
-      }
+/** Sets all values at frequencies where sum.F has a negative real part to zero
+ * 
+ * @param[in,out] sum Summed up line data
+ * @param[in] nj Number of derivatives
+ */
+static void remove_negatives(Linefunctions::InternalData& sum, const Index nj)
+{
+  auto reset_zeroes = (sum.F.array().real() < 0);
+  
+  sum.N = reset_zeroes.select(Complex(0, 0), sum.N);
+  for (Index ij=0; ij<nj; ij++)
+    sum.dF.col(ij) = reset_zeroes.select(Complex(0, 0), sum.dF.col(ij));
+  for (Index ij=0; ij<nj; ij++)
+    sum.dN.col(ij) = reset_zeroes.select(Complex(0, 0), sum.dN.col(ij));
+  sum.F = reset_zeroes.select(Complex(0, 0), sum.F);
+}
 
-      // Normalize the lines
-      switch (band.Normalization()) {
-        case Absorption::NormalizationType::None:
-          break;
-        case Absorption::NormalizationType::VVH:
-          apply_VVH_scaling(F, dF, data, f, band.F0(i), T, band, i, derivatives_data, derivatives_data_active);
-          break;
-        case Absorption::NormalizationType::VVW:
-          apply_VVW_scaling(F, dF, f, band.F0(i), band, i, derivatives_data, derivatives_data_active);
-          break;
-        case Absorption::NormalizationType::RosenkranzQuadratic:
-          apply_rosenkranz_quadratic_scaling(F, dF, f, band.F0(i), T, band, i, derivatives_data, derivatives_data_active);
-          break;
+namespace Linefunctions {
+/** As set_cross_section_of_band but for several polarizations at once
+ * 
+ * See set_cross_section_of_lines_impl for the meaning of sums, npol,
+ * polarizations and zeeman
+ */
+static void set_cross_section_of_band_impl(
+    InternalData& scratch,
+    InternalData* sums,
+    const Index npol,
+    const Zeeman::Polarization* polarizations,
+    const Absorption::ZeemanComponentTable* zeeman,
+    const ConstVectorView f_grid,
+    const AbsorptionLines& band,
+    const Absorption::PackedLines& packed,
+    const ArrayOfRetrievalQuantity& derivatives_data,
+    const ArrayOfIndex& derivatives_data_active,
+    const Vector& vmrs,
+    const EnergyLevelMap& nlte,
+    const Numeric& P,
+    const Numeric& T,
+    const Numeric& isot_ratio,
+    const Numeric& H,
+    const Numeric& DC,
+    const Numeric& dDCdT,
+    const Numeric& QT,
+    const Numeric& dQTdT,
+    const Numeric& QT0,
+    const bool no_negatives,
+    const Absorption::ShapeParameterTable* shape)
+{
+  const Index nj = derivatives_data_active.nelem();
+  const Index nl = band.NumLines();
+  
+  // Sum up variable reset
+  for (Index ipol = 0; ipol < npol; ipol++) sums[ipol].SetZero();
+  
+  if (nl == 0 or Absorption::relaxationtype_relmat(band.Population())) {
+    return;  // No line-by-line computations required/wanted
+  }
+  
+  // Line shape parameters of all lines
+  Absorption::ShapeParameterTable own_shape;
+  if (not shape) {
+    packed.SetShapeParameters(own_shape, T, P, vmrs, do_temperature_jacobian(derivatives_data));
+    shape = &own_shape;
+  }
+  
+  // Frequency grid as Eigen type
+  const auto f_full = MapToEigen(f_grid);
+  
+  // Split the lines across threads if nobody above us is already parallel
+  const Index nthreads = arts_omp_in_parallel() ? 1 :
+    std::min(Index(arts_omp_get_max_threads()), nl / MinimumLinesPerThread());
+  
+  if (nthreads < 2) {
+    set_cross_section_of_lines_impl(scratch, sums, npol, polarizations, zeeman, f_full, band, packed, *shape, derivatives_data, derivatives_data_active, vmrs, nlte, P, T, isot_ratio, H, DC, dDCdT, QT, dQTdT, QT0, 0, nl);
+  } else {
+    // Each thread owns its own buffers and a contiguous range of lines
+    std::vector<InternalData> thread_scratch(nthreads, scratch);
+    std::vector<InternalData> thread_sum(nthreads * npol, sums[0]);
+    
+    ArrayOfString fail_msg;
+    bool do_abort = false;
+    
+#pragma omp parallel for schedule(static, 1) num_threads(nthreads)
+    for (Index it = 0; it < nthreads; it++) {
+      if (do_abort) continue;
+      try {
+        set_cross_section_of_lines_impl(thread_scratch[it], &thread_sum[it * npol], npol, polarizations, zeeman, f_full, band, packed, *shape, derivatives_data, derivatives_data_active, vmrs, nlte, P, T, isot_ratio, H, DC, dDCdT, QT, dQTdT, QT0, (it * nl) / nthreads, ((it + 1) * nl) / nthreads);
+      } catch (const std::exception& e) {
+#pragma omp critical(set_cross_section_of_band_fail)
+        {
+          do_abort = true;
+          fail_msg.push_back(e.what());
+        }
       }
-
-      // Apply line strength by whatever method is necessary
-      switch (band.Population()) {
-        case Absorption::PopulationType::ByLTE:
-          apply_linestrength_scaling_by_lte(F, dF, N, dN, band.Line(i), T, band.T0(), isot_ratio, QT, QT0, band, i, derivatives_data, derivatives_data_active, dQTdT);
-          break;
-        case Absorption::PopulationType::ByNLTEVibrationalTemperatures: {
-          auto nlte_data = nlte.get_vibtemp_params(band, i, T);
-          apply_linestrength_scaling_by_vibrational_nlte(F, dF, N, dN, band.Line(i), T, band.T0(), nlte_data.T_upp, nlte_data.T_low, nlte_data.E_upp, nlte_data.E_low, isot_ratio, QT, QT0, band, i, derivatives_data, derivatives_data_active, dQTdT);
-        } break;
-        case Absorption::PopulationType::ByNLTEPopulationDistribution: {
-          auto nlte_data = nlte.get_ratio_params(band, i);
-          apply_linestrength_from_nlte_level_distributions(F, dF, N, dN, nlte_data.r_low, nlte_data.r_upp, band.g_low(i), band.g_upp(i), band.A(i), band.F0(i), T, band, i, derivatives_data, derivatives_data_active);
-        } break;
-        case Absorption::PopulationType::ByRelmatMendazaLTE:
-        case Absorption::PopulationType::ByRelmatHartmannLTE:
-          std::terminate();
+    }
+    
+    if (do_abort) {
+      std::ostringstream os;
+      os << "Error messages from failed line ranges:\n";
+      for (const auto& msg : fail_msg) {
+        os << msg << '\n';
       }
-      
-      // Zeeman-adjusted strength
-      if (zeeman) {
-        F *= Sz;
-        N *= Sz;
-        dF *= Sz;
-        dN *= Sz;
+      throw std::runtime_error(os.str());
+    }
+    
+    // Reduce in line order so the result does not depend on thread timing
+    for (Index it = 0; it < nthreads; it++) {
+      for (Index ipol = 0; ipol < npol; ipol++) {
+        auto& sum = sums[ipol];
+        const auto& part = thread_sum[it * npol + ipol];
+        sum.F.noalias() += part.F;
+        sum.N.noalias() += part.N;
+        sum.dF.noalias() += part.dF;
+        sum.dN.noalias() += part.dN;
       }
-      
-      // Sum up the contributions
-      sum.F.segment(start, nelem).noalias() += F;
-      sum.N.segment(start, nelem).noalias() += N;
-      sum.dF.middleRows(start, nelem).noalias() += dF;
-      sum.dN.middleRows(start, nelem).noalias() += dN;
     }
   }
   
   // Set negative values to zero incase this is requested
-  if (no_negatives) {
-    auto reset_zeroes = (sum.F.array().real() < 0);
+  if (no_negatives)
+    for (Index ipol = 0; ipol < npol; ipol++) remove_negatives(sums[ipol], nj);
+}
+}  // namespace Linefunctions
+
+void Linefunctions::set_cross_section_of_band(
+    InternalData& scratch,
+    InternalData& sum,
+    const ConstVectorView f_grid,
+    const AbsorptionLines& band,
+    const Absorption::PackedLines& packed,
+    const ArrayOfRetrievalQuantity& derivatives_data,
+    const ArrayOfIndex& derivatives_data_active,
+    const Vector& vmrs,
+    const EnergyLevelMap& nlte,
+    const Numeric& P,
+    const Numeric& T,
+    const Numeric& isot_ratio,
+    const Numeric& H,
+    const Numeric& DC,
+    const Numeric& dDCdT,
+    const Numeric& QT,
+    const Numeric& dQTdT,
+    const Numeric& QT0,
+    const bool no_negatives,
+    const Absorption::ZeemanComponentTable* zeeman,
+    const Zeeman::Polarization zeeman_polarization,
+    const Absorption::ShapeParameterTable* shape)
+{
+  set_cross_section_of_band_impl(scratch, &sum, 1, &zeeman_polarization, zeeman, f_grid, band, packed, derivatives_data, derivatives_data_active, vmrs, nlte, P, T, isot_ratio, H, DC, dDCdT, QT, dQTdT, QT0, no_negatives, shape);
+}
+
+void Linefunctions::set_zeeman_cross_section_of_band(
+    InternalData& scratch,
+    std::array<InternalData, 3>& sums,
+    const ConstVectorView f_grid,
+    const AbsorptionLines& band,
+    const Absorption::PackedLines& packed,
+    const ArrayOfRetrievalQuantity& derivatives_data,
+    const ArrayOfIndex& derivatives_data_active,
+    const Vector& vmrs,
+    const EnergyLevelMap& nlte,
+    const Numeric& P,
+    const Numeric& T,
+    const Numeric& isot_ratio,
+    const Numeric& H,
+    const Numeric& DC,
+    const Numeric& dDCdT,
+    const Numeric& QT,
+    const Numeric& dQTdT,
+    const Numeric& QT0,
+    const bool no_negatives,
+    const Absorption::ZeemanComponentTable& zeeman,
+    const Absorption::ShapeParameterTable* shape)
+{
+  constexpr std::array<Zeeman::Polarization, 3> polarizations{
+    Zeeman::Polarization::SigmaMinus,
+    Zeeman::Polarization::Pi,
+    Zeeman::Polarization::SigmaPlus};
+  set_cross_section_of_band_impl(scratch, sums.data(), 3, polarizations.data(), &zeeman, f_grid, band, packed, derivatives_data, derivatives_data_active, vmrs, nlte, P, T, isot_ratio, H, DC, dDCdT, QT, dQTdT, QT0, no_negatives, shape);
+}
+
+void Linefunctions::sparse_f_grid_setup(Vector& sparse_f_grid,
+                                        ArrayOfIndex& sparse_pos,
+                                        Vector& sparse_weight,
+                                        const ConstVectorView f_grid,
+                                        const Numeric& sparse_df)
+{
+  const Index nf = f_grid.nelem();
+  sparse_pos.resize(nf);
+  sparse_weight.resize(nf);
+  if (nf == 0) {
+    sparse_f_grid.resize(0);
+    return;
+  }
+  
+  // Coarse points are counted in steps of sparse_df from the first frequency
+  const Numeric f0 = f_grid[0];
+  ArrayOfIndex coarse;
+  for (Index iv=0; iv<nf; iv++) {
+    const Index k = Index(std::floor((f_grid[iv] - f0) / sparse_df));
     
-    sum.N = reset_zeroes.select(Complex(0, 0), sum.N);
-    for (Index ij=0; ij<nj; ij++)
-      sum.dF.col(ij) = reset_zeroes.select(Complex(0, 0), sum.dF.col(ij));
-    for (Index ij=0; ij<nj; ij++)
-      sum.dN.col(ij) = reset_zeroes.select(Complex(0, 0), sum.dN.col(ij));
-    sum.F = reset_zeroes.select(Complex(0, 0), sum.F);
+    // The grid is sorted so the last coarse point is k or k+1 after the first step
+    if (coarse.empty() or coarse.back() < k) coarse.push_back(k);
+    sparse_pos[iv] = coarse.back() == k ? coarse.nelem() - 1 : coarse.nelem() - 2;
+    if (coarse.back() == k) coarse.push_back(k + 1);
   }
+  
+  sparse_f_grid.resize(coarse.nelem());
+  for (Index is=0; is<coarse.nelem(); is++)
+    sparse_f_grid[is] = f0 + Numeric(coarse[is]) * sparse_df;
+  
+  for (Index iv=0; iv<nf; iv++)
+    sparse_weight[iv] = (f_grid[iv] - sparse_f_grid[sparse_pos[iv]]) / sparse_df;
+}
+
+Numeric Linefunctions::sparse_relative_error_bound(const Numeric& sparse_df,
+                                                   const Numeric& sparse_lim) noexcept
+{
+  if (sparse_df >= sparse_lim)
+    return std::numeric_limits<Numeric>::infinity();
+  
+  const Numeric x = sparse_lim - sparse_df;
+  return 0.75 * sparse_df * sparse_df * sparse_lim * sparse_lim / (x * x * x * x);
+}
+
+Numeric Linefunctions::sparse_cutoff_error_bound(const Numeric& sparse_df,
+                                                 const Numeric& sparse_lim) noexcept
+{
+  if (sparse_df >= sparse_lim)
+    return std::numeric_limits<Numeric>::infinity();
+  
+  return 0.5 * sparse_df / (sparse_lim - sparse_df);
+}
+
+Linefunctions::SparseLineIndex::SparseLineIndex(const ConstVectorView f_grid,
+                                                const Absorption::PackedLines& packed,
+                                                const Numeric& sparse_df,
+                                                const Numeric& sparse_lim)
+{
+  const Index nf = f_grid.nelem();
+  const Index nl = packed.NumLines();
+  
+  if (nl == 0) return;
+  
+  if (sparse_lim <= 0 or nf == 0) {
+    near_ranges.emplace_back(0, nl);
+    return;
+  }
+  
+  if (sparse_df <= 0)
+    throw std::runtime_error("The sparse frequency spacing must be positive");
+  if (not is_increasing(f_grid))
+    throw std::runtime_error("The frequency grid must be strictly increasing for sparse calculations");
+  sparse_f_grid_setup(sparse_f_grid, sparse_pos, sparse_weight, f_grid, sparse_df);
+  
+  // Widely spaced grids have nothing to gain from the coarse grid, their far
+  // lines are computed on the full grid
+  if (sparse_f_grid.nelem() >= nf) {
+    sparse_f_grid.resize(0);
+    sparse_pos.resize(0);
+    sparse_weight.resize(0);
+  }
+  
+  for (Index i=0; i<nl; i++) {
+    const Numeric F0 = packed.F0(i);
+    
+    // Binary search for the first grid point not below the line center
+    Index lo = 0, hi = nf;
+    while (lo < hi) {
+      const Index mid = (lo + hi) / 2;
+      if (f_grid[mid] < F0)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    
+    // Distance to the closest grid point
+    Numeric dist = std::numeric_limits<Numeric>::infinity();
+    if (lo < nf) dist = f_grid[lo] - F0;
+    if (lo > 0) dist = std::min(dist, F0 - f_grid[lo - 1]);
+    
+    // Lines are grouped in consecutive ranges of the same kind
+    auto& ranges = dist > sparse_lim ? far_ranges : near_ranges;
+    if (not ranges.empty() and ranges.back().second == i)
+      ranges.back().second = i + 1;
+    else
+      ranges.emplace_back(i, i + 1);
+  }
+}
+
+void Linefunctions::set_sparse_cross_section_of_band(
+    InternalData& scratch,
+    InternalData& sum,
+    InternalData& sparse_scratch,
+    InternalData& sparse_sum,
+    const ConstVectorView f_grid,
+    const AbsorptionLines& band,
+    const Absorption::PackedLines& packed,
+    const SparseLineIndex& sparse,
+    const ArrayOfRetrievalQuantity& derivatives_data,
+    const ArrayOfIndex& derivatives_data_active,
+    const Vector& vmrs,
+    const EnergyLevelMap& nlte,
+    const Numeric& P,
+    const Numeric& T,
+    const Numeric& isot_ratio,
+    const Numeric& H,
+    const Numeric& DC,
+    const Numeric& dDCdT,
+    const Numeric& QT,
+    const Numeric& dQTdT,
+    const Numeric& QT0,
+    const bool no_negatives)
+{
+  const Index nj = derivatives_data_active.nelem();
+  const Index nf = f_grid.nelem();
+  
+  // Sum up variable reset
+  sum.SetZero();
+  
+  if (band.NumLines() == 0 or Absorption::relaxationtype_relmat(band.Population())) {
+    return;  // No line-by-line computations required/wanted
+  }
+  
+  // Line shape parameters of all lines, shared by the near and far lines
+  Absorption::ShapeParameterTable shape;
+  packed.SetShapeParameters(shape, T, P, vmrs, do_temperature_jacobian(derivatives_data));
+  
+  // Near lines on the full grid
+  const auto f_full = MapToEigen(f_grid);
+  for (auto& range: sparse.near_ranges)
+    set_cross_section_of_lines(scratch, sum, f_full, band, packed, shape, derivatives_data, derivatives_data_active, vmrs, nlte, P, T, isot_ratio, H, DC, dDCdT, QT, dQTdT, QT0, range.first, range.second);
+  
+  // Far lines by their Lorentz wings, on the full grid if there is no coarse grid
+  const Zeeman::Polarization polarization = Zeeman::Polarization::Pi;  // Unused without Zeeman
+  if (not sparse.DoCoarse()) {
+    for (auto& range: sparse.far_ranges)
+      set_cross_section_of_lines_impl(scratch, &sum, 1, &polarization, nullptr, f_full, band, packed, shape, derivatives_data, derivatives_data_active, vmrs, nlte, P, T, isot_ratio, H, DC, dDCdT, QT, dQTdT, QT0, range.first, range.second, true);
+  } else if (sparse.DoSparse()) {
+    sparse_sum.SetZero();
+    const auto f_sparse = MapToEigen(sparse.sparse_f_grid);
+    for (auto& range: sparse.far_ranges)
+      set_cross_section_of_lines_impl(sparse_scratch, &sparse_sum, 1, &polarization, nullptr, f_sparse, band, packed, shape, derivatives_data, derivatives_data_active, vmrs, nlte, P, T, isot_ratio, H, DC, dDCdT, QT, dQTdT, QT0, range.first, range.second, true);
+    
+    // Linear interpolation onto the full grid
+    for (Index iv=0; iv<nf; iv++) {
+      const Index is = sparse.sparse_pos[iv];
+      const Numeric w = sparse.sparse_weight[iv];
+      sum.F[iv] += (1 - w) * sparse_sum.F[is] + w * sparse_sum.F[is + 1];
+      sum.N[iv] += (1 - w) * sparse_sum.N[is] + w * sparse_sum.N[is + 1];
+      for (Index ij=0; ij<nj; ij++) {
+        sum.dF(iv, ij) += (1 - w) * sparse_sum.dF(is, ij) + w * sparse_sum.dF(is + 1, ij);
+        sum.dN(iv, ij) += (1 - w) * sparse_sum.dN(is, ij) + w * sparse_sum.dN(is + 1, ij);
+      }
+    }
+  }
+  
+  // Set negative values to zero incase this is requested
+  if (no_negatives) remove_negatives(sum, nj);
 }
@@ -30,6 +30,7 @@
 #ifndef linefunctions_h
 #define linefunctions_h
 
+#include <array>
 #include "complex.h"
 #include "energylevelmap.h"
 #include "jacobian.h"
@@ -41,6 +42,9 @@ namespace Linefunctions {
 /** Size required for data buffer */
 constexpr Index ExpectedDataSize() { return 2; }
 
+/** Minimum number of lines per thread before the line loop of a band is split */
+constexpr Index MinimumLinesPerThread() { return 64; }
+
 /** Sets the lineshape normalized to unity.
  * 
  * No line mixing or linestrength is computed.
@@ -68,6 +72,27 @@ void set_lineshape(Eigen::Ref<Eigen::VectorXcd> F,
                    const Absorption::MirroringType mirroring_type,
                    const Absorption::NormalizationType norm_type);
 
+/** The Faddeeva function for a full frequency segment, fast approximation
+ * 
+ * For |Re(z)| + Im(z) < 8, Weideman's rational series with 32 terms is used.
+ * Outside of this region, the Laplace continued fraction is used to depth 10
+ * up to |Re(z)| + Im(z) = 10, to depth 8 up to 50, and to depth 3 beyond.
+ * Beyond 1e7, the asymptotic form i / (sqrt(pi) z) is exact to machine
+ * precision.  The loop is written in real arithmetics without divisions in
+ * the inner recurrences.  The lower half-plane, used by mirrored lines, is
+ * reached by w(z) = 2exp(-z^2) - w(-z).  Where |Im(z)| exceeds |Re(z)| by
+ * enough for exp(-z^2) to overflow, the result is infinite, as it is for
+ * Faddeeva::w
+ * 
+ * Compared to Faddeeva::w, the relative error of |w| is below 1e-10 and the
+ * absolute error of Re(w) is below 1e-12 of the line peak w(0) = 1
+ * 
+ * @param[out] W The Faddeeva function.  Must be right size
+ * @param[in] z The complex arguments with constant sign of Im(z)
+ */
+void w_fast(Eigen::Ref<Eigen::VectorXcd> W,
+            const Eigen::Ref<const Eigen::VectorXcd> z) noexcept;
+
 /** Sets the Lorentz line shape. Normalization is unity.
  * 
  * @param[in,out] F Lineshape.  Must be right size
@@ -347,7 +372,9 @@ Numeric lte_linestrength(Numeric S0,
  * @param[in,out] dF Lineshape derivative.  Must be right size
  * @param[in,out] N Source lineshape
  * @param[in,out] dN Source lineshape derivative
- * @param[in]     line The absorption line
+ * @param[in]     F0 The central frequency of the line
+ * @param[in]     I0 The reference line strength of the line
+ * @param[in]     E0 The lower state energy of the line
  * @param[in]     T The atmospheric temperature
  * @param[in]     T0 The reference temperature
  * @param[in]     isotopic_ratio The ratio of the isotopologue in the atmosphere
@@ -364,7 +391,9 @@ void apply_linestrength_scaling_by_lte(
     Eigen::Ref<Eigen::MatrixXcd> dF,
     Eigen::Ref<Eigen::VectorXcd> N,
     Eigen::Ref<Eigen::MatrixXcd> dN,
-    const Absorption::SingleLine& line,
+    const Numeric& F0,
+    const Numeric& I0,
+    const Numeric& E0,
     const Numeric& T,
     const Numeric& T0,
     const Numeric& isotopic_ratio,
@@ -383,7 +412,9 @@ void apply_linestrength_scaling_by_lte(
  * @param[in,out] dF Lineshape derivative.  Must be right size
  * @param[in,out] N Source lineshape
  * @param[in,out] dN Source lineshape derivative
- * @param[in]     line The absorption line
+ * @param[in]     F0 The central frequency of the line
+ * @param[in]     I0 The reference line strength of the line
+ * @param[in]     E0 The lower state energy of the line
  * @param[in]     T The atmospheric temperature
  * @param[in]     T0 The reference temperature
  * @param[in]     Tu The upper state vibrational temperature; must be T if level is LTE
@@ -404,7 +435,9 @@ void apply_linestrength_scaling_by_vibrational_nlte(
   Eigen::Ref<Eigen::MatrixXcd> dF,
   Eigen::Ref<Eigen::VectorXcd> N,
   Eigen::Ref<Eigen::MatrixXcd> dN,
-  const Absorption::SingleLine& line,
+  const Numeric& F0,
+  const Numeric& I0,
+  const Numeric& E0,
   const Numeric& T,
   const Numeric& T0,
   const Numeric& Tu,
@@ -552,12 +585,68 @@ public:
   }
 };  // InternalData
 
+/** Computes the cross-section of a range of lines of an absorption band
+ * 
+ * Adds the lines [line_start, line_end) onto sum without resetting it first.
+ * Different ranges of the same band can thus be computed with independent
+ * scratch and sum data and added together afterwards
+ * 
+ * @param[in,out] scratch Data that is overwritten by every line
+ * @param[in,out] sum Data that is added onto by every line
+ * @param[in] f_full As WSV f_grid
+ * @param[in] band The absorption band
+ * @param[in] packed The lines of band as packed by Absorption::PackedLines(band)
+ * @param[in] shape The line shape parameters of band at P, T and vmrs, with temperature derivatives if these are required
+ * @param[in] derivatives_data Derivatives
+ * @param[in] derivatives_data_active Derivatives that are active
+ * @param[in] vmrs The VMRs of this band's broadening species
+ * @param[in] nlte A map of NLTE energy levels
+ * @param[in] P The pressure
+ * @param[in] T The temperature
+ * @param[in] isot_ratio The band isotopic ratio
+ * @param[in] H The strength of the magnetic field
+ * @param[in] DC As per DopplerConstant
+ * @param[in] dDCdT Temperature derivative of DC
+ * @param[in] QT The partition function at the temperature
+ * @param[in] dQTdT Temperature derivative of QT
+ * @param[in] QT0 The partition function at the band reference temperature
+ * @param[in] line_start First line to compute
+ * @param[in] line_end One past the last line to compute
+ * @param[in] zeeman The Zeeman components of band, or nullptr to compute the lines without Zeeman splitting
+ * @param[in] zeeman_polarization The polarization of the Zeeman components to add up
+ */
+void set_cross_section_of_lines(
+  InternalData& scratch,
+  InternalData& sum,
+  const Eigen::Ref<const Eigen::VectorXd> f_full,
+  const AbsorptionLines& band,
+  const Absorption::PackedLines& packed,
+  const Absorption::ShapeParameterTable& shape,
+  const ArrayOfRetrievalQuantity& derivatives_data,
+  const ArrayOfIndex& derivatives_data_active,
+  const Vector& vmrs,
+  const EnergyLevelMap& nlte,
+  const Numeric& P,
+  const Numeric& T,
+  const Numeric& isot_ratio,
+  const Numeric& H,
+  const Numeric& DC,
+  const Numeric& dDCdT,
+  const Numeric& QT,
+  const Numeric& dQTdT,
+  const Numeric& QT0,
+  const Index line_start,
+  const Index line_end,
+  const Absorption::ZeemanComponentTable* zeeman=nullptr,
+  const Zeeman::Polarization zeeman_polarization=Zeeman::Polarization::Pi);
+
 /** Computes the cross-section of an absorption band
  * 
  * @param[in,out] scratch Data that is overwritten by every line
  * @param[in,out] sun Data that is set to zero then added onto by every line
  * @param[in] f_grid As WSV
  * @param[in] band The absorption band
+ * @param[in] packed The lines of band as packed by Absorption::PackedLines(band)
  * @param[in] derivatives_data Derivatives
  * @param[in] derivatives_data_active Derivatives that are active
  * @param[in] vmrs The VMRs of this band's broadening species
@@ -572,14 +661,22 @@ public:
  * @param[in] dQTdT Temperature derivative of QT
  * @param[in] QT0 The partition function at the band reference temperature
  * @param[in] no_negatives Check sum.F before output of any real negative values, and removes them if present
- * @param[in] zeeman Attempts adding up the fine Zeeman lines
- * @param[in] zeeman_polarization The polarization of Zeeman model (to know how many Zeeman lines there will be)
+ * @param[in] zeeman The Zeeman components of band, or nullptr to compute the lines without Zeeman splitting
+ * @param[in] zeeman_polarization The polarization of the Zeeman components to add up
+ * @param[in] shape The line shape parameters of band at P, T and vmrs, computed here if nullptr
+ * 
+ * If not called from within a parallel region, bands with at least
+ * MinimumLinesPerThread() lines per available thread have their lines split
+ * into contiguous ranges computed by separate threads with private buffers.
+ * The partial sums are added in line order, so the result is reproducible
+ * for a given number of threads
  */
 void set_cross_section_of_band(
   InternalData& scratch,
   InternalData& sum,
   const ConstVectorView f_grid,
   const AbsorptionLines& band,
+  const Absorption::PackedLines& packed,
   const ArrayOfRetrievalQuantity& derivatives_data,
   const ArrayOfIndex& derivatives_data_active,
   const Vector& vmrs,
@@ -594,8 +691,226 @@ void set_cross_section_of_band(
   const Numeric& dQTdT,
   const Numeric& QT0,
   const bool no_negatives=false,
-  const bool zeeman=false,
-  const Zeeman::Polarization zeeman_polarization=Zeeman::Polarization::Pi);
+  const Absorption::ZeemanComponentTable* zeeman=nullptr,
+  const Zeeman::Polarization zeeman_polarization=Zeeman::Polarization::Pi,
+  const Absorption::ShapeParameterTable* shape=nullptr);
+
+/** Computes the cross-section of all Zeeman polarizations of a band
+ * 
+ * Gives the same sums as three calls to set_cross_section_of_band, one per
+ * polarization, but sets up each line only once and then adds its Zeeman
+ * components of all polarizations in the same pass
+ * 
+ * @param[in,out] scratch Data that is overwritten by every line
+ * @param[in,out] sums Data that is set to zero then added onto by every line, indexed by Zeeman::Polarization
+ * @param[in] f_grid As WSV
+ * @param[in] band The absorption band
+ * @param[in] packed The lines of band as packed by Absorption::PackedLines(band)
+ * @param[in] derivatives_data Derivatives
+ * @param[in] derivatives_data_active Derivatives that are active
+ * @param[in] vmrs The VMRs of this band's broadening species
+ * @param[in] nlte A map of NLTE energy levels
+ * @param[in] P The pressure
+ * @param[in] T The temperature
+ * @param[in] isot_ratio The band isotopic ratio
+ * @param[in] H The strength of the magnetic field
+ * @param[in] DC As per DopplerConstant
+ * @param[in] dDCdT Temperature derivative of DC
+ * @param[in] QT The partition function at the temperature
+ * @param[in] dQTdT Temperature derivative of QT
+ * @param[in] QT0 The partition function at the band reference temperature
+ * @param[in] no_negatives Check each sum's F before output of any real negative values, and removes them if present
+ * @param[in] zeeman The Zeeman components of band
+ * @param[in] shape The line shape parameters of band at P, T and vmrs, computed here if nullptr
+ */
+void set_zeeman_cross_section_of_band(
+  InternalData& scratch,
+  std::array<InternalData, 3>& sums,
+  const ConstVectorView f_grid,
+  const AbsorptionLines& band,
+  const Absorption::PackedLines& packed,
+  const ArrayOfRetrievalQuantity& derivatives_data,
+  const ArrayOfIndex& derivatives_data_active,
+  const Vector& vmrs,
+  const EnergyLevelMap& nlte,
+  const Numeric& P,
+  const Numeric& T,
+  const Numeric& isot_ratio,
+  const Numeric& H,
+  const Numeric& DC,
+  const Numeric& dDCdT,
+  const Numeric& QT,
+  const Numeric& dQTdT,
+  const Numeric& QT0,
+  const bool no_negatives,
+  const Absorption::ZeemanComponentTable& zeeman,
+  const Absorption::ShapeParameterTable* shape=nullptr);
+
+/** Line and frequency interaction index of a band on a sparse frequency grid
+ * 
+ * Every line center is binary-searched in the sorted frequency grid.  Lines
+ * within sparse_lim of at least one grid point are near lines and computed
+ * on the full grid.  All other lines are far lines.  These are computed by
+ * the Lorentz wing of their line shape on a coarse grid with spacing
+ * sparse_df that only holds the two coarse points around each full grid
+ * point, and their sum is linearly interpolated onto the full grid.
+ * 
+ * Widely spaced grids, such as a few isolated channels, need two coarse
+ * points for every grid point.  If the coarse grid is not smaller than the
+ * full grid, it is left empty and the far lines are computed by their Lorentz
+ * wings directly on the full grid.  If sparse_lim is not positive, all lines
+ * are near lines
+ */
+class SparseLineIndex {
+public:
+  /** Ranges [first, second) of lines computed on the full grid */
+  std::vector<std::pair<Index, Index>> near_ranges;
+  
+  /** Ranges [first, second) of lines computed on the coarse grid */
+  std::vector<std::pair<Index, Index>> far_ranges;
+  
+  /** The coarse grid */
+  Vector sparse_f_grid;
+  
+  /** Position in sparse_f_grid of the coarse point below each full grid point */
+  ArrayOfIndex sparse_pos;
+  
+  /** Interpolation weight of the coarse point above each full grid point */
+  Vector sparse_weight;
+  
+  /** Index computing all lines on the full grid */
+  SparseLineIndex() = default;
+  
+  /** Sets up the index
+   * 
+   * @param[in] f_grid As WSV, must be sorted
+   * @param[in] packed The lines of the band
+   * @param[in] sparse_df Spacing of the coarse grid
+   * @param[in] sparse_lim Distance to the closest grid point beyond which a line is far
+   */
+  SparseLineIndex(const ConstVectorView f_grid,
+                  const Absorption::PackedLines& packed,
+                  const Numeric& sparse_df,
+                  const Numeric& sparse_lim);
+  
+  /** Returns true if any line is a far line */
+  bool DoSparse() const noexcept { return not far_ranges.empty(); }
+  
+  /** Returns true if the far lines are computed on the coarse grid */
+  bool DoCoarse() const noexcept { return sparse_f_grid.nelem() > 0; }
+};  // SparseLineIndex
+
+/** Builds the coarse grid of SparseLineIndex
+ * 
+ * @param[out] sparse_f_grid Grid points n*sparse_df + f_grid[0] around each f_grid point
+ * @param[out] sparse_pos Position in sparse_f_grid of the point below each f_grid point
+ * @param[out] sparse_weight Interpolation weight of the point above each f_grid point
+ * @param[in] f_grid As WSV, must be sorted
+ * @param[in] sparse_df Spacing of the coarse grid
+ */
+void sparse_f_grid_setup(Vector& sparse_f_grid,
+                         ArrayOfIndex& sparse_pos,
+                         Vector& sparse_weight,
+                         const ConstVectorView f_grid,
+                         const Numeric& sparse_df);
+
+/** Upper bound of the relative interpolation error of a far line
+ * 
+ * The far wing of a pressure broadened line falls as 1/(f-F0)^2.  Linear
+ * interpolation over sparse_df of such a wing at least sparse_lim from the
+ * line center has relative error at most
+ * 0.75 sparse_df^2 sparse_lim^2 / (sparse_lim - sparse_df)^4
+ * 
+ * The bound also holds for the mirrored line, which is further away, and
+ * for first order line mixing, whose dispersive term falls as 1/(f-F0) and
+ * has at most a third of this relative error.  Doppler wings fall off faster
+ * and are negligible this far out.
+ * 
+ * The bound does not cover:
+ * - The Lorentz wing itself.  It differs from the Voigt wing by a relative
+ *   (GD / sparse_lim)^2 / 2 where GD is the Doppler width, and neglects
+ *   speed dependence and Dicke narrowing of HTP lines
+ * - The kink at the cutoff frequency of lines with a cutoff, see
+ *   sparse_cutoff_error_bound.  It is not present on widely spaced grids,
+ *   where far lines are not interpolated
+ * 
+ * @param[in] sparse_df Spacing of the coarse grid
+ * @param[in] sparse_lim Distance beyond which a line is far
+ * @return Relative error bound, or infinity if sparse_df >= sparse_lim
+ */
+Numeric sparse_relative_error_bound(const Numeric& sparse_df,
+                                    const Numeric& sparse_lim) noexcept;
+
+/** Upper bound of the interpolation error at the cutoff of a far line
+ * 
+ * Removing the cutoff value makes a line continuous at its cutoff
+ * frequency, but its slope jumps there.  Linear interpolation over the
+ * coarse interval holding the cutoff frequency then has an absolute error
+ * of up to sparse_df/4 times the slope of the wing at the cutoff.  For a
+ * 1/(f-F0)^2 wing with cutoff distance at least sparse_lim - sparse_df,
+ * which holds for every cutoff that reaches a coarse point, this is at most
+ * 0.5 sparse_df / (sparse_lim - sparse_df) times the wing value at the
+ * cutoff frequency
+ * 
+ * @param[in] sparse_df Spacing of the coarse grid
+ * @param[in] sparse_lim Distance beyond which a line is far
+ * @return Error bound relative to the wing at the cutoff, or infinity if sparse_df >= sparse_lim
+ */
+Numeric sparse_cutoff_error_bound(const Numeric& sparse_df,
+                                  const Numeric& sparse_lim) noexcept;
+
+/** Computes the cross-section of an absorption band using a sparse index
+ * 
+ * As set_cross_section_of_band but the far lines of the index are computed
+ * by their Lorentz wings, on the coarse grid and interpolated if the index
+ * has a coarse grid.  The band is computed by a single thread
+ * 
+ * @param[in,out] scratch Data that is overwritten by every line
+ * @param[in,out] sum Data that is set to zero then added onto by every line
+ * @param[in,out] sparse_scratch As scratch but of the size of the coarse grid
+ * @param[in,out] sparse_sum As sum but of the size of the coarse grid
+ * @param[in] f_grid As WSV
+ * @param[in] band The absorption band
+ * @param[in] packed The lines of band as packed by Absorption::PackedLines(band)
+ * @param[in] sparse The line and frequency interaction index of band on f_grid
+ * @param[in] derivatives_data Derivatives
+ * @param[in] derivatives_data_active Derivatives that are active
+ * @param[in] vmrs The VMRs of this band's broadening species
+ * @param[in] nlte A map of NLTE energy levels
+ * @param[in] P The pressure
+ * @param[in] T The temperature
+ * @param[in] isot_ratio The band isotopic ratio
+ * @param[in] H The strength of the magnetic field
+ * @param[in] DC As per DopplerConstant
+ * @param[in] dDCdT Temperature derivative of DC
+ * @param[in] QT The partition function at the temperature
+ * @param[in] dQTdT Temperature derivative of QT
+ * @param[in] QT0 The partition function at the band reference temperature
+ * @param[in] no_negatives Check sum.F before output of any real negative values, and removes them if present
+ */
+void set_sparse_cross_section_of_band(
+  InternalData& scratch,
+  InternalData& sum,
+  InternalData& sparse_scratch,
+  InternalData& sparse_sum,
+  const ConstVectorView f_grid,
+  const AbsorptionLines& band,
+  const Absorption::PackedLines& packed,
+  const SparseLineIndex& sparse,
+  const ArrayOfRetrievalQuantity& derivatives_data,
+  const ArrayOfIndex& derivatives_data_active,
+  const Vector& vmrs,
+  const EnergyLevelMap& nlte,
+  const Numeric& P,
+  const Numeric& T,
+  const Numeric& isot_ratio,
+  const Numeric& H,
+  const Numeric& DC,
+  const Numeric& dDCdT,
+  const Numeric& QT,
+  const Numeric& dQTdT,
+  const Numeric& QT0,
+  const bool no_negatives=false);
 };  // namespace Linefunctions
 
 #endif  //linefunctions_h
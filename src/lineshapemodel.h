@@ -779,6 +779,7 @@ enum class Type : Index {
   VP,    // Voigt
   SDVP,  // Speed-dependent Voigt
   HTP,   // Hartmann-Tran
+  FVP,   // Voigt with fast Faddeeva approximation
 };
 
 /** Turns selected Type into a string
@@ -802,6 +803,8 @@ inline String shapetype2string(Type type) noexcept {
       return "SDVP";
     case Type::HTP:
       return "HTP";
+    case Type::FVP:
+      return "FVP";
   }
   std::terminate();  // Not allowed to reach, fix higher level code
 }
@@ -827,6 +830,8 @@ inline String shapetype2metadatastring(Type type) noexcept {
       return "The line shape type is the speed-dependent Voigt profile.\n";
     case Type::HTP:
       return "The line shape type is the Hartmann-Tran profile.\n";
+    case Type::FVP:
+      return "The line shape type is the Voigt profile with a fast Faddeeva approximation.\n";
   }
   std::terminate();  // Not allowed to reach, fix higher level code
 }
@@ -851,6 +856,8 @@ inline Type string2shapetype(const String& type) {
     return Type::SDVP;
   else if (type == String("HTP"))
     return Type::HTP;
+  else if (type == String("FVP"))
+    return Type::FVP;
   else {
     std::ostringstream os;
     os << "Type: " << type << ", is not accepted.  "
@@ -41,6 +41,7 @@
 #include "file.h"
 #include "global_data.h"
 #include "jacobian.h"
+#include "linefunctions.h"
 #include "m_xml.h"
 #include "math_funcs.h"
 #include "matpackI.h"
@@ -510,11 +511,11 @@ void abs_xsec_per_speciesInit(  // WS Output:
     }
 
     if (do_jac) {
-      dabs_xsec_per_species_dx[ii] =
+      dabs_xsec_per_species_dx[i] =
           ArrayOfMatrix(jacobian_quantities_position.nelem(),
                         Matrix(f_grid.nelem(), abs_p.nelem(), 0.0));
       if (nlte_do)
-        dsrc_xsec_per_species_dx[ii] =
+        dsrc_xsec_per_species_dx[i] =
             ArrayOfMatrix(jacobian_quantities_position.nelem(),
                           Matrix(f_grid.nelem(), abs_p.nelem(), 0.0));
     }
@@ -590,12 +591,6 @@ void abs_xsec_per_speciesAddConts(  // WS Output:
     for (Index it = 0; it < abs_t.nelem(); it++) dabs_t[it] = abs_t[it] + dt;
   }
 
-  Matrix jacs_df, jacs_dt, normal;
-  if (do_jac) {
-    if (do_freq_jac) jacs_df.resize(f_grid.nelem(), abs_p.nelem());
-    if (do_temp_jac) jacs_dt.resize(f_grid.nelem(), abs_p.nelem());
-    normal.resize(f_grid.nelem(), abs_p.nelem());
-  }
   // Jacobian overhead END
 
   // Check, that dimensions of abs_cont_names and
@@ -643,17 +638,40 @@ void abs_xsec_per_speciesAddConts(  // WS Output:
     throw runtime_error(os.str());
   }
 
-  // We set abs_h2o, abs_n2, and abs_o2 later, because we only want to
-  // do it if the parameters are really needed.
+  // Set abs_h2o, abs_n2, and abs_o2 from the first matching species. They
+  // are the same for all continuum tags. The vmr is in
+  // abs_vmrs(i,Range(joker)). The other vmr variables, abs_h2o, abs_n2,
+  // and abs_o2 contains the real vmr of H2O, N2, nad O2, which are needed
+  // as additional information for certain continua:
+  // abs_h2o for
+  //   O2-PWR88, O2-PWR93, O2-PWR98,
+  //   O2-MPM85, O2-MPM87, O2-MPM89, O2-MPM92, O2-MPM93,
+  //   O2-TRE05,
+  //   O2-SelfContStandardType, O2-SelfContMPM93, O2-SelfContPWR93,
+  //   N2-SelfContMPM93, N2-DryContATM01,
+  //   N2-CIArotCKDMT252, N2-CIAfunCKDMT252
+  // abs_n2 for
+  //   H2O-SelfContCKD24, H2O-ForeignContCKD24,
+  //   O2-v0v0CKDMT100,
+  //   CO2-ForeignContPWR93, CO2-ForeignContHo66
+  // abs_o2 for
+  //   N2-CIArotCKDMT252, N2-CIAfunCKDMT252
+  set_vmr_from_first_species(abs_h2o, "H2O", tgs, abs_vmrs);
+  set_vmr_from_first_species(abs_n2, "N2", tgs, abs_vmrs);
+  set_vmr_from_first_species(abs_o2, "O2", tgs, abs_vmrs);
 
   out3 << "  Calculating continuum spectra.\n";
 
-  // Loop tag groups:
-  for (Index ii = 0; ii < abs_species_active.nelem(); ++ii) {
+  // Resolve the continuum tags of each active tag group to their model
+  // functions and the index in abs_cont_names, before any calculations.
+  using global_data::species_data;
+  const Index nactive = abs_species_active.nelem();
+  ArrayOfArrayOfString cont_tag_names(nactive);
+  ArrayOfArrayOfIndex cont_tag_n(nactive);
+  Array<Array<ContinuumTagFunction>> cont_tag_functions(nactive);
+  for (Index ii = 0; ii < nactive; ++ii) {
     const Index i = abs_species_active[ii];
 
-    using global_data::species_data;
-
     // Go through the tags in the current tag group to see if they
     // are continuum tags:
     for (Index s = 0; s < tgs[i].nelem(); ++s) {
@@ -670,7 +688,7 @@ void abs_xsec_per_speciesAddConts(  // WS Output:
                                 .Name();
 
         if (name == "O2-MPM2020") continue;
-                                
+
         // Check, if we have parameters for this model. For
         // this, the model name must be listed in
         // abs_cont_names.
@@ -686,49 +704,83 @@ void abs_xsec_per_speciesAddConts(  // WS Output:
           throw runtime_error(os.str());
         }
 
-        // Ok, the tag specifies a valid continuum model and
-        // we have continuum parameters.
+        cont_tag_names[ii].push_back(name);
+        cont_tag_n[ii].push_back(n);
+        cont_tag_functions[ii].push_back(continuum_tag_function(name));
+      }
+    }
+  }
 
-        if (out3.sufficient_priority()) {
-          ostringstream os;
-          os << "  Adding " << name << " to tag group " << i << ".\n";
-          out3 << os.str();
-        }
+  Matrix jacs_df, jacs_dt, normal;
+  if (do_jac) {
+    if (do_freq_jac) jacs_df.resize(f_grid.nelem(), abs_p.nelem());
+    if (do_temp_jac) jacs_dt.resize(f_grid.nelem(), abs_p.nelem());
+    normal.resize(f_grid.nelem(), abs_p.nelem());
+  }
 
-        // find the options for this continuum tag from the input array
-        // of options. The actual field of the array is n:
-        const String ContOption = abs_cont_models[n];
-
-        // Set abs_h2o, abs_n2, and abs_o2 from the first matching species.
-        set_vmr_from_first_species(abs_h2o, "H2O", tgs, abs_vmrs);
-        set_vmr_from_first_species(abs_n2, "N2", tgs, abs_vmrs);
-        set_vmr_from_first_species(abs_o2, "O2", tgs, abs_vmrs);
-
-        // Add the continuum for this tag. The parameters in
-        // this call should be clear. The vmr is in
-        // abs_vmrs(i,Range(joker)). The other vmr variables,
-        // abs_h2o, abs_n2, and abs_o2 contains the real vmr of H2O,
-        // N2, nad O2, which are needed as additional information for
-        // certain continua:
-        // abs_h2o for
-        //   O2-PWR88, O2-PWR93, O2-PWR98,
-        //   O2-MPM85, O2-MPM87, O2-MPM89, O2-MPM92, O2-MPM93,
-        //   O2-TRE05,
-        //   O2-SelfContStandardType, O2-SelfContMPM93, O2-SelfContPWR93,
-        //   N2-SelfContMPM93, N2-DryContATM01,
-        //   N2-CIArotCKDMT252, N2-CIAfunCKDMT252
-        // abs_n2 for
-        //   H2O-SelfContCKD24, H2O-ForeignContCKD24,
-        //   O2-v0v0CKDMT100,
-        //   CO2-ForeignContPWR93, CO2-ForeignContHo66
-        // abs_o2 for
-        //   N2-CIArotCKDMT252, N2-CIAfunCKDMT252
-        if (!do_jac)
-          xsec_continuum_tag(abs_xsec_per_species[i],
+  // Loop tag groups:
+  for (Index ii = 0; ii < nactive; ++ii) {
+    const Index i = abs_species_active[ii];
+
+    for (Index s = 0; s < cont_tag_names[ii].nelem(); ++s) {
+      // Ok, the tag specifies a valid continuum model and
+      // we have continuum parameters.
+      const String& name = cont_tag_names[ii][s];
+      const Index n = cont_tag_n[ii][s];
+      const ContinuumTagFunction function = cont_tag_functions[ii][s];
+
+      if (out3.sufficient_priority()) {
+        ostringstream os;
+        os << "  Adding " << name << " to tag group " << i << ".\n";
+        out3 << os.str();
+      }
+
+      // Add the continuum for this tag. The parameters in
+      // this call should be clear.
+      if (!do_jac)
+        xsec_continuum_tag(abs_xsec_per_species[i],
+                           function,
+                           name,
+                           abs_cont_parameters[n],
+                           abs_cont_models[n],
+                           f_grid,
+                           abs_p,
+                           abs_t,
+                           abs_n2,
+                           abs_h2o,
+                           abs_o2,
+                           abs_vmrs(i, Range(joker)),
+                           verbosity);
+      else  // The Jacobian block
+      {
+        // Needs a reseted block here...
+        if (do_freq_jac) jacs_df = 0.0;
+        if (do_temp_jac) jacs_dt = 0.0;
+        normal = 0.0;
+
+        // Normal calculations
+        xsec_continuum_tag(normal,
+                           function,
+                           name,
+                           abs_cont_parameters[n],
+                           abs_cont_models[n],
+                           f_grid,
+                           abs_p,
+                           abs_t,
+                           abs_n2,
+                           abs_h2o,
+                           abs_o2,
+                           abs_vmrs(i, Range(joker)),
+                           verbosity);
+
+        // Frequency calculations
+        if (do_freq_jac)
+          xsec_continuum_tag(jacs_df,
+                             function,
                              name,
                              abs_cont_parameters[n],
                              abs_cont_models[n],
-                             f_grid,
+                             dfreq,
                              abs_p,
                              abs_t,
                              abs_n2,
@@ -736,81 +788,42 @@ void abs_xsec_per_speciesAddConts(  // WS Output:
                              abs_o2,
                              abs_vmrs(i, Range(joker)),
                              verbosity);
-        else  // The Jacobian block
-        {
-          // Needs a reseted block here...
-          for (Index iv = 0; iv < f_grid.nelem(); iv++) {
-            for (Index ip = 0; ip < abs_p.nelem(); ip++) {
-              if (do_freq_jac) jacs_df(iv, ip) = 0.0;
-              if (do_temp_jac) jacs_dt(iv, ip) = 0.0;
-              normal(iv, ip) = 0.0;
-            }
-          }
 
-          // Normal calculations
-          xsec_continuum_tag(normal,
+        //Temperature calculations
+        if (do_temp_jac)
+          xsec_continuum_tag(jacs_dt,
+                             function,
                              name,
                              abs_cont_parameters[n],
                              abs_cont_models[n],
                              f_grid,
                              abs_p,
-                             abs_t,
+                             dabs_t,
                              abs_n2,
                              abs_h2o,
                              abs_o2,
                              abs_vmrs(i, Range(joker)),
                              verbosity);
-
-          // Frequency calculations
-          if (do_freq_jac)
-            xsec_continuum_tag(jacs_df,
-                               name,
-                               abs_cont_parameters[n],
-                               abs_cont_models[n],
-                               dfreq,
-                               abs_p,
-                               abs_t,
-                               abs_n2,
-                               abs_h2o,
-                               abs_o2,
-                               abs_vmrs(i, Range(joker)),
-                               verbosity);
-
-          //Temperature calculations
-          if (do_temp_jac)
-            xsec_continuum_tag(jacs_dt,
-                               name,
-                               abs_cont_parameters[n],
-                               abs_cont_models[n],
-                               f_grid,
-                               abs_p,
-                               dabs_t,
-                               abs_n2,
-                               abs_h2o,
-                               abs_o2,
-                               abs_vmrs(i, Range(joker)),
-                               verbosity);
-          for (Index iv = 0; iv < f_grid.nelem(); iv++) {
-            for (Index ip = 0; ip < abs_p.nelem(); ip++) {
-              abs_xsec_per_species[i](iv, ip) += normal(iv, ip);
-              for (Index iq = 0; iq < jacobian_quantities_position.nelem();
-                   iq++) {
-                if (is_frequency_parameter(
-                        jacobian_quantities[jacobian_quantities_position[iq]]))
-                  dabs_xsec_per_species_dx[i][iq](iv, ip) +=
-                      (jacs_df(iv, ip) - normal(iv, ip)) * (1. / df);
-                else if (jacobian_quantities
-                             [jacobian_quantities_position[iq]] ==
-                         JacPropMatType::Temperature)
-                  dabs_xsec_per_species_dx[i][iq](iv, ip) +=
-                      (jacs_dt(iv, ip) - normal(iv, ip)) * (1. / dt);
-              }
+        for (Index iv = 0; iv < f_grid.nelem(); iv++) {
+          for (Index ip = 0; ip < abs_p.nelem(); ip++) {
+            abs_xsec_per_species[i](iv, ip) += normal(iv, ip);
+            for (Index iq = 0; iq < jacobian_quantities_position.nelem();
+                 iq++) {
+              if (is_frequency_parameter(
+                      jacobian_quantities[jacobian_quantities_position[iq]]))
+                dabs_xsec_per_species_dx[i][iq](iv, ip) +=
+                    (jacs_df(iv, ip) - normal(iv, ip)) * (1. / df);
+              else if (jacobian_quantities
+                           [jacobian_quantities_position[iq]] ==
+                       JacPropMatType::Temperature)
+                dabs_xsec_per_species_dx[i][iq](iv, ip) +=
+                    (jacs_dt(iv, ip) - normal(iv, ip)) * (1. / dt);
             }
           }
         }
-        // Calling this function with a row of Matrix abs_vmrs
-        // is possible because it uses Views.
       }
+      // Calling this function with a row of Matrix abs_vmrs
+      // is possible because it uses Views.
     }
   }
 }
@@ -845,8 +858,10 @@ void abs_cont_descriptionAppend(  // WS Output:
     const String& model,
     const Vector& userparameters,
     const Verbosity&) {
-  // First we have to check that name matches a continuum species tag.
+  // First we have to check that name matches a continuum species tag,
+  // and that there is a model function for it.
   check_continuum_model(tagname);
+  continuum_tag_function(tagname);
 
   //cout << "   + tagname:    " << tagname << "\n";
   //cout << "   + model:      " << model << "\n";
@@ -1828,11 +1843,35 @@ void abs_xsec_per_speciesAddLines(
     const SpeciesAuxData& isotopologue_ratios,
     const SpeciesAuxData& partition_functions,
     const Index& lbl_checked,
-    const Verbosity&) {
+    const Numeric& sparse_df,
+    const Numeric& sparse_lim,
+    const Verbosity& verbosity) {
+  CREATE_OUT2;
+  
   if (not abs_lines_per_species.nelem()) return;
   
   if (not lbl_checked)
     throw std::runtime_error("Please set lbl_checked true to use this function");
+  
+  if (sparse_lim > 0) {
+    if (sparse_df <= 0 or sparse_df >= sparse_lim) {
+      std::ostringstream os;
+      os << "Must have 0 < sparse_df < sparse_lim, but sparse_df is "
+         << sparse_df << " Hz and sparse_lim is " << sparse_lim << " Hz\n";
+      throw std::runtime_error(os.str());
+    }
+    
+    out2 << "  Lines further than " << sparse_lim
+         << " Hz from f_grid are computed by their Lorentz wings and\n"
+         << "  interpolated from a grid with spacing " << sparse_df
+         << " Hz if that grid is smaller than f_grid\n"
+         << "  Relative error bound of interpolated line wings: "
+         << Linefunctions::sparse_relative_error_bound(sparse_df, sparse_lim)
+         << '\n'
+         << "  Error bound at line cutoffs relative to the wing at the cutoff: "
+         << Linefunctions::sparse_cutoff_error_bound(sparse_df, sparse_lim)
+         << '\n';
+  }
 
   // Check that all temperatures are above 0 K
   if (min(abs_t) < 0) {
@@ -1896,7 +1935,9 @@ void abs_xsec_per_speciesAddLines(
           lines,
           isotopologue_ratios.getIsotopologueRatio(lines.QuantumIdentity()),
           partition_functions.getParamType(lines.QuantumIdentity()),
-          partition_functions.getParam(lines.QuantumIdentity()));
+          partition_functions.getParam(lines.QuantumIdentity()),
+          sparse_df,
+          sparse_lim);
     }
   }  // End of species for loop.
 }
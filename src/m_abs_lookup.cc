@@ -24,6 +24,9 @@
 */
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
 #include <limits>
 #include <map>
 
@@ -34,6 +37,7 @@
 #include "auto_md.h"
 #include "check_input.h"
 #include "cloudbox.h"
+#include "file.h"
 #include "gas_abs_lookup.h"
 #include "global_data.h"
 #include "interpolation_poly.h"
@@ -45,6 +49,8 @@
 
 extern const Index GFIELD4_FIELD_NAMES;
 extern const Index GFIELD4_P_GRID;
+extern const String TEMPERATURE_MAINTAG;
+extern const String PROPMAT_SUBSUBTAG;
 
 /* Workspace method: Doxygen documentation will be auto-generated */
 void abs_lookupInit(GasAbsLookup& x, const Verbosity& verbosity) {
@@ -72,15 +78,17 @@ void abs_lookupCalc(  // Workspace reference:
     const Vector& abs_t_pert,
     const Vector& abs_nls_pert,
     const Agenda& abs_xsec_agenda,
+    // Control Parameters:
+    const Index& f_chunk,
+    const Index& p_chunk,
+    const String& checkpoint_file,
+    const Numeric& checkpoint_interval,
+    const Index& t_derivative,
     // Verbosity object:
     const Verbosity& verbosity) {
   CREATE_OUT2;
   CREATE_OUT3;
 
-  // We need this temporary variable to make a local copy of all VMRs,
-  // where we then perturb the H2O profile as needed
-  Matrix these_all_vmrs = abs_vmrs;
-
   // We will be calling an absorption agenda one species at a
   // time. This is better than doing all simultaneously, because is
   // saves memory and allows for consistent treatment of nonlinear
@@ -89,9 +97,6 @@ void abs_lookupCalc(  // Workspace reference:
 
   // 1. Output of absorption calculations:
 
-  // Absorption coefficients:
-  Matrix these_abs_coef;
-
   // Absorption cross sections per tag group.
   ArrayOfMatrix abs_xsec_per_species, src_xsec_per_species;
   ArrayOfArrayOfMatrix dabs_xsec_per_species_dx, dsrc_xsec_per_species_dx;
@@ -106,23 +111,32 @@ void abs_lookupCalc(  // Workspace reference:
 
   // 3. Input to absorption calculations:
 
-  // Absorption vmrs and temperature:
-  Matrix this_vmr(1, n_p_grid);
-  Vector abs_h2o(n_p_grid);
-  Vector this_t;  // Has same dimension, but is
-                  // initialized by assignment later.
+  // Absorption vmrs and temperature, for the pressure chunk of a task:
+  Matrix these_all_vmrs;
+  Vector this_t;
   const EnergyLevelMap this_nlte_dummy;
 
-  // Species list, lines, and line shapes, all with only 1 element:
-  ArrayOfArrayOfSpeciesTag this_species(1);
-
   // List of active species for agenda call. Will always be filled with only
   // one species.
   ArrayOfIndex abs_species_active(1);
 
-  // Local copy of nls_pert and t_pert:
-  Vector these_nls_pert;  // Is resized every time when used
-  Vector these_t_pert;    // Is resized later on
+  // Jacobian quantities for agenda call. Only the temperature, if the
+  // temperature derivative should be stored.
+  ArrayOfRetrievalQuantity t_jacobian(0);
+  if (t_derivative) {
+    RetrievalQuantity rq;
+    rq.MainTag(TEMPERATURE_MAINTAG);
+    rq.Subtag("HSE off");
+    rq.Mode("abs");
+    rq.Analytical(1);
+    rq.Perturbation(0.1);
+    rq.SubSubtag(PROPMAT_SUBSUBTAG);
+    rq.PropType(JacPropMatType::Temperature);
+    t_jacobian.push_back(rq);
+  }
+
+  // Local copy of t_pert:
+  Vector these_t_pert;  // Is resized later on
 
   // 4. Checks of input parameter correctness:
 
@@ -154,6 +168,14 @@ void abs_lookupCalc(  // Workspace reference:
     throw runtime_error(os.str());
   }
 
+  // Chunk sizes must not be negative:
+  if (f_chunk < 0 || p_chunk < 0) {
+    ostringstream os;
+    os << "The chunk sizes must be positive, or 0 for no chunking.\n"
+       << "f_chunk = " << f_chunk << ", p_chunk = " << p_chunk << ".";
+    throw runtime_error(os.str());
+  }
+
   // Set up the index array abs_nls from the tag array
   // abs_nls. Give an error message if these
   // tags are not included in abs_species.
@@ -202,6 +224,14 @@ void abs_lookupCalc(  // Workspace reference:
     non_linear[abs_nls_idx[s]] = 1;
   }
 
+  // The mapped format of the checkpoints has no temperature derivative:
+  if (t_derivative && checkpoint_file.nelem()) {
+    ostringstream os;
+    os << "Checkpoints are not possible for tables with the temperature\n"
+       << "derivative. Set *t_derivative* to 0, or *checkpoint_file* to \"\".";
+    throw runtime_error(os.str());
+  }
+
   // 5. Set general lookup table properties:
   abs_lookup.species = abs_species;  // Species list
   abs_lookup.nonlinear_species =
@@ -232,8 +262,16 @@ void abs_lookupCalc(  // Workspace reference:
 
     d = n_p_grid;
 
+    abs_lookup.ClearXsecStorage();
     abs_lookup.xsec.resize(a, b, c, d);
     abs_lookup.xsec = NAN;
+
+    if (t_derivative) {
+      abs_lookup.dxsec_dT.resize(a, b, c, d);
+      abs_lookup.dxsec_dT = NAN;
+    } else {
+      abs_lookup.dxsec_dT.resize(0, 0, 0, 0);
+    }
   }
 
   // 6.a. Set up these_t_pert. This is done so that we can use the
@@ -252,16 +290,26 @@ void abs_lookupCalc(  // Workspace reference:
   const Index these_t_pert_nelem = these_t_pert.nelem();
 
   // 7. Now we have to fill abs_lookup.xsec with the right values!
-
-  String fail_msg;
-  bool failed = false;
-
-  // We have to make a local copy of the Workspace and the agenda because
-  // only non-reference types can be declared firstprivate in OpenMP
-  Workspace l_ws(ws);
-  Agenda l_abs_xsec_agenda(abs_xsec_agenda);
-
-  // Loop species:
+  //
+  // The work is split into independent tasks, one for each species (and
+  // H2O VMR variant for nonlinear species), temperature perturbation,
+  // pressure chunk, and frequency chunk. All tasks go into a single
+  // parallel loop.
+
+  const Index this_f_chunk = f_chunk > 0 ? f_chunk : n_f_grid;
+  const Index this_p_chunk = p_chunk > 0 ? p_chunk : n_p_grid;
+
+  // One block of the lookup table to calculate:
+  struct LookupTask {
+    Index species;     // Index into abs_species
+    Index spec;        // Index for the second dimension of abs_lookup.xsec
+    Numeric nls_pert;  // Perturbation factor for the H2O VMR
+    Index t_pert;      // Index into these_t_pert
+    Range f_range;     // Part of f_grid
+    Range p_range;     // Part of abs_p
+  };
+
+  std::vector<LookupTask> tasks;
   for (Index i = 0, spec = 0; i < n_species; ++i) {
     // Skipping Zeeman and free_electrons species.
     // (Mixed tag groups between those and other species are not allowed.)
@@ -272,174 +320,243 @@ void abs_lookupCalc(  // Workspace reference:
       continue;
     }
 
-    // spec is the index for the second dimension of abs_lookup.xsec.
-
-    // Prepare absorption agenda input for this species:
-    out2 << "  Doing species " << i + 1 << " of " << n_species << ": "
-         << abs_species[i] << ".\n";
+    // Only nonlinear species have H2O VMR perturbations:
+    const Index these_nls_pert_nelem = non_linear[i] ? n_nls_pert : 1;
+    for (Index s = 0; s < these_nls_pert_nelem; ++s, ++spec)
+      for (Index j = 0; j < these_t_pert_nelem; ++j)
+        for (Index p0 = 0; p0 < n_p_grid; p0 += this_p_chunk)
+          for (Index f0 = 0; f0 < n_f_grid; f0 += this_f_chunk)
+            tasks.push_back(
+                {i,
+                 spec,
+                 non_linear[i] ? abs_nls_pert[s] : 1,
+                 j,
+                 Range(f0, min(this_f_chunk, n_f_grid - f0)),
+                 Range(p0, min(this_p_chunk, n_p_grid - p0))});
+  }
 
-    // Set active species:
-    abs_species_active[0] = i;
+  // Resume from a checkpoint, if there is one. A task is done if its
+  // block of the table has no NaN left.
+  ArrayOfIndex task_done(tasks.size(), 0);
+  if (checkpoint_file.nelem() && file_exists(checkpoint_file)) {
+    GasAbsLookup checkpoint;
+    checkpoint.ReadMapped(checkpoint_file);
+
+    const auto same = [](ConstVectorView a, ConstVectorView b) {
+      if (a.nelem() != b.nelem()) return false;
+      for (Index k = 0; k < a.nelem(); ++k)
+        if (a[k] != b[k]) return false;
+      return true;
+    };
+    bool matches = checkpoint.species == abs_lookup.species &&
+                   checkpoint.nonlinear_species ==
+                       abs_lookup.nonlinear_species &&
+                   same(checkpoint.f_grid, abs_lookup.f_grid) &&
+                   same(checkpoint.p_grid, abs_lookup.p_grid) &&
+                   same(checkpoint.t_ref, abs_lookup.t_ref) &&
+                   same(checkpoint.t_pert, abs_lookup.t_pert) &&
+                   same(checkpoint.nls_pert, abs_lookup.nls_pert) &&
+                   checkpoint.vmrs_ref.nrows() == n_species;
+    for (Index k = 0; matches && k < n_species; ++k)
+      matches =
+          same(checkpoint.vmrs_ref(k, joker), abs_lookup.vmrs_ref(k, joker));
+
+    if (!matches) {
+      ostringstream os;
+      os << "The checkpoint file " << checkpoint_file
+         << " belongs to a different lookup table.\n"
+         << "Remove it, or choose another checkpoint file.";
+      throw runtime_error(os.str());
+    }
 
-    // Get a dummy list of tag groups with only the current element:
-    this_species[0].resize(abs_species[i].nelem());
-    this_species[0] = abs_species[i];
+    abs_lookup.xsec = checkpoint.XsecTensor();
+    for (size_t k = 0; k < tasks.size(); ++k) {
+      const LookupTask& task = tasks[k];
+      task_done[k] = 1;
+      for (Index f = 0; task_done[k] && f < task.f_range.get_extent(); ++f)
+        for (Index p = 0; task_done[k] && p < task.p_range.get_extent(); ++p)
+          if (std::isnan(abs_lookup.xsec(task.t_pert,
+                                         task.spec,
+                                         task.f_range.get_start() + f,
+                                         task.p_range.get_start() + p)))
+            task_done[k] = 0;
+    }
+  }
 
-    // Set up these_nls_pert. This is done so that we can use the
-    // same loop over the perturbations, independent of
-    // whether we have nonlinear species or not.
-    if (non_linear[i]) {
-      out2 << "  This is a species with H2O VMR perturbations.\n";
-      these_nls_pert.resize(n_nls_pert);
-      these_nls_pert = abs_nls_pert;
-    } else {
-      these_nls_pert.resize(1);
-      these_nls_pert = 1;
+  const Index n_tasks = Index(tasks.size());
+  const Index n_tasks_todo =
+      n_tasks - std::count(task_done.begin(), task_done.end(), 1);
+  out2 << "  Calculating " << n_tasks_todo << " of " << n_tasks
+       << " blocks of the table (" << this_f_chunk << " frequencies, "
+       << this_p_chunk << " pressures each).\n";
+
+  // For progress reports and checkpoints:
+  using Clock = std::chrono::steady_clock;
+  const auto time_start = Clock::now();
+  auto time_report = time_start;
+  auto time_checkpoint = time_start;
+  const Numeric report_interval = 30;  // [s]
+  Index n_tasks_finished = 0;
+  Index n_points_finished = 0;
+
+  const auto seconds_since = [](const Clock::time_point& t) {
+    return std::chrono::duration<Numeric>(Clock::now() - t).count();
+  };
+
+  const auto write_checkpoint = [&](const GasAbsLookup& table) {
+    const String tmp_file = checkpoint_file + ".tmp";
+    table.WriteMapped(tmp_file);
+    if (std::rename(tmp_file.c_str(), checkpoint_file.c_str()) != 0) {
+      ostringstream os;
+      os << "Cannot move " << tmp_file << " to checkpoint file "
+         << checkpoint_file << ".";
+      throw runtime_error(os.str());
     }
+  };
 
-    // Loop these_nls_pert:
-    for (Index s = 0; s < these_nls_pert.nelem(); ++s, ++spec) {
-      // Remember, spec is the index for the second dimension of
-      // abs_lookup.xsec
+  String fail_msg;
+  bool failed = false;
 
-      if (non_linear[i]) {
-        out2 << "  Doing H2O VMR variant " << s + 1 << " of " << n_nls_pert
-             << ": " << abs_nls_pert[s] << ".\n";
-      }
+  // We have to make a local copy of the Workspace and the agenda because
+  // only non-reference types can be declared firstprivate in OpenMP
+  Workspace l_ws(ws);
+  Agenda l_abs_xsec_agenda(abs_xsec_agenda);
+
+#pragma omp parallel for schedule(dynamic) if (                   \
+    !arts_omp_in_parallel() &&                                    \
+    n_tasks_todo >= arts_omp_get_max_threads())                   \
+    private(this_t,                                               \
+            these_all_vmrs,                                       \
+            abs_species_active,                                   \
+            abs_xsec_per_species,                                 \
+            src_xsec_per_species,                                 \
+            dabs_xsec_per_species_dx,                             \
+            dsrc_xsec_per_species_dx)                             \
+    firstprivate(l_ws, l_abs_xsec_agenda)
+  for (Index k = 0; k < n_tasks; ++k) {
+    // Skip remaining iterations if an error occurred, or if the task
+    // was done before the checkpoint
+    if (failed || task_done[k]) continue;
+
+    const LookupTask& task = tasks[k];
+
+    // The try block here is necessary to correctly handle
+    // exceptions inside the parallel region.
+    try {
+      // Set active species:
+      abs_species_active.resize(1);
+      abs_species_active[0] = task.species;
+
+      // Create perturbed temperature profile:
+      this_t = abs_lookup.t_ref[task.p_range];
+      this_t += these_t_pert[task.t_pert];
 
       // Make a local copy of the VMRs, and manipulate the H2O VMR within it.
       // Note: We do not need a runtime error check that h2o_index is ok here,
       // because earlier on we throw an error if there is no H2O species although we
       // need it. So, if h2o_indes is -1, we here simply assume that there
       // should not be a perturbation
-      if (h2o_index >= 0) {
-        these_all_vmrs(h2o_index, joker) = abs_vmrs(h2o_index, joker);
-        these_all_vmrs(h2o_index, joker) *=
-            these_nls_pert[s];  // Add perturbation
+      these_all_vmrs = abs_vmrs(joker, task.p_range);
+      if (h2o_index >= 0) these_all_vmrs(h2o_index, joker) *= task.nls_pert;
+
+      // Call agenda to calculate absorption:
+      abs_xsec_agendaExecute(l_ws,
+                             abs_xsec_per_species,
+                             src_xsec_per_species,
+                             dabs_xsec_per_species_dx,
+                             dsrc_xsec_per_species_dx,
+                             abs_species,
+                             t_jacobian,
+                             abs_species_active,
+                             f_grid[task.f_range],
+                             abs_p[task.p_range],
+                             this_t,
+                             this_nlte_dummy,
+                             these_all_vmrs,
+                             l_abs_xsec_agenda);
+
+      if (t_derivative and
+          (dabs_xsec_per_species_dx.nelem() <= task.species or
+           dabs_xsec_per_species_dx[task.species].nelem() != 1)) {
+        ostringstream os;
+        os << "*abs_xsec_agenda* did not return the temperature derivative\n"
+           << "of the cross sections of species "
+           << get_tag_group_name(abs_species[task.species]) << ".";
+        throw runtime_error(os.str());
       }
 
-      // VMR for this species (still needed by interfact to continua):
-      // FIXME: This variable may go away eventually, when the continuum
-      // part no longer needs it.
-      this_vmr(0, joker) = these_all_vmrs(i, joker);
-
-      // For abs_h2o, we can always add the perturbations (it will
-      // not make a difference if the species itself is also H2O).
-      // Attention, we need to treat here also the case that there
-      // is no H2O species. We will then set abs_h2o to
-      // -1. Absorption routines that do not really need abs_h2o
-      // will still run.
+      // Store in the right place. There used to be a division by the
+      // number density here. This is no longer necessary, since
+      // abs_xsec_per_species now contains true absorption cross
+      // sections.
       //
-      // FIXME: abs_h2o is currently still needed by the continuum part.
-      // Should go away eventually.
-      if (h2o_index == -1) {
-        // The case without H2O species.
-        abs_h2o.resize(1);
-        abs_h2o = -1;
-      } else {
-        // The normal case.
-        abs_h2o = these_all_vmrs(h2o_index, joker);
-      }
-
-      // Loop temperature perturbations
-      // ------------------------------
-
-      // We use a parallel for loop for this.
-
-      // There is something strange here: abs_lookup seems to be
-      // "shared" by default, although I have set default(none). I
-      // suspect that the reason for this behavior is that
-      // abs_lookup is a return by reference parameter of this
-      // function. Anyway, shared is the correct setting for
-      // abs_lookup, so there is no problem.
-
-#pragma omp parallel for if (                                         \
-    !arts_omp_in_parallel() &&                                        \
-    these_t_pert_nelem >=                                             \
-        arts_omp_get_max_threads()) private(this_t,                   \
-                                            abs_xsec_per_species,     \
-                                            src_xsec_per_species,     \
-                                            dabs_xsec_per_species_dx, \
-                                            dsrc_xsec_per_species_dx) \
-    firstprivate(l_ws, l_abs_xsec_agenda)
-      for (Index j = 0; j < these_t_pert_nelem; ++j) {
-        // Skip remaining iterations if an error occurred
-        if (failed) continue;
-
-        // The try block here is necessary to correctly handle
-        // exceptions inside the parallel region.
-        try {
-          if (0 != n_t_pert) {
-            // We first prepare the output in a string here,
-            // so that we can write it to out3 with a single
-            // operation. This avoids messy output from
-            // multiple threads.
-            ostringstream os;
-
-            os << "  Doing temperature variant " << j + 1 << " of " << n_t_pert
-               << ": " << these_t_pert[j] << ".\n";
-
-            out3 << os.str();
-          }
+      // A checkpoint is a copy of the table taken under the lock. It is
+      // written to disk outside of it, so that the other threads only wait
+      // for the copy, not for the file system. A slow write can put an
+      // older copy on disk after a newer one. Both are consistent, so
+      // this only loses some finished blocks for a restart.
+      GasAbsLookup checkpoint;
+      bool write_checkpoint_now = false;
+#pragma omp critical(abs_lookupCalc_store)
+      {
+        abs_lookup.xsec(task.t_pert, task.spec, task.f_range, task.p_range) =
+            abs_xsec_per_species[task.species];
+        if (t_derivative)
+          abs_lookup.dxsec_dT(
+              task.t_pert, task.spec, task.f_range, task.p_range) =
+              dabs_xsec_per_species_dx[task.species][0];
+
+        n_tasks_finished++;
+        n_points_finished +=
+            task.f_range.get_extent() * task.p_range.get_extent();
+
+        // Report progress and copy checkpoints from within the
+        // critical section, so that the table is consistent.
+        if (seconds_since(time_report) >= report_interval ||
+            n_tasks_finished == n_tasks_todo) {
+          const Numeric elapsed = seconds_since(time_start);
+          ostringstream os;
+          os << "  Lookup table: " << n_tasks_finished << " of "
+             << n_tasks_todo << " blocks done, "
+             << Numeric(n_points_finished) / elapsed
+             << " (f, p) points per second, about "
+             << Index(elapsed * Numeric(n_tasks_todo - n_tasks_finished) /
+                      Numeric(n_tasks_finished))
+             << " s left.\n";
+          out2 << os.str();
+          time_report = Clock::now();
+        }
 
-          // Create perturbed temperature profile:
-          this_t = abs_lookup.t_ref;
-          this_t += these_t_pert[j];
-
-          // Call agenda to calculate absorption:
-          abs_xsec_agendaExecute(l_ws,
-                                 abs_xsec_per_species,
-                                 src_xsec_per_species,
-                                 dabs_xsec_per_species_dx,
-                                 dsrc_xsec_per_species_dx,
-                                 abs_species,
-                                 ArrayOfRetrievalQuantity(0),
-                                 abs_species_active,
-                                 f_grid,
-                                 abs_p,
-                                 this_t,
-                                 this_nlte_dummy,
-                                 these_all_vmrs,
-                                 l_abs_xsec_agenda);
-
-          // Store in the right place:
-          // Loop through all altitudes
-          for (Index p = 0; p < n_p_grid; ++p) {
-            abs_lookup.xsec(j, spec, Range(joker), p) =
-                abs_xsec_per_species[i](Range(joker), p);
-
-            // There used to be a division by the number density
-            // n here. This is no longer necessary, since
-            // abs_xsec_per_species now contains true absorption
-            // cross sections.
-
-            // IMPORTANT: There was a bug in my old Matlab
-            // function "create_lookup.m" to generate the lookup
-            // table. (The number density was always the
-            // reference one, and did not change for different
-            // temperatures.) Patricks Atmlab function
-            // "arts_abstable_from_arts1.m" did *not* have this bug.
-
-            // Calculate the number density for the given pressure and
-            // temperature:
-            // n = n0*T0/p0 * p/T or n = p/kB/t, ideal gas law
-            //                  const Numeric n = number_density( abs_lookup.p_grid[p],
-            //                                                    this_t[p]   );
-            //                  abs_lookup.xsec( j, spec, Range(joker), p ) /= n;
-          }
-        }  // end of try block
-        catch (const std::runtime_error& e) {
-#pragma omp critical(abs_lookupCalc_fail)
-          {
-            fail_msg = e.what();
-            failed = true;
-          }
+        if (checkpoint_file.nelem() &&
+            seconds_since(time_checkpoint) >= checkpoint_interval &&
+            n_tasks_finished < n_tasks_todo) {
+          checkpoint = abs_lookup;
+          write_checkpoint_now = true;
+          time_checkpoint = Clock::now();
         }
-      }  // end of parallel for loop
+      }
 
-      if (failed) throw runtime_error(fail_msg);
+      if (write_checkpoint_now) {
+#pragma omp critical(abs_lookupCalc_checkpoint)
+        {
+          out3 << "  Writing checkpoint " << checkpoint_file << ".\n";
+          write_checkpoint(checkpoint);
+        }
+      }
+    }  // end of try block
+    catch (const std::runtime_error& e) {
+#pragma omp critical(abs_lookupCalc_fail)
+      {
+        fail_msg = e.what();
+        failed = true;
+      }
     }
-  }
+  }  // end of parallel for loop
+
+  if (failed) throw runtime_error(fail_msg);
+
+  // The complete table is the final checkpoint:
+  if (checkpoint_file.nelem()) write_checkpoint(abs_lookup);
 
   // 6. Initialize fgp_default.
   abs_lookup.fgp_default.resize(f_grid.nelem());
@@ -2018,6 +2135,56 @@ void abs_lookupAdapt(GasAbsLookup& abs_lookup,
   abs_lookup_is_adapted = 1;
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void abs_lookupCompress(GasAbsLookup& abs_lookup,
+                        const Index& abs_lookup_is_adapted,
+                        const String& precision,
+                        const Verbosity& verbosity) {
+  CREATE_OUT2;
+
+  if (1 != abs_lookup_is_adapted)
+    throw runtime_error(
+        "Gas absorption lookup table must be adapted before compression,\n"
+        "use method abs_lookupAdapt.");
+
+  if (precision == "Double")
+    abs_lookup.Compress(GasAbsLookup::XsecPrecision::Double);
+  else if (precision == "Float32")
+    abs_lookup.Compress(GasAbsLookup::XsecPrecision::Float32);
+  else if (precision == "Float16")
+    abs_lookup.Compress(GasAbsLookup::XsecPrecision::Float16);
+  else {
+    ostringstream os;
+    os << "Unknown precision \"" << precision << "\".\n"
+       << "Valid precisions are \"Double\", \"Float32\", and \"Float16\".";
+    throw runtime_error(os.str());
+  }
+
+  out2 << "  Lookup table cross sections stored as " << precision << ".\n";
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void abs_lookupReadMapped(GasAbsLookup& abs_lookup,
+                          const String& filename,
+                          const Verbosity& verbosity) {
+  CREATE_OUT2;
+
+  abs_lookup.ReadMapped(filename);
+  out2 << "  Mapped lookup table from " << filename << ": "
+       << abs_lookup.Species().nelem() << " species, "
+       << abs_lookup.Fgrid().nelem() << " frequencies.\n";
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void abs_lookupWriteMapped(const GasAbsLookup& abs_lookup,
+                           const String& filename,
+                           const Verbosity& verbosity) {
+  CREATE_OUT2;
+
+  abs_lookup.WriteMapped(filename);
+  out2 << "  Wrote lookup table to " << filename << ".\n";
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void propmat_clearskyAddFromLookup(
     ArrayOfPropagationMatrix& propmat_clearsky,
@@ -2039,6 +2206,7 @@ void propmat_clearskyAddFromLookup(
 
   // Variables needed by abs_lookup.Extract:
   Matrix abs_scalar_gas, dabs_scalar_gas_df, dabs_scalar_gas_dt;
+  Matrix dabs_scalar_gas_dnls;
 
   // Check if the table has been adapted:
   if (1 != abs_lookup_is_adapted)
@@ -2050,10 +2218,22 @@ void propmat_clearskyAddFromLookup(
   const bool do_freq_jac = do_frequency_jacobian(jacobian_quantities);
   const bool do_temp_jac = do_temperature_jacobian(jacobian_quantities);
   const Numeric df = frequency_perturbation(jacobian_quantities);
-  const Numeric dt = temperature_perturbation(jacobian_quantities);
   const ArrayOfIndex jacobian_quantities_position =
       equivalent_propmattype_indexes(jacobian_quantities);
 
+  // The species the nonlinear species of the table depend on, and
+  // whether there is a VMR Jacobian for it:
+  const Index nls_vmr_species = abs_lookup.NonLinearVmrSpecies();
+  bool do_nls_jac = false;
+  for (Index iq = 0; iq < jacobian_quantities_position.nelem(); iq++) {
+    const RetrievalQuantity& rq =
+        jacobian_quantities[jacobian_quantities_position[iq]];
+    if (nls_vmr_species >= 0 and rq == JacPropMatType::VMR and
+        rq.QuantumIdentity().Species() ==
+            abs_lookup.GetSpeciesIndex(nls_vmr_species))
+      do_nls_jac = true;
+  }
+
   // The combination of doing frequency jacobian together with an
   // absorption lookup table is quite dangerous. If the frequency
   // interpolation order for the table is zero, the Jacobian will be
@@ -2066,8 +2246,13 @@ void propmat_clearskyAddFromLookup(
   
   // The function we are going to call here is one of the few helper
   // functions that adjust the size of their output argument
-  // automatically.
+  // automatically. The temperature and H2O derivatives come from the
+  // same extraction.
   abs_lookup.Extract(abs_scalar_gas,
+                     dabs_scalar_gas_dt,
+                     dabs_scalar_gas_dnls,
+                     do_temp_jac,
+                     do_nls_jac,
                      abs_p_interp_order,
                      abs_t_interp_order,
                      abs_nls_interp_order,
@@ -2091,19 +2276,6 @@ void propmat_clearskyAddFromLookup(
                        dfreq,
                        extpolfac);
   }
-  if (do_temp_jac) {
-    const Numeric dtemp = a_temperature + dt;
-    abs_lookup.Extract(dabs_scalar_gas_dt,
-                       abs_p_interp_order,
-                       abs_t_interp_order,
-                       abs_nls_interp_order,
-                       abs_f_interp_order,
-                       a_pressure,
-                       dtemp,
-                       a_vmr_list,
-                       f_grid,
-                       extpolfac);
-  }
 
   // Now add to the right place in the absorption matrix.
 
@@ -2120,8 +2292,7 @@ void propmat_clearskyAddFromLookup(
         for (Index iq = 0; iq < jacobian_quantities_position.nelem(); iq++) {
           if (jacobian_quantities[jacobian_quantities_position[iq]] ==
               JacPropMatType::Temperature) {
-            dpropmat_clearsky_dx[iq].Kjj()[iv] +=
-                (dabs_scalar_gas_dt(isp, iv) - abs_scalar_gas(isp, iv)) / dt;
+            dpropmat_clearsky_dx[iq].Kjj()[iv] += dabs_scalar_gas_dt(isp, iv);
           } else if (is_frequency_parameter(
                          jacobian_quantities
                              [jacobian_quantities_position[iq]])) {
@@ -2129,6 +2300,15 @@ void propmat_clearskyAddFromLookup(
                 (dabs_scalar_gas_df(isp, iv) - abs_scalar_gas(isp, iv)) / df;
           } else if (jacobian_quantities[jacobian_quantities_position[iq]] ==
                      JacPropMatType::VMR) {
+            // Nonlinear species depend on the H2O VMR:
+            if (do_nls_jac and
+                jacobian_quantities[jacobian_quantities_position[iq]]
+                        .QuantumIdentity()
+                        .Species() ==
+                    abs_lookup.GetSpeciesIndex(nls_vmr_species))
+              dpropmat_clearsky_dx[iq].Kjj()[iv] +=
+                  dabs_scalar_gas_dnls(isp, iv);
+
             if (jacobian_quantities[jacobian_quantities_position[iq]]
                     .QuantumIdentity()
                     .Species() not_eq abs_lookup.GetSpeciesIndex(isp))
@@ -2144,6 +2324,54 @@ void propmat_clearskyAddFromLookup(
   }
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void abs_coefCalcFromLookup(Matrix& abs_coef,
+                            ArrayOfMatrix& abs_coef_per_species,
+                            const GasAbsLookup& abs_lookup,
+                            const Index& abs_lookup_is_adapted,
+                            const Index& abs_p_interp_order,
+                            const Index& abs_t_interp_order,
+                            const Index& abs_nls_interp_order,
+                            const Index& abs_f_interp_order,
+                            const Vector& f_grid,
+                            const Vector& abs_p,
+                            const Vector& abs_t,
+                            const Matrix& abs_vmrs,
+                            const Numeric& extpolfac,
+                            const Verbosity&) {
+  // Check if the table has been adapted:
+  if (1 != abs_lookup_is_adapted)
+    throw runtime_error(
+        "Gas absorption lookup table must be adapted,\n"
+        "use method abs_lookupAdapt.");
+
+  // All points in one go, dimension is [p, species, f_grid]
+  Tensor3 sga;
+  abs_lookup.Extract(sga,
+                     abs_p_interp_order,
+                     abs_t_interp_order,
+                     abs_nls_interp_order,
+                     abs_f_interp_order,
+                     abs_p,
+                     abs_t,
+                     abs_vmrs,
+                     f_grid,
+                     extpolfac);
+
+  const Index n_p = sga.npages();
+  const Index n_species = sga.nrows();
+  const Index n_f = sga.ncols();
+
+  abs_coef.resize(n_f, n_p);
+  abs_coef = 0;
+  abs_coef_per_species.resize(n_species);
+  for (Index isp = 0; isp < n_species; isp++) {
+    abs_coef_per_species[isp].resize(n_f, n_p);
+    abs_coef_per_species[isp] = transpose(sga(joker, isp, joker));
+    abs_coef += abs_coef_per_species[isp];
+  }
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void propmat_clearsky_fieldCalc(Workspace& ws,
                                 // WS Output:
@@ -2563,6 +2791,73 @@ Numeric calc_lookup_error(  // Parameters for lookup table:
   return max_abs_rel_diff;
 }
 
+//! Compare lookup table extraction at two storage precisions.
+/*!
+  This is a helper function used by abs_lookupTestAccuracy. It extracts
+  absorption for the same local conditions from a table and from a
+  compressed copy of it.
+
+  \param al                   Lookup table
+  \param al_compressed        The same table with reduced precision
+  \param abs_p_interp_order   Pressure interpolation order.
+  \param abs_t_interp_order   Temperature interpolation order.
+  \param abs_nls_interp_order H2O interpolation order.
+  \param local_p 
+  \param local_t 
+  \param local_vmrs 
+
+  \return The maximum of the absolute value of the relative difference
+  between the two tables, in percent. Or -1 if the conditions are outside
+  of the table.
+*/
+Numeric calc_precision_error(const GasAbsLookup& al,
+                             const GasAbsLookup& al_compressed,
+                             const Index& abs_p_interp_order,
+                             const Index& abs_t_interp_order,
+                             const Index& abs_nls_interp_order,
+                             const Numeric& local_p,
+                             const Numeric& local_t,
+                             const Vector& local_vmrs) {
+  Matrix sga, sga_compressed;  // Dimension [n_species,n_f_grid]
+
+  try {
+    al.Extract(sga,
+               abs_p_interp_order,
+               abs_t_interp_order,
+               abs_nls_interp_order,
+               0,  // f_interp_order
+               local_p,
+               local_t,
+               local_vmrs,
+               al.GetFgrid(),
+               0.0);  // Extpolfac
+    al_compressed.Extract(sga_compressed,
+                          abs_p_interp_order,
+                          abs_t_interp_order,
+                          abs_nls_interp_order,
+                          0,  // f_interp_order
+                          local_p,
+                          local_t,
+                          local_vmrs,
+                          al.GetFgrid(),
+                          0.0);  // Extpolfac
+  } catch (const std::runtime_error&) {
+    return -1;
+  }
+
+  // Compare total absorption:
+  Numeric max_abs_rel_diff = 0;
+  for (Index i = 0; i < sga.ncols(); ++i) {
+    const Numeric abs_ref = sga(joker, i).sum();
+    if (abs_ref != 0)
+      max_abs_rel_diff = max(
+          max_abs_rel_diff,
+          fabs((sga_compressed(joker, i).sum() - abs_ref) / abs_ref * 100));
+  }
+
+  return max_abs_rel_diff;
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void abs_lookupTestAccuracy(  // Workspace reference:
     Workspace& ws,
@@ -2861,6 +3156,54 @@ void abs_lookupTestAccuracy(  // Workspace reference:
        << "  Pressure interpolation:    " << err_p << "%\n"
        << "  Total error:               " << err_tot << "%\n";
 
+  // Check the error from reduced storage precision of the cross
+  // sections. This compares with the full table at the reference
+  // conditions of each pressure level, so there is no LBL
+  // calculation involved.
+  if (al.IsCompressed()) {
+    out2 << "  The table has reduced storage precision, the errors above\n"
+         << "  include the error from that.\n";
+  } else {
+    const std::vector<std::pair<GasAbsLookup::XsecPrecision, String>>
+        precisions{{GasAbsLookup::XsecPrecision::Float32, "Float32"},
+                   {GasAbsLookup::XsecPrecision::Float16, "Float16"}};
+
+    out2 << "  Max. of absolute value of relative error in percent from\n"
+         << "  reduced storage precision (see abs_lookupCompress):\n";
+
+    for (auto& precision : precisions) {
+      GasAbsLookup al_compressed = al;
+      al_compressed.Compress(precision.first);
+
+      Numeric err_prec = -999;
+
+#pragma omp parallel for if (!arts_omp_in_parallel())
+      for (Index pi = 0; pi < n_p; ++pi) {
+        // Reference conditions, with the first perturbations as above:
+        const Numeric local_t = al.t_ref[pi] + al.t_pert[0];
+        Vector local_vmrs = al.vmrs_ref(joker, pi);
+        local_vmrs[h2o_index] *= al.nls_pert[0];
+
+        const Numeric max_abs_rel_diff =
+            calc_precision_error(al,
+                                 al_compressed,
+                                 abs_p_interp_order,
+                                 abs_t_interp_order,
+                                 abs_nls_interp_order,
+                                 al.p_grid[pi],
+                                 local_t,
+                                 local_vmrs);
+
+#pragma omp critical(abs_lookupTestAccuracy_prec)
+        {
+          if (max_abs_rel_diff > err_prec) err_prec = max_abs_rel_diff;
+        }
+      }
+
+      out2 << "  " << precision.second << " storage: " << err_prec << "%\n";
+    }
+  }
+
   // Check pressure interpolation
 
   //   assert(p_grid.nelem()==log_p_grid.nelem()); // Make sure that log_p_grid is initialized.
@@ -27,11 +27,16 @@
  * @brief  Contains the user interaction with absorption lines
  **/
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <set>
 #include "absorptionlines.h"
 #include "auto_md.h"
 #include "file.h"
 #include "global_data.h"
 #include "xml_io_private.h"
+#include "xml_io_types.h"
 #include "m_xml.h"
 
 /////////////////////////////////////////////////////////////////////////////////////
@@ -262,45 +267,30 @@ void ReadARTSCAT(ArrayOfAbsorptionLines& abs_lines,
     throw runtime_error(os.str());
   }
   
-  std::vector<Absorption::SingleLineExternal> v(0);
-  
-  bool go_on = true;
-  Index n = 0;
-  while (n<nelem) {
-    if (go_on) {
-      switch(artscat_version) {
-        case 3:
-          v.push_back(Absorption::ReadFromArtscat3Stream(is_xml));
-          break;
-        case 4:
-          v.push_back(Absorption::ReadFromArtscat4Stream(is_xml));
-          break;
-        case 5:
-          v.push_back(Absorption::ReadFromArtscat5Stream(is_xml));
-          break;
-        default:
-          throw std::runtime_error("Bad version!");
-      }
-      
-      if (v.back().bad) {
-        v.pop_back();
-        go_on = false;
-      } else if (v.back().line.F0() < fmin) {
-        v.pop_back();
-      } else if (v.back().line.F0() > fmax) {
-        v.pop_back();
-        go_on = false;
-      }
-    } else {
-      String line;
-      getline(is_xml, line);
-    }
-    
-    n++;
+  Absorption::SingleLineExternal (*reader)(istream&);
+  switch(artscat_version) {
+    case 3:
+      reader = Absorption::ReadFromArtscat3Stream;
+      break;
+    case 4:
+      reader = Absorption::ReadFromArtscat4Stream;
+      break;
+    case 5:
+      reader = Absorption::ReadFromArtscat5Stream;
+      break;
+    default:
+      throw std::runtime_error("Bad version!");
   }
   
-  tag.read_from_stream(is_xml);
-  tag.check_name("/ArrayOfLineRecord");
+  // The records up to the closing tag are parsed in parallel. Reading
+  // stops at the first record above fmax.
+  auto v = Absorption::parallel_read_external_lines(is_xml, reader, fmin, fmax, "</ArrayOfLineRecord>");
+  
+  if (Index(v.size()) > nelem) {
+    ostringstream os;
+    os << "The ARTS line file contains more than the " << nelem << " line records given in its header.";
+    throw runtime_error(os.str());
+  }
   
   for (auto& x: v)
     x.line.Zeeman() = Zeeman::GetAdvancedModel(x.quantumidentity);
@@ -472,35 +462,24 @@ void ReadHITRAN(ArrayOfAbsorptionLines& abs_lines,
   ifstream is;
   open_input_file(is, hitran_file);
   
-  std::vector<Absorption::SingleLineExternal> v(0);
-  
-  bool go_on = true;
-  while (go_on) {
-    switch (hitran_version) {
-      case HitranType::Post2004:
-        v.push_back(Absorption::ReadFromHitran2004Stream(is));
-        break;
-      case HitranType::Pre2004:
-        v.push_back(Absorption::ReadFromHitran2001Stream(is));
-        break;
-      case HitranType::Online:
-        v.push_back(Absorption::ReadFromHitranOnlineStream(is));
-        break;
-      default:
-        throw std::runtime_error("A bad developer did not throw in time to stop this message.\nThe HitranType enum class has to be fully updated!\n");
-    }
-    
-    if (v.back().bad) {
-      v.pop_back();
-      go_on = false;
-    } else if (v.back().line.F0() < fmin) {
-        v.pop_back();
-    } else if (v.back().line.F0() > fmax) {
-      v.pop_back();
-      go_on = false;
-    }
+  Absorption::SingleLineExternal (*reader)(istream&);
+  switch (hitran_version) {
+    case HitranType::Post2004:
+      reader = Absorption::ReadFromHitran2004Stream;
+      break;
+    case HitranType::Pre2004:
+      reader = Absorption::ReadFromHitran2001Stream;
+      break;
+    case HitranType::Online:
+      reader = Absorption::ReadFromHitranOnlineStream;
+      break;
+    default:
+      throw std::runtime_error("A bad developer did not throw in time to stop this message.\nThe HitranType enum class has to be fully updated!\n");
   }
   
+  // The file is parsed in parallel, up to the first line above fmax
+  auto v = Absorption::parallel_read_external_lines(is, reader, fmin, fmax);
+  
   for (auto& x: v)
     x.line.Zeeman() = Zeeman::GetAdvancedModel(x.quantumidentity);
   
@@ -943,6 +922,289 @@ void abs_lines_per_speciesReadSpeciesSplitCatalog(ArrayOfArrayOfAbsorptionLines&
   abs_lines_per_speciesCreateFromLines(abs_lines_per_species, abs_lines, abs_species, verbosity);
 }
 
+/////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////// Binary indexed line catalog
+/////////////////////////////////////////////////////////////////////////////////////
+
+/* The binary catalog is a single file with the layout
+ *
+ *   "ARTSLCT1"                     magic
+ *   nspecies, {length, name}       species names, e.g. "H2O-161"
+ *   nbands, index position
+ *   {line data, length, xml tag}   per band, as written by binary XML
+ *   {species, f0min, f0max,        index, per band
+ *    flow, fupp, data and tag
+ *    position}
+ *
+ * Integers are written as long, floats as double, both little endian.
+ * [flow, fupp] is the frequency range a band can contribute to given its
+ * cutoff and mirroring, so only the bands that matter for a frequency
+ * grid have to be read.
+ */
+namespace {
+const char binary_catalog_magic[] = "ARTSLCT1";
+constexpr std::streamsize binary_catalog_magic_size = 8;
+
+/** Index entry of one band in the binary catalog */
+struct BinaryCatalogEntry {
+  long species;
+  Numeric f0min;
+  Numeric f0max;
+  Numeric flow;
+  Numeric fupp;
+  long data_position;
+  long tag_position;
+};
+
+/** Frequency range a band can contribute to
+ * 
+ * @param[in] band The absorption band
+ * @param[out] entry The entry where f0min, f0max, flow and fupp are set
+ */
+void set_binary_catalog_range(const AbsorptionLines& band,
+                              BinaryCatalogEntry& entry)
+{
+  constexpr Numeric lowest = std::numeric_limits<Numeric>::lowest();
+  constexpr Numeric highest = std::numeric_limits<Numeric>::max();
+  
+  if (band.NumLines() == 0) {
+    entry.f0min = entry.flow = highest;
+    entry.f0max = entry.fupp = lowest;
+    return;
+  }
+  
+  entry.f0min = highest;
+  entry.f0max = lowest;
+  for (Index k=0; k<band.NumLines(); k++) {
+    entry.f0min = std::min(entry.f0min, band.F0(k));
+    entry.f0max = std::max(entry.f0max, band.F0(k));
+  }
+  
+  switch (band.Cutoff()) {
+    case Absorption::CutoffType::LineByLineOffset:
+      entry.flow = entry.f0min - band.CutoffFreqValue();
+      entry.fupp = entry.f0max + band.CutoffFreqValue();
+      if (band.Mirroring() == Absorption::MirroringType::Lorentz or
+          band.Mirroring() == Absorption::MirroringType::SameAsLineShape) {
+        entry.flow = std::min(entry.flow, -entry.fupp);
+        entry.fupp = std::max(entry.fupp, band.CutoffFreqValue() - entry.f0min);
+      }
+      break;
+    case Absorption::CutoffType::BandFixedFrequency:
+      entry.flow = lowest;
+      entry.fupp = band.CutoffFreqValue();
+      break;
+    case Absorption::CutoffType::None:
+      entry.flow = lowest;
+      entry.fupp = highest;
+      break;
+  }
+}
+
+/** Reads a binary catalog
+ * 
+ * Only bands of the selected species that can contribute to the
+ * range [fmin, fmax] are read.
+ * 
+ * @param[out] abs_lines The bands read
+ * @param[in] filename Name of the catalog file
+ * @param[in] species Species indices to read, all species if empty
+ * @param[in] fmin Lowest frequency
+ * @param[in] fmax Highest frequency
+ * @param[in] fmargin Largest distance to line centers where a band has no cutoff, negative to disable
+ * @param[in] verbosity Verbosity
+ */
+void read_binary_catalog(ArrayOfAbsorptionLines& abs_lines,
+                         const String& filename,
+                         const std::set<Index>& species,
+                         const Numeric fmin,
+                         const Numeric fmax,
+                         const Numeric fmargin,
+                         const Verbosity& verbosity)
+{
+  CREATE_OUT2;
+  
+  const String efilename = expand_path(filename);
+  bifstream bif(efilename.c_str());
+  if (not bif.good())
+    throw std::runtime_error("Cannot open binary line catalog " + efilename);
+  
+  char magic[binary_catalog_magic_size];
+  bif.getRaw(magic, binary_catalog_magic_size);
+  if (bif.fail() or
+      std::memcmp(magic, binary_catalog_magic, binary_catalog_magic_size) != 0)
+    throw std::runtime_error(efilename + " is not a binary line catalog");
+  
+  // Species of the catalog, flagged if they are to be read
+  long nspecies;
+  bif >> nspecies;
+  std::vector<bool> read_species(nspecies);
+  for (long i=0; i<nspecies; i++) {
+    long length;
+    bif >> length;
+    String name(length, ' ');
+    bif.getRaw(&name[0], length);
+    if (species.empty()) {
+      read_species[i] = true;
+    } else {
+      const SpeciesTag tag(name);
+      read_species[i] = species.find(tag.Species()) != species.end();
+    }
+  }
+  
+  long nbands, index_position;
+  bif >> nbands >> index_position;
+  
+  std::vector<BinaryCatalogEntry> index(nbands);
+  bif.seek(index_position, binio::Set);
+  for (auto& entry: index)
+    bif >> entry.species >> entry.f0min >> entry.f0max
+        >> entry.flow >> entry.fupp >> entry.data_position
+        >> entry.tag_position;
+  
+  if (bif.fail())
+    throw std::runtime_error("Error reading the index of binary line catalog " + efilename);
+  
+  abs_lines.resize(0);
+  for (auto& entry: index) {
+    if (entry.species < 0 or entry.species >= nspecies or
+        not read_species[entry.species])
+      continue;
+    
+    // Only the sides of the range without a cutoff are limited by fmargin
+    Numeric flow = entry.flow, fupp = entry.fupp;
+    if (fmargin >= 0) {
+      if (flow == std::numeric_limits<Numeric>::lowest())
+        flow = entry.f0min - fmargin;
+      if (fupp == std::numeric_limits<Numeric>::max())
+        fupp = entry.f0max + fmargin;
+    }
+    if (flow > fmax or fupp < fmin)
+      continue;
+    
+    bif.seek(entry.tag_position, binio::Set);
+    long length;
+    bif >> length;
+    String tag(length, ' ');
+    bif.getRaw(&tag[0], length);
+    
+    bif.seek(entry.data_position, binio::Set);
+    istringstream is_xml(tag);
+    abs_lines.push_back(AbsorptionLines());
+    xml_read_from_stream(is_xml, abs_lines.back(), &bif, verbosity);
+  }
+  
+  out2 << "  Read " << abs_lines.nelem() << " of " << nbands
+       << " bands from binary line catalog " << efilename << "\n";
+}
+}  // namespace
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void abs_linesWriteBinaryCatalog(const ArrayOfAbsorptionLines& abs_lines,
+                                 const String& filename,
+                                 const Verbosity& verbosity)
+{
+  CREATE_OUT2;
+  
+  const String efilename = add_basedir(filename);
+  
+  // Species names, in order of appearance
+  ArrayOfString names(0);
+  std::vector<BinaryCatalogEntry> index(abs_lines.nelem());
+  for (Index i=0; i<abs_lines.nelem(); i++) {
+    const String name = abs_lines[i].SpeciesName();
+    auto pos = std::find(names.begin(), names.end(), name);
+    index[i].species = long(pos - names.begin());
+    if (pos == names.end())
+      names.push_back(name);
+    set_binary_catalog_range(abs_lines[i], index[i]);
+  }
+  
+  bofstream bof(efilename.c_str());
+  if (not bof.good())
+    throw std::runtime_error("Cannot open binary line catalog " + efilename + " for writing");
+  
+  bof.putRaw(binary_catalog_magic, binary_catalog_magic_size);
+  bof << long(names.nelem());
+  for (auto& name: names) {
+    bof << long(name.length());
+    bof.putRaw(name.c_str(), name.length());
+  }
+  
+  // The index position is known only after the bands are written
+  bof << long(abs_lines.nelem());
+  const long index_position_position = long(bof.pos());
+  bof << long(0);
+  
+  // The tag of a band is only complete after its line data has been
+  // written, so it is stored behind the data
+  for (Index i=0; i<abs_lines.nelem(); i++) {
+    index[i].data_position = long(bof.pos());
+    ostringstream os_xml;
+    xml_write_to_stream(os_xml, abs_lines[i], &bof, "", verbosity);
+    
+    index[i].tag_position = long(bof.pos());
+    const String tag = os_xml.str();
+    bof << long(tag.length());
+    bof.putRaw(tag.c_str(), tag.length());
+  }
+  
+  const long index_position = long(bof.pos());
+  for (auto& entry: index)
+    bof << entry.species << entry.f0min << entry.f0max
+        << entry.flow << entry.fupp << entry.data_position
+        << entry.tag_position;
+  
+  bof.seek(index_position_position, binio::Set);
+  bof << index_position;
+  
+  if (bof.fail())
+    throw std::runtime_error("Error writing binary line catalog " + efilename);
+  
+  out2 << "  Wrote " << abs_lines.nelem() << " bands to binary line catalog "
+       << efilename << "\n";
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void abs_linesReadBinaryCatalog(ArrayOfAbsorptionLines& abs_lines,
+                                const Vector& f_grid,
+                                const String& filename,
+                                const Numeric& fmargin,
+                                const Verbosity& verbosity)
+{
+  if (f_grid.nelem() == 0)
+    throw std::runtime_error("*f_grid* is empty");
+  
+  read_binary_catalog(abs_lines, filename, std::set<Index>(),
+                      min(f_grid), max(f_grid), fmargin, verbosity);
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void abs_lines_per_speciesReadBinaryCatalog(ArrayOfArrayOfAbsorptionLines& abs_lines_per_species,
+                                            const ArrayOfArrayOfSpeciesTag& abs_species,
+                                            const Vector& f_grid,
+                                            const String& filename,
+                                            const Numeric& fmargin,
+                                            const Verbosity& verbosity)
+{
+  if (f_grid.nelem() == 0)
+    throw std::runtime_error("*f_grid* is empty");
+  
+  // Build a set of species indices. Duplicates are ignored.
+  std::set<Index> unique_species;
+  for (auto& asp: abs_species)
+    for (auto& sp: asp)
+      if (sp.Type() == SpeciesTag::TYPE_PLAIN || sp.Type() == SpeciesTag::TYPE_ZEEMAN)
+        unique_species.insert(sp.Species());
+  
+  ArrayOfAbsorptionLines abs_lines(0);
+  if (not unique_species.empty())
+    read_binary_catalog(abs_lines, filename, unique_species,
+                        min(f_grid), max(f_grid), fmargin, verbosity);
+  
+  abs_lines_per_speciesCreateFromLines(abs_lines_per_species, abs_lines, abs_species, verbosity);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////// Manipulation of quantum numbers
 /////////////////////////////////////////////////////////////////////////////////////
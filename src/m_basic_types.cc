@@ -1766,6 +1766,80 @@ void Compare(const Tensor5& var1,
        << " OK (maximum difference = " << maxdiff << ").\n";
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void Compare(const Tensor6& var1,
+             const Tensor6& var2,
+             const Numeric& maxabsdiff,
+             const String& error_message,
+             const String& var1name,
+             const String& var2name,
+             const String&,
+             const String&,
+             const Verbosity& verbosity) {
+  const Index ncols = var1.ncols();
+  const Index nrows = var1.nrows();
+  const Index npages = var1.npages();
+  const Index nbooks = var1.nbooks();
+  const Index nshelves = var1.nshelves();
+  const Index nvitrines = var1.nvitrines();
+
+  if (var2.ncols() != ncols || var2.nrows() != nrows ||
+      var2.npages() != npages || var2.nbooks() != nbooks ||
+      var2.nshelves() != nshelves || var2.nvitrines() != nvitrines) {
+    ostringstream os;
+    os << var1name << " and " << var2name << " do not have the same size.";
+    throw runtime_error(os.str());
+  }
+
+  Numeric maxdiff = 0.0;
+
+  for (Index c = 0; c < ncols; c++)
+    for (Index r = 0; r < nrows; r++)
+      for (Index p = 0; p < npages; p++)
+        for (Index b = 0; b < nbooks; b++)
+          for (Index s = 0; s < nshelves; s++)
+            for (Index v = 0; v < nvitrines; v++) {
+              Numeric diff = var1(v, s, b, p, r, c) - var2(v, s, b, p, r, c);
+
+              if (std::isnan(var1(v, s, b, p, r, c)) ||
+                  std::isnan(var2(v, s, b, p, r, c))) {
+                if (std::isnan(var1(v, s, b, p, r, c)) &&
+                    std::isnan(var2(v, s, b, p, r, c))) {
+                  diff = 0;
+                } else if (std::isnan(var1(v, s, b, p, r, c))) {
+                  ostringstream os;
+                  os << "Nan found in " << var1name << ", but there is no "
+                     << "NaN at same position in " << var2name << ".\nThis "
+                     << "is not allowed.";
+                  throw runtime_error(os.str());
+                } else {
+                  ostringstream os;
+                  os << "Nan found in " << var2name << ", but there is no "
+                     << "NaN at same position in " << var1name << ".\nThis "
+                     << "is not allowed.";
+                  throw runtime_error(os.str());
+                }
+              }
+
+              if (abs(diff) > abs(maxdiff)) {
+                maxdiff = diff;
+              }
+            }
+
+  if (abs(maxdiff) > maxabsdiff) {
+    ostringstream os;
+    os << var1name << "-" << var2name << " FAILED!\n";
+    if (error_message.length()) os << error_message << "\n";
+    os << "Max allowed deviation set to : " << maxabsdiff << endl
+       << "but the tensors deviate with: " << maxdiff << endl;
+    throw runtime_error(os.str());
+  }
+
+  CREATE_OUT2;
+  out2 << "   " << var1name << "-" << var2name
+       << " OK (maximum difference = " << maxdiff << ").\n";
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void Compare(const Tensor7& var1,
              const Tensor7& var2,
@@ -2092,6 +2092,7 @@ void doit_scat_fieldCalc(Workspace& ws,
                          const Vector& aa_grid,
                          const Index& doit_za_grid_size,
                          const Tensor7& pha_mat_doit,
+                         const Tensor3& doit_scat_kernel,
                          const Verbosity& verbosity)
 
 {
@@ -2185,16 +2186,19 @@ void doit_scat_fieldCalc(Workspace& ws,
 
   // ------ end of checks -----------------------------------------------
 
-  // Initialize variables *pha_mat* and *pha_mat_spt*
-  Tensor4 pha_mat_local(
-      doit_za_grid_size, aa_grid.nelem(), stokes_dim, stokes_dim, 0.);
-
-  Tensor5 pha_mat_spt_local(pnd_field.nbooks(),
-                            doit_za_grid_size,
-                            aa_grid.nelem(),
-                            stokes_dim,
-                            stokes_dim,
-                            0.);
+  // Use the scattering kernel of DoitScatteringDataPrepare, if it has
+  // been calculated for the present grids:
+  if (is_size(doit_scat_kernel,
+              cloudbox_field_mono.nvitrines() * cloudbox_field_mono.nshelves() *
+                  cloudbox_field_mono.nbooks(),
+              Nza * Naa * stokes_dim,
+              atmosphere_dim == 1 ? Nza * stokes_dim : stokes_dim) &&
+      (atmosphere_dim == 3 || Naa == 1)) {
+    out2 << "  Calculate the scattered field from the scattering kernel\n";
+    doit_scat_field_from_kernel(
+        doit_scat_field, doit_scat_kernel, cloudbox_field_mono);
+    return;
+  }
 
   // Equidistant step size for integration
   Vector grid_stepsize(2);
@@ -2207,17 +2211,20 @@ void doit_scat_fieldCalc(Workspace& ws,
 
   out2 << "  Calculate the scattered field\n";
 
+  String fail_msg;
+  bool failed = false;
+
   if (atmosphere_dim == 1) {
     // Get pha_mat at the grid positions
     // Since atmosphere_dim = 1, there is no loop over lat and lon grids
-    for (Index p_index = 0; p_index <= cloudbox_limits[1] - cloudbox_limits[0];
-         p_index++) {
+    const Index Np = cloudbox_limits[1] - cloudbox_limits[0] + 1;
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && Np > 1) \
+    firstprivate(product_field)
+    for (Index p_index = 0; p_index < Np; p_index++) {
       //There is only loop over zenith angle grid ; no azimuth angle grid.
       for (Index za_index_local = 0; za_index_local < Nza; za_index_local++) {
-        // Calculate the phase matrix of individual scattering elements
-        out3 << "Multiplication of phase matrix with incoming"
-             << " intensities \n";
-
+        // Multiplication of phase matrix with incoming intensities
         product_field = 0;
 
         // za_in and aa_in are for incoming zenith and azimuth
@@ -2261,90 +2268,134 @@ void doit_scat_fieldCalc(Workspace& ws,
 
   //atmosphere_dim = 3
   else if (atmosphere_dim == 3) {
-    /*there is a loop over pressure, latitude and longitudeindex
-        when we calculate the pha_mat from pha_mat_spt and pnd_field
-        using the method pha_matCalc.  */
+    /* The grid points are independent, they are shared among the
+       threads. The phase matrices of a grid point for all directions
+       are taken from pha_mat_doit, if DoitScatteringDataPrepare could
+       store them there, otherwise they are calculated here from
+       pha_mat_spt_agenda and pnd_field. */
+    const Index Nlat = cloudbox_limits[3] - cloudbox_limits[2] + 1;
+    const Index Nlon = cloudbox_limits[5] - cloudbox_limits[4] + 1;
+    const Index n_points =
+        (cloudbox_limits[1] - cloudbox_limits[0] + 1) * Nlat * Nlon;
+
+    const bool pha_mat_stored = is_size(pha_mat_doit,
+                                        n_points,
+                                        Nza,
+                                        Naa,
+                                        Nza,
+                                        Naa,
+                                        stokes_dim,
+                                        stokes_dim);
+
+    // Phase matrices of one grid point, if not stored:
+    Tensor6 pha_mat_point;
+    Tensor5 pha_mat_spt_local;
+    Tensor4 pha_mat_local;
+    if (not pha_mat_stored) {
+      out3 << "  Calculate phase matrices\n";
+      pha_mat_point.resize(Nza, Naa, Nza, Naa, stokes_dim, stokes_dim);
+    }
 
-    for (Index p_index = 0; p_index <= cloudbox_limits[1] - cloudbox_limits[0];
-         p_index++) {
-      for (Index lat_index = 0;
-           lat_index <= cloudbox_limits[3] - cloudbox_limits[2];
-           lat_index++) {
-        for (Index lon_index = 0;
-             lon_index <= cloudbox_limits[5] - cloudbox_limits[4];
-             lon_index++) {
-          Numeric rtp_temperature_local =
-              t_field(p_index + cloudbox_limits[0],
-                      lat_index + cloudbox_limits[2],
-                      lon_index + cloudbox_limits[4]);
+    // We have to make a local copy of the Workspace and the agenda because
+    // only non-reference types can be declared firstprivate in OpenMP.
+    WorkspaceCopy l_ws(ws);
+    Agenda l_pha_mat_spt_agenda(pha_mat_spt_agenda);
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && n_points > 1) \
+    schedule(dynamic) firstprivate(l_ws,                               \
+                                   l_pha_mat_spt_agenda,               \
+                                   product_field,                      \
+                                   pha_mat_point,                      \
+                                   pha_mat_spt_local,                  \
+                                   pha_mat_local)
+    for (Index i_point = 0; i_point < n_points; i_point++) {
+      if (failed) continue;
+
+      const Index p_index = i_point / (Nlat * Nlon);
+      const Index lat_index = (i_point / Nlon) % Nlat;
+      const Index lon_index = i_point % Nlon;
 
-          for (Index aa_index_local = 1; aa_index_local < Naa;
-               aa_index_local++) {
-            for (Index za_index_local = 0; za_index_local < Nza;
-                 za_index_local++) {
-              out3 << "Calculate phase matrix \n";
-              pha_mat_spt_agendaExecute(ws,
-                                        pha_mat_spt_local,
-                                        za_index_local,
-                                        lat_index,
-                                        lon_index,
-                                        p_index,
-                                        aa_index_local,
-                                        rtp_temperature_local,
-                                        pha_mat_spt_agenda);
-
-              pha_matCalc(pha_mat_local,
-                          pha_mat_spt_local,
-                          pnd_field,
-                          atmosphere_dim,
-                          p_index,
-                          lat_index,
-                          lon_index,
-                          verbosity);
+      try {
+        if (not pha_mat_stored)
+          doit_pha_mat_point3D(l_ws,
+                               pha_mat_point,
+                               pha_mat_spt_local,
+                               pha_mat_local,
+                               l_pha_mat_spt_agenda,
+                               pnd_field,
+                               p_index,
+                               lat_index,
+                               lon_index,
+                               t_field(p_index + cloudbox_limits[0],
+                                       lat_index + cloudbox_limits[2],
+                                       lon_index + cloudbox_limits[4]),
+                               verbosity);
+
+        ConstTensor6View pha_mat =
+            pha_mat_stored
+                ? pha_mat_doit(i_point, joker, joker, joker, joker, joker, joker)
+                : ConstTensor6View(pha_mat_point);
+
+        for (Index aa_index_local = 1; aa_index_local < Naa;
+             aa_index_local++) {
+          for (Index za_index_local = 0; za_index_local < Nza;
+               za_index_local++) {
+            product_field = 0;
+
+            //za_in and aa_in are the incoming directions
+            //for which pha_mat_spt is calculated
+            for (Index za_in = 0; za_in < Nza; ++za_in) {
+              for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
+                // Multiplication of phase matrix
+                // with incloming intensity field.
+                for (Index i = 0; i < stokes_dim; i++) {
+                  for (Index j = 0; j < stokes_dim; j++) {
+                    product_field(za_in, aa_in, i) +=
+                        pha_mat(za_index_local,
+                                aa_index_local,
+                                za_in,
+                                aa_in,
+                                i,
+                                j) *
+                        cloudbox_field_mono(p_index,
+                                            lat_index,
+                                            lon_index,
+                                            za_index_local,
+                                            aa_index_local,
+                                            j);
+                  }
+                }
+              }  //end aa_in loop
+            }    //end za_in loop
+            //integration of the product of ifield_in and pha
+            //over zenith angle and azimuth angle grid. It
+            //calls here the integration routine
+            //AngIntegrate_trapezoid_opti
+            for (Index i = 0; i < stokes_dim; i++) {
+              doit_scat_field(p_index,
+                              lat_index,
+                              lon_index,
+                              za_index_local,
+                              aa_index_local,
+                              i) =
+                  AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
+                                              za_grid,
+                                              aa_grid,
+                                              grid_stepsize);
+            }  //end i loop
+          }    //end za_prop loop
+        }      //end aa_prop loop
+      } catch (const std::exception& e) {
+#pragma omp critical(doit_scat_fieldCalc_fail)
+        {
+          failed = true;
+          fail_msg = e.what();
+        }
+      }
+    }  // end grid point loop
 
-              product_field = 0;
+    if (failed) throw runtime_error(fail_msg);
 
-              //za_in and aa_in are the incoming directions
-              //for which pha_mat_spt is calculated
-              for (Index za_in = 0; za_in < Nza; ++za_in) {
-                for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
-                  // Multiplication of phase matrix
-                  // with incloming intensity field.
-                  for (Index i = 0; i < stokes_dim; i++) {
-                    for (Index j = 0; j < stokes_dim; j++) {
-                      product_field(za_in, aa_in, i) +=
-                          pha_mat_local(za_in, aa_in, i, j) *
-                          cloudbox_field_mono(p_index,
-                                              lat_index,
-                                              lon_index,
-                                              za_index_local,
-                                              aa_index_local,
-                                              j);
-                    }
-                  }
-                }  //end aa_in loop
-              }    //end za_in loop
-              //integration of the product of ifield_in and pha
-              //over zenith angle and azimuth angle grid. It
-              //calls here the integration routine
-              //AngIntegrate_trapezoid_opti
-              for (Index i = 0; i < stokes_dim; i++) {
-                doit_scat_field(p_index,
-                                lat_index,
-                                lon_index,
-                                za_index_local,
-                                aa_index_local,
-                                i) =
-                    AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
-                                                za_grid,
-                                                aa_grid,
-                                                grid_stepsize);
-              }  //end i loop
-            }    //end aa_prop loop
-          }      //end za_prop loop
-        }        //end lon loop
-      }          // end lat loop
-    }            // end p loop
     // aa = 0 is the same as aa = 180:
     doit_scat_field(joker, joker, joker, joker, 0, joker) =
         doit_scat_field(joker, joker, joker, joker, Naa - 1, joker);
@@ -2856,8 +2907,9 @@ void DoitCalc(Workspace& ws,
   //-------- end of checks ----------------------------------------
 
   // We have to make a local copy of the Workspace and the agendas because
-  // only non-reference types can be declared firstprivate in OpenMP
-  Workspace l_ws(ws);
+  // only non-reference types can be declared firstprivate in OpenMP.
+  // The workspace copies are reused between calls, see WorkspaceCopy.
+  WorkspaceCopy l_ws(ws);
   Agenda l_doit_mono_agenda(doit_mono_agenda);
 
   // OMP likes simple loop end conditions, so we make a local copy here:
@@ -112,15 +112,15 @@ void abs_xsec_per_speciesAddHitranXsec(  // WS Output:
     }
   }
 
-  // Allocate a vector with dimension frequencies for constructing our
-  // cross-sections before adding them (more efficient to allocate this here
-  // outside of the loops)
-  Vector xsec_temp(f_grid.nelem(), 0.);
+  // Allocate a matrix with dimension frequencies and pressures for
+  // constructing our cross-sections before adding them (more efficient to
+  // allocate this here outside of the loops)
+  Matrix xsec_temp(f_grid.nelem(), abs_p.nelem(), 0.);
 
   // Jacobian vectors START
   //    Vector dxsec_temp_dT;
-  Vector dxsec_temp_dF;
-  if (do_freq_jac) dxsec_temp_dF.resize(f_grid.nelem());
+  Matrix dxsec_temp_dF;
+  if (do_freq_jac) dxsec_temp_dF.resize(f_grid.nelem(), abs_p.nelem());
   //    if (do_temp_jac)
   //        dxsec_temp_dT.resize(f_grid.nelem());
   // Jacobian vectors END
@@ -154,41 +154,38 @@ void abs_xsec_per_speciesAddHitranXsec(  // WS Output:
       Matrix& this_xsec = abs_xsec_per_species[i];
       ArrayOfMatrix& this_dxsec = do_jac ? dabs_xsec_per_species_dx[i] : empty;
 
-      // Loop over pressure:
-      for (Index ip = 0; ip < abs_p.nelem(); ip++) {
-        // Get the absorption cross sections from the HITRAN data:
-        try {
+      // Get the absorption cross sections from the HITRAN data for all
+      // pressures at once:
+      try {
+        this_xdata.Extract(
+            xsec_temp, f_grid, abs_p, abs_t, apply_tfit, verbosity);
+        if (do_freq_jac)
           this_xdata.Extract(
-              xsec_temp, f_grid, abs_p[ip], abs_t[ip], apply_tfit, verbosity);
-          if (do_freq_jac)
-            this_xdata.Extract(dxsec_temp_dF,
-                               dfreq,
-                               abs_p[ip],
-                               abs_t[ip],
-                               apply_tfit,
-                               verbosity);
-          // FIXME: Temperature is not yet taken into account
-          // if(do_temp_jac)
-          //     this_xdata.Extract(dxsec_temp_dT, f_grid, dabs_t[ip],
-          //                        verbosity);
-        } catch (runtime_error& e) {
-          ostringstream os;
-          os << "Problem with HITRAN cross section species "
-             << this_species.Name() << ":\n"
-             << e.what();
-          throw runtime_error(os.str());
-        }
+              dxsec_temp_dF, dfreq, abs_p, abs_t, apply_tfit, verbosity);
+        // FIXME: Temperature is not yet taken into account
+        // if(do_temp_jac)
+        //     this_xdata.Extract(dxsec_temp_dT, f_grid, dabs_t,
+        //                        verbosity);
+      } catch (runtime_error& e) {
+        ostringstream os;
+        os << "Problem with HITRAN cross section species "
+           << this_species.Name() << ":\n"
+           << e.what();
+        throw runtime_error(os.str());
+      }
 
+      // Loop over pressure:
+      for (Index ip = 0; ip < abs_p.nelem(); ip++) {
         if (!do_jac) {
           // Add to result variable:
-          this_xsec(joker, ip) += xsec_temp;
+          this_xsec(joker, ip) += xsec_temp(joker, ip);
         } else {
-          for (Index iv = 0; iv < xsec_temp.nelem(); iv++) {
-            this_xsec(iv, ip) += xsec_temp[iv];
+          for (Index iv = 0; iv < xsec_temp.nrows(); iv++) {
+            this_xsec(iv, ip) += xsec_temp(iv, ip);
             for (Index iq = 0; iq < jac_pos.nelem(); iq++) {
               if (is_frequency_parameter(jacobian_quantities[jac_pos[iq]]))
                 this_dxsec[iq](iv, ip) +=
-                    (dxsec_temp_dF[iv] - xsec_temp[iv]) / df;
+                    (dxsec_temp_dF(iv, ip) - xsec_temp(iv, ip)) / df;
               //                            else if (ppd(iq) == JQT_temperature)
               //                                this_dxsec[iq](iv, ip) += (dxsec_temp_dT[iv] -
               //                                                           xsec_temp[iv]) / dt;
@@ -196,7 +193,7 @@ void abs_xsec_per_speciesAddHitranXsec(  // WS Output:
                        JacPropMatType::VMR) {
                 if (species_match(jacobian_quantities[jac_pos[iq]],
                                   abs_species[i])) {
-                  this_dxsec[iq](iv, ip) += xsec_temp[iv];
+                  this_dxsec[iq](iv, ip) += xsec_temp(iv, ip);
                 }
               }
               // Note for coef that d/dt(a*n*n) = da/dt * n1*n2 + a * dn1/dt * n2 + a * n1 * dn2/dt,
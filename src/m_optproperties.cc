@@ -40,8 +40,10 @@
 #include <cmath>
 #include "array.h"
 #include "arts.h"
+#include "arts_omp.h"
 #include "auto_md.h"
 #include "check_input.h"
+#include "doit.h"
 #include "exceptions.h"
 #include "interpolation.h"
 #include "logic.h"
@@ -1347,6 +1349,7 @@ void DoitScatteringDataPrepare(
     ArrayOfTensor7& pha_mat_sptDOITOpt,
     ArrayOfArrayOfSingleScatteringData& scat_data_mono,
     Tensor7& pha_mat_doit,
+    Tensor3& doit_scat_kernel,
     //Output and Input:
     Vector& aa_grid,
     //Input:
@@ -1360,7 +1363,12 @@ void DoitScatteringDataPrepare(
     const ArrayOfIndex& cloudbox_limits,
     const Tensor4& pnd_field,
     const Agenda& pha_mat_spt_agenda,
+    const Numeric& pha_mat_doit_max_size,
+    const Index& scat_kernel,
+    const Numeric& scat_kernel_max_size,
     const Verbosity& verbosity) {
+  CREATE_OUT2;
+
   if (scat_data_checked != 1)
     throw runtime_error(
         "The scattering data must be flagged to have "
@@ -1466,17 +1474,17 @@ void DoitScatteringDataPrepare(
       i_se_flat++;
     }
   }
-  // Interpolate phase matrix to current grid
-  pha_mat_doit.resize(cloudbox_limits[1] - cloudbox_limits[0] + 1,
-                      doit_za_grid_size,
-                      N_aa_sca,
-                      doit_za_grid_size,
-                      Naa,
-                      stokes_dim,
-                      stokes_dim);
-  pha_mat_doit = 0;
-
   if (atmosphere_dim == 1) {
+    // Interpolate phase matrix to current grid
+    pha_mat_doit.resize(cloudbox_limits[1] - cloudbox_limits[0] + 1,
+                        doit_za_grid_size,
+                        N_aa_sca,
+                        doit_za_grid_size,
+                        Naa,
+                        stokes_dim,
+                        stokes_dim);
+    pha_mat_doit = 0;
+
     Index aa_index_local = 0;
 
     // Get pha_mat at the grid positions
@@ -1522,6 +1530,188 @@ void DoitScatteringDataPrepare(
     // no azimuth dependcy for 1d atmospheres
     aa_grid.resize(1);
     aa_grid = 0;
+  } else if (atmosphere_dim == 3) {
+    // The phase matrices do not change during the iterations of
+    // doit_scat_fieldCalc, so they are calculated here once for all
+    // cloudbox grid points, if they fit. The grid points are flattened
+    // into the first dimension, with the longitude running fastest.
+    const Index Np = cloudbox_limits[1] - cloudbox_limits[0] + 1;
+    const Index Nlat = cloudbox_limits[3] - cloudbox_limits[2] + 1;
+    const Index Nlon = cloudbox_limits[5] - cloudbox_limits[4] + 1;
+    const Index n_points = Np * Nlat * Nlon;
+    const Numeric size = Numeric(n_points) * Numeric(doit_za_grid_size) *
+                         Numeric(Naa) * Numeric(doit_za_grid_size) *
+                         Numeric(Naa) * Numeric(stokes_dim * stokes_dim) *
+                         Numeric(sizeof(Numeric));
+
+    if (size > pha_mat_doit_max_size) {
+      out2 << "  The phase matrices need " << size / 1e6
+           << " MB, they are calculated in each DOIT iteration.\n";
+      pha_mat_doit.resize(0, 0, 0, 0, 0, 0, 0);
+    } else {
+      pha_mat_doit.resize(n_points,
+                          doit_za_grid_size,
+                          Naa,
+                          doit_za_grid_size,
+                          Naa,
+                          stokes_dim,
+                          stokes_dim);
+      pha_mat_doit = 0;
+
+      // We have to make a local copy of the Workspace and the agenda because
+      // only non-reference types can be declared firstprivate in OpenMP.
+      WorkspaceCopy l_ws(ws);
+      Agenda l_pha_mat_spt_agenda(pha_mat_spt_agenda);
+
+      String fail_msg;
+      bool failed = false;
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && n_points > 1)   \
+      schedule(dynamic) firstprivate(l_ws,                               \
+                                     l_pha_mat_spt_agenda,               \
+                                     pha_mat_spt_local,                  \
+                                     pha_mat_local)
+      for (Index i_point = 0; i_point < n_points; i_point++) {
+        if (failed) continue;
+
+        const Index p_index = i_point / (Nlat * Nlon);
+        const Index lat_index = (i_point / Nlon) % Nlat;
+        const Index lon_index = i_point % Nlon;
+
+        try {
+          doit_pha_mat_point3D(
+              l_ws,
+              pha_mat_doit(i_point, joker, joker, joker, joker, joker, joker),
+              pha_mat_spt_local,
+              pha_mat_local,
+              l_pha_mat_spt_agenda,
+              pnd_field,
+              p_index,
+              lat_index,
+              lon_index,
+              t_field(p_index + cloudbox_limits[0],
+                      lat_index + cloudbox_limits[2],
+                      lon_index + cloudbox_limits[4]),
+              verbosity);
+        } catch (const std::exception& e) {
+#pragma omp critical(DoitScatteringDataPrepare_fail)
+          {
+            failed = true;
+            fail_msg = e.what();
+          }
+        }
+      }
+
+      if (failed) throw runtime_error(fail_msg);
+    }
+  }
+
+  // The scattering kernel depends on the phase matrices, it is always
+  // reset here so that a kernel of another frequency is never used.
+  doit_scat_kernel.resize(0, 0, 0);
+
+  if (scat_kernel) {
+    const Index Np = cloudbox_limits[1] - cloudbox_limits[0] + 1;
+    const Index Nlat =
+        atmosphere_dim == 3 ? cloudbox_limits[3] - cloudbox_limits[2] + 1 : 1;
+    const Index Nlon =
+        atmosphere_dim == 3 ? cloudbox_limits[5] - cloudbox_limits[4] + 1 : 1;
+    const Index n_points = Np * Nlat * Nlon;
+
+    // For 1D aa_grid has been reduced to a single angle above, and only
+    // that part of pha_mat_doit is used by doit_scat_fieldCalc.
+    const Index Naa_in = aa_grid.nelem();
+    const Index n_rows = doit_za_grid_size * N_aa_sca * stokes_dim;
+    const Index n_cols =
+        atmosphere_dim == 1 ? doit_za_grid_size * stokes_dim : stokes_dim;
+    const Numeric size = Numeric(n_points) * Numeric(n_rows) *
+                         Numeric(n_cols) * Numeric(sizeof(Numeric));
+
+    if (size > scat_kernel_max_size) {
+      out2 << "  The scattering kernel needs " << size / 1e6
+           << " MB, the scattering integral is calculated from the\n"
+           << "  phase matrices in each DOIT iteration.\n";
+      return;
+    }
+
+    Matrix weights;
+    doit_scat_weights(weights, za_grid, aa_grid);
+
+    doit_scat_kernel.resize(n_points, n_rows, n_cols);
+
+    // In 3D the phase matrices are only stored if they fit into
+    // pha_mat_doit_max_size, otherwise they are calculated for one grid
+    // point at a time:
+    const bool pha_mat_stored = !pha_mat_doit.empty();
+    Tensor6 pha_mat_point;
+    if (not pha_mat_stored) {
+      pha_mat_point.resize(doit_za_grid_size,
+                           Naa,
+                           doit_za_grid_size,
+                           Naa,
+                           stokes_dim,
+                           stokes_dim);
+      pha_mat_point = 0;
+    }
+
+    // We have to make a local copy of the Workspace and the agenda because
+    // only non-reference types can be declared firstprivate in OpenMP.
+    WorkspaceCopy l_ws(ws);
+    Agenda l_pha_mat_spt_agenda(pha_mat_spt_agenda);
+
+    String fail_msg;
+    bool failed = false;
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && n_points > 1) \
+    schedule(dynamic) firstprivate(l_ws,                               \
+                                   l_pha_mat_spt_agenda,               \
+                                   pha_mat_point,                      \
+                                   pha_mat_spt_local,                  \
+                                   pha_mat_local)
+    for (Index i_point = 0; i_point < n_points; i_point++) {
+      if (failed) continue;
+
+      const Index p_index = i_point / (Nlat * Nlon);
+      const Index lat_index = (i_point / Nlon) % Nlat;
+      const Index lon_index = i_point % Nlon;
+
+      try {
+        if (not pha_mat_stored)
+          doit_pha_mat_point3D(l_ws,
+                               pha_mat_point,
+                               pha_mat_spt_local,
+                               pha_mat_local,
+                               l_pha_mat_spt_agenda,
+                               pnd_field,
+                               p_index,
+                               lat_index,
+                               lon_index,
+                               t_field(p_index + cloudbox_limits[0],
+                                       lat_index + cloudbox_limits[2],
+                                       lon_index + cloudbox_limits[4]),
+                               verbosity);
+
+        doit_scat_kernel_point(
+            doit_scat_kernel(i_point, joker, joker),
+            pha_mat_stored ? pha_mat_doit(i_point,
+                                          joker,
+                                          joker,
+                                          joker,
+                                          Range(0, Naa_in),
+                                          joker,
+                                          joker)
+                           : ConstTensor6View(pha_mat_point),
+            weights);
+      } catch (const std::exception& e) {
+#pragma omp critical(DoitScatteringDataPrepare_kernel_fail)
+        {
+          failed = true;
+          fail_msg = e.what();
+        }
+      }
+    }
+
+    if (failed) throw runtime_error(fail_msg);
   }
 }
 
@@ -773,26 +773,35 @@ void iyEmissionStandard(
         j_analytical_do and do_temperature_jacobian(jacobian_quantities);
 
     Agenda l_propmat_clearsky_agenda(propmat_clearsky_agenda);
-    Workspace l_ws(ws);
+    WorkspaceCopy l_ws(ws);
     ArrayOfString fail_msg;
     bool do_abort = false;
 
-    // Loop ppath points and determine radiative properties
-#pragma omp parallel for if (!arts_omp_in_parallel()) \
-    firstprivate(l_ws, l_propmat_clearsky_agenda, a, B, dB_dT, S, da_dx, dS_dx)
-    for (Index ip = 0; ip < np; ip++) {
-      if (do_abort) continue;
+    // Radiative properties of one ppath point, with the given workspace,
+    // agenda and scratch variables
+    auto source_calc = [&](Workspace& ws_ip,
+                           const Agenda& propmat_clearsky_agenda_ip,
+                           StokesVector& a_ip,
+                           Vector& B_ip,
+                           Vector& dB_dT_ip,
+                           StokesVector& S_ip,
+                           ArrayOfStokesVector& da_dx_ip,
+                           ArrayOfStokesVector& dS_dx_ip,
+                           const Index ip) {
       try {
-        get_stepwise_blackbody_radiation(
-            B, dB_dT, ppvar_f(joker, ip), ppvar_t[ip], temperature_jacobian);
+        get_stepwise_blackbody_radiation(B_ip,
+                                         dB_dT_ip,
+                                         ppvar_f(joker, ip),
+                                         ppvar_t[ip],
+                                         temperature_jacobian);
 
-        get_stepwise_clearsky_propmat(l_ws,
+        get_stepwise_clearsky_propmat(ws_ip,
                                       K[ip],
-                                      S,
+                                      S_ip,
                                       lte[ip],
                                       dK_dx[ip],
-                                      dS_dx,
-                                      l_propmat_clearsky_agenda,
+                                      dS_dx_ip,
+                                      propmat_clearsky_agenda_ip,
                                       jacobian_quantities,
                                       ppvar_f(joker, ip),
                                       ppvar_mag(joker, ip),
@@ -806,7 +815,7 @@ void iyEmissionStandard(
 
         if (j_analytical_do)
           adapt_stepwise_partial_derivatives(dK_dx[ip],
-                                             dS_dx,
+                                             dS_dx_ip,
                                              jacobian_quantities,
                                              ppvar_f(joker, ip),
                                              ppath.los(ip, joker),
@@ -820,20 +829,20 @@ void iyEmissionStandard(
                                              j_analytical_do);
 
         // Here absorption equals extinction
-        a = K[ip];
+        a_ip = K[ip];
         if (j_analytical_do)
-          FOR_ANALYTICAL_JACOBIANS_DO(da_dx[iq] = dK_dx[ip][iq];);
+          FOR_ANALYTICAL_JACOBIANS_DO(da_dx_ip[iq] = dK_dx[ip][iq];);
 
         stepwise_source(src_rad[ip],
                         dsrc_rad[ip],
                         K[ip],
-                        a,
-                        S,
+                        a_ip,
+                        S_ip,
                         dK_dx[ip],
-                        da_dx,
-                        dS_dx,
-                        B,
-                        dB_dT,
+                        da_dx_ip,
+                        dS_dx_ip,
+                        B_ip,
+                        dB_dT_ip,
                         jacobian_quantities,
                         jacobian_do);
       } catch (const std::runtime_error& e) {
@@ -847,11 +856,10 @@ void iyEmissionStandard(
           fail_msg.push_back(os.str());
         }
       }
-    }
+    };
 
-#pragma omp parallel for if (!arts_omp_in_parallel())
-    for (Index ip = 1; ip < np; ip++) {
-      if (do_abort) continue;
+    // Transmission of the layer ending at ppath point ip
+    auto transmission_calc = [&](const Index ip) {
       try {
         const Numeric dr_dT_past =
             do_hse ? ppath.lstep[ip - 1] / (2.0 * ppvar_t[ip - 1]) : 0;
@@ -879,6 +887,57 @@ void iyEmissionStandard(
           fail_msg.push_back(os.str());
         }
       }
+    };
+
+    if (arts_omp_tasking()) {
+      // Chunks of a few points per task, to keep the task overhead small
+      const Index chunk =
+          max(Index(1), np / (4 * Index(arts_omp_get_max_threads())));
+
+      // Loop ppath points and determine radiative properties
+      arts_omp_task_chunks(np, chunk, [&](const long first, const long last) {
+        WorkspaceCopy l_task_ws(l_ws);
+        Agenda l_task_propmat_clearsky_agenda(l_propmat_clearsky_agenda);
+        StokesVector l_a(a), l_S(S);
+        Vector l_B(B), l_dB_dT(dB_dT);
+        ArrayOfStokesVector l_da_dx(da_dx), l_dS_dx(dS_dx);
+
+        for (Index ip = first; ip < last; ip++) {
+          if (do_abort) continue;
+          source_calc(l_task_ws,
+                      l_task_propmat_clearsky_agenda,
+                      l_a,
+                      l_B,
+                      l_dB_dT,
+                      l_S,
+                      l_da_dx,
+                      l_dS_dx,
+                      ip);
+        }
+      });
+
+      arts_omp_task_chunks(
+          np - 1, chunk, [&](const long first, const long last) {
+            for (Index ip = first + 1; ip < last + 1; ip++) {
+              if (do_abort) continue;
+              transmission_calc(ip);
+            }
+          });
+    } else {
+      // Loop ppath points and determine radiative properties
+#pragma omp parallel for if (!arts_omp_in_parallel()) \
+    firstprivate(l_ws, l_propmat_clearsky_agenda, a, B, dB_dT, S, da_dx, dS_dx)
+      for (Index ip = 0; ip < np; ip++) {
+        if (do_abort) continue;
+        source_calc(
+            l_ws, l_propmat_clearsky_agenda, a, B, dB_dT, S, da_dx, dS_dx, ip);
+      }
+
+#pragma omp parallel for if (!arts_omp_in_parallel())
+      for (Index ip = 1; ip < np; ip++) {
+        if (do_abort) continue;
+        transmission_calc(ip);
+      }
     }
 
     if (do_abort) {
@@ -1781,6 +1840,7 @@ void yCalc(Workspace& ws,
            const Index& jacobian_do,
            const ArrayOfRetrievalQuantity& jacobian_quantities,
            const ArrayOfString& iy_aux_vars,
+           const Index& tasking,
            const Verbosity& verbosity) {
   CREATE_OUT3;
 
@@ -1867,13 +1927,90 @@ void yCalc(Workspace& ws,
   String fail_msg;
   bool failed = false;
 
-  if (nmblock >= arts_omp_get_max_threads() ||
-      (nf <= nmblock && nmblock >= nlos)) {
+  // Calculations for one measurement block, with the given workspace and
+  // agendas
+  auto mblock_calc = [&](Workspace& ws_mblock,
+                         const Agenda& iy_main_agenda_mblock,
+                         const Agenda& geo_pos_agenda_mblock,
+                         const Agenda& jacobian_agenda_mblock,
+                         const Index mblock_index) {
+    yCalc_mblock_loop_body(failed,
+                           fail_msg,
+                           iyb_aux_array,
+                           ws_mblock,
+                           y,
+                           y_f,
+                           y_pol,
+                           y_pos,
+                           y_los,
+                           y_geo,
+                           jacobian,
+                           atmosphere_dim,
+                           nlte_field,
+                           cloudbox_on,
+                           stokes_dim,
+                           f_grid,
+                           sensor_pos,
+                           sensor_los,
+                           transmitter_pos,
+                           mblock_dlos_grid,
+                           sensor_response,
+                           sensor_response_f,
+                           sensor_response_pol,
+                           sensor_response_dlos,
+                           iy_unit,
+                           iy_main_agenda_mblock,
+                           geo_pos_agenda_mblock,
+                           jacobian_agenda_mblock,
+                           jacobian_do,
+                           jacobian_quantities,
+                           jacobian_indices,
+                           iy_aux_vars,
+                           verbosity,
+                           mblock_index,
+                           n1y,
+                           j_analytical_do);
+  };
+
+  if (tasking && !arts_omp_in_parallel() &&
+      arts_omp_get_max_threads() > 1) {
+    out3 << "  Running mblock loop as tasks (" << nmblock << " iterations)\n";
+
+    // The measurement blocks become tasks and the los and frequency loops
+    // inside them create further tasks, see arts_omp_tasking. Workspace
+    // copies are created inside the tasks, as they must be destroyed by
+    // the thread that created them.
+    WorkspaceCopy l_ws(ws);
+
+    arts_omp_set_tasking(true);
+#pragma omp parallel
+#pragma omp single
+    arts_omp_task_chunks(nmblock, 1, [&](const long first, const long last) {
+      WorkspaceCopy l_task_ws(l_ws);
+      Agenda l_jacobian_agenda(jacobian_agenda);
+      Agenda l_iy_main_agenda(iy_main_agenda);
+      Agenda l_geo_pos_agenda(geo_pos_agenda);
+
+      for (Index mblock_index = first; mblock_index < last; mblock_index++) {
+        // Skip remaining iterations if an error occurred
+        if (failed) continue;
+
+        mblock_calc(l_task_ws,
+                    l_iy_main_agenda,
+                    l_geo_pos_agenda,
+                    l_jacobian_agenda,
+                    mblock_index);
+      }
+    });
+    arts_omp_set_tasking(false);
+  } else if (nmblock >= arts_omp_get_max_threads() ||
+             (nf <= nmblock && nmblock >= nlos)) {
     out3 << "  Parallelizing mblock loop (" << nmblock << " iterations)\n";
 
     // We have to make a local copy of the Workspace and the agendas because
-    // only non-reference types can be declared firstprivate in OpenMP
-    Workspace l_ws(ws);
+    // only non-reference types can be declared firstprivate in OpenMP.
+    // The workspace copies are reused between calls, see WorkspaceCopy.
+    WorkspaceCopy l_ws(ws);
     Agenda l_jacobian_agenda(jacobian_agenda);
     Agenda l_iy_main_agenda(iy_main_agenda);
     Agenda l_geo_pos_agenda(geo_pos_agenda);
@@ -1884,42 +2021,11 @@ void yCalc(Workspace& ws,
       // Skip remaining iterations if an error occurred
       if (failed) continue;
 
-      yCalc_mblock_loop_body(failed,
-                             fail_msg,
-                             iyb_aux_array,
-                             l_ws,
-                             y,
-                             y_f,
-                             y_pol,
-                             y_pos,
-                             y_los,
-                             y_geo,
-                             jacobian,
-                             atmosphere_dim,
-                             nlte_field,
-                             cloudbox_on,
-                             stokes_dim,
-                             f_grid,
-                             sensor_pos,
-                             sensor_los,
-                             transmitter_pos,
-                             mblock_dlos_grid,
-                             sensor_response,
-                             sensor_response_f,
-                             sensor_response_pol,
-                             sensor_response_dlos,
-                             iy_unit,
-                             l_iy_main_agenda,
-                             l_geo_pos_agenda,
-                             l_jacobian_agenda,
-                             jacobian_do,
-                             jacobian_quantities,
-                             jacobian_indices,
-                             iy_aux_vars,
-                             verbosity,
-                             mblock_index,
-                             n1y,
-                             j_analytical_do);
+      mblock_calc(l_ws,
+                  l_iy_main_agenda,
+                  l_geo_pos_agenda,
+                  l_jacobian_agenda,
+                  mblock_index);
     }  // End mblock loop
   } else {
     out3 << "  Not parallelizing mblock loop (" << nmblock << " iterations)\n";
@@ -1928,42 +2034,8 @@ void yCalc(Workspace& ws,
       // Skip remaining iterations if an error occurred
       if (failed) continue;
 
-      yCalc_mblock_loop_body(failed,
-                             fail_msg,
-                             iyb_aux_array,
-                             ws,
-                             y,
-                             y_f,
-                             y_pol,
-                             y_pos,
-                             y_los,
-                             y_geo,
-                             jacobian,
-                             atmosphere_dim,
-                             nlte_field,
-                             cloudbox_on,
-                             stokes_dim,
-                             f_grid,
-                             sensor_pos,
-                             sensor_los,
-                             transmitter_pos,
-                             mblock_dlos_grid,
-                             sensor_response,
-                             sensor_response_f,
-                             sensor_response_pol,
-                             sensor_response_dlos,
-                             iy_unit,
-                             iy_main_agenda,
-                             geo_pos_agenda,
-                             jacobian_agenda,
-                             jacobian_do,
-                             jacobian_quantities,
-                             jacobian_indices,
-                             iy_aux_vars,
-                             verbosity,
-                             mblock_index,
-                             n1y,
-                             j_analytical_do);
+      mblock_calc(
+          ws, iy_main_agenda, geo_pos_agenda, jacobian_agenda, mblock_index);
     }  // End mblock loop
   }
 
@@ -2040,6 +2112,7 @@ void yCalcAppend(Workspace& ws,
                  const ArrayOfString& iy_aux_vars,
                  const ArrayOfRetrievalQuantity& jacobian_quantities_copy,
                  const Index& append_instrument_wfs,
+                 const Index& tasking,
                  const Verbosity& verbosity) {
   // The jacobian indices of old and new part (without transformations)
   ArrayOfArrayOfIndex jacobian_indices, jacobian_indices_copy;
@@ -2115,6 +2188,7 @@ void yCalcAppend(Workspace& ws,
         jacobian_do,
         jacobian_quantities,
         iy_aux_vars,
+        tasking,
         verbosity);
 
   // Consistency checks
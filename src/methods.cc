@@ -370,6 +370,43 @@ void define_md_data_raw() {
       GIN_DEFAULT(),
       GIN_DESC()));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("abs_coefCalcFromLookup"),
+      DESCRIPTION(
+          "Extract absorption coefficients from the lookup table for all\n"
+          "points of *abs_p*, *abs_t*, and *abs_vmrs* at once.\n"
+          "\n"
+          "This gives the same result as *propmat_clearskyAddFromLookup* for\n"
+          "each point, but the checks of the table, the frequency\n"
+          "interpolation, and the pressure grid positions are done once for\n"
+          "all points.  Use it for example with the atmospheric values along\n"
+          "a whole propagation path.  The radiative transfer methods do not\n"
+          "use it, since they call *propmat_clearsky_agenda* for one point at\n"
+          "a time.\n"
+          "\n"
+          "See *propmat_clearskyAddFromLookup* for the interpolation orders\n"
+          "and *extpolfac*.  Zeeman species, free electrons and particles are\n"
+          "not stored in the table and get zero absorption.\n"),
+      AUTHORS("The ARTS Developers"),
+      OUT("abs_coef", "abs_coef_per_species"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("abs_lookup",
+         "abs_lookup_is_adapted",
+         "abs_p_interp_order",
+         "abs_t_interp_order",
+         "abs_nls_interp_order",
+         "abs_f_interp_order",
+         "f_grid",
+         "abs_p",
+         "abs_t",
+         "abs_vmrs"),
+      GIN("extpolfac"),
+      GIN_TYPE("Numeric"),
+      GIN_DEFAULT("0.5"),
+      GIN_DESC("Extrapolation factor (for temperature and VMR grid edges).")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("abs_cont_descriptionAppend"),
       DESCRIPTION(
@@ -609,6 +646,22 @@ void define_md_data_raw() {
       GIN_DEFAULT(),
       GIN_DESC()));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("abs_lines_per_speciesReadBinaryCatalog"),
+      DESCRIPTION("As *abs_linesReadBinaryCatalog* but only reads the bands\n"
+                  "of the species in *abs_species* and sorts them by species\n"),
+      AUTHORS("The ARTS Developers"),
+      OUT("abs_lines_per_species"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("abs_species", "f_grid"),
+      GIN("filename", "fmargin"),
+      GIN_TYPE("String", "Numeric"),
+      GIN_DEFAULT(NODEF, "-1"),
+      GIN_DESC("Name of the binary catalog file",
+               "Largest distance from *f_grid* to the line centers of bands without cutoff, negative for no limit")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("abs_lines_per_speciesReadSplitCatalog"),
       DESCRIPTION("Reads *abs_lines_per_species* split by\n"
@@ -626,6 +679,32 @@ void define_md_data_raw() {
       GIN_DEFAULT(NODEF),
       GIN_DESC("The path to the split catalog files")));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("abs_linesReadBinaryCatalog"),
+      DESCRIPTION("Reads the bands of a binary catalog that matter for *f_grid*\n"
+                  "\n"
+                  "The catalog is written by *abs_linesWriteBinaryCatalog*. Its index\n"
+                  "holds the frequency range each band can contribute to, as given by\n"
+                  "the line centers, the cutoff and the mirroring of the band. Only the\n"
+                  "bands whose range overlaps *f_grid* are read from the file.\n"
+                  "\n"
+                  "Bands without cutoff contribute to all frequencies and are always\n"
+                  "read, unless fmargin is zero or positive. Then only bands with line\n"
+                  "centers closer than fmargin to *f_grid* are read. The same applies\n"
+                  "to the low frequency side of bands with a fixed cutoff frequency.\n"
+                  "Bands with a cutoff relative to the line centers are not affected.\n"),
+      AUTHORS("The ARTS Developers"),
+      OUT("abs_lines"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("f_grid"),
+      GIN("filename", "fmargin"),
+      GIN_TYPE("String", "Numeric"),
+      GIN_DEFAULT(NODEF, "-1"),
+      GIN_DESC("Name of the binary catalog file",
+               "Largest distance from *f_grid* to the line centers of bands without cutoff, negative for no limit")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("abs_linesReadSpeciesSplitCatalog"),
       DESCRIPTION("Reads a catalog of absorption lines files in a directory\n"),
@@ -971,6 +1050,13 @@ void define_md_data_raw() {
                            "\t\"VP\"   \t - \t Voigt profile\n"
                            "\t\"SDVP\" \t - \t Speed-dependent Voigt profile\n"
                            "\t\"HTP\"  \t - \t Hartman-Tran profile\n"
+                           "\t\"FVP\"  \t - \t Voigt profile, fast approximation\n"
+                           "\n"
+                           "The fast approximation of the Voigt profile evaluates the\n"
+                           "Faddeeva function by Weideman's rational series and a\n"
+                           "continued fraction in the far wings.  The relative error\n"
+                           "of the line shape is below 1e-10 and the absolute error\n"
+                           "of its real part is below 1e-12 of the line peak.\n"
                            "\n"
                            "See the theory guide for more details.\n"),
                AUTHORS("Richard Larsson"),
@@ -1899,7 +1985,35 @@ void define_md_data_raw() {
           "generated.\n"
           "\n"
           "Note, that the absorbing gas can be any gas, but the perturbing gas is\n"
-          "always H2O.\n"),
+          "always H2O.\n"
+          "\n"
+          "The calculation is split into blocks, one for each species, H2O\n"
+          "perturbation, temperature perturbation, chunk of *abs_p*, and\n"
+          "chunk of *f_grid*. The blocks are calculated in parallel. Setting\n"
+          "the chunk sizes gives more blocks than threads also for tables with\n"
+          "few perturbations. The default, 0, means no chunking.\n"
+          "\n"
+          "Progress and an estimate of the remaining time are reported to\n"
+          "out2 every 30 seconds.\n"
+          "\n"
+          "If *checkpoint_file* is set, the unfinished table is written to this\n"
+          "file every *checkpoint_interval* seconds, in the format of\n"
+          "*abs_lookupWriteMapped*. If the file exists when the method starts,\n"
+          "the blocks it already holds are not calculated again. It must then\n"
+          "belong to a table with the same species and grids. At the end the\n"
+          "complete table is written to the file. Each checkpoint is written\n"
+          "from a copy of the table, so memory for a second table is needed\n"
+          "while it is written.\n"
+          "\n"
+          "With *t_derivative* set to 1, the temperature derivative of the\n"
+          "cross-sections is stored as well, as returned by *abs_xsec_agenda*\n"
+          "for a temperature Jacobian. *propmat_clearskyAddFromLookup* then\n"
+          "uses it for temperature Jacobians. This doubles the size of the\n"
+          "table, and can not be combined with checkpoints.\n"
+          "\n"
+          "*abs_xsec_per_speciesAddHitranXsec* gives no temperature derivative\n"
+          "yet. The stored derivative is then zero for those species, and their\n"
+          "temperature Jacobian only has the change of the number density.\n"),
       AUTHORS("Stefan Buehler"),
       OUT("abs_lookup", "abs_lookup_is_adapted"),
       GOUT(),
@@ -1914,10 +2028,48 @@ void define_md_data_raw() {
          "abs_t_pert",
          "abs_nls_pert",
          "abs_xsec_agenda"),
-      GIN(),
-      GIN_TYPE(),
-      GIN_DEFAULT(),
-      GIN_DESC()));
+      GIN("f_chunk",
+          "p_chunk",
+          "checkpoint_file",
+          "checkpoint_interval",
+          "t_derivative"),
+      GIN_TYPE("Index", "Index", "String", "Numeric", "Index"),
+      GIN_DEFAULT("0", "0", "", "600", "0"),
+      GIN_DESC("Number of frequencies per block, 0 for all.",
+               "Number of pressures per block, 0 for all.",
+               "File for checkpoints, empty for none.",
+               "Minimum time between checkpoints [s].",
+               "Flag to store the temperature derivative of the "
+               "cross-sections.")));
+
+  md_data_raw.push_back(create_mdrecord(
+      NAME("abs_lookupCompress"),
+      DESCRIPTION(
+          "Stores the absorption cross-sections of the lookup table with\n"
+          "reduced precision.\n"
+          "\n"
+          "This reduces the memory of the table, and the memory bandwidth of\n"
+          "the extraction, by a factor of 2 (Float32) or 4 (Float16). The\n"
+          "cross-sections are converted back inside the interpolation.\n"
+          "\n"
+          "Float32 keeps about 7 significant digits. Float16 keeps about 3, and\n"
+          "is scaled by the largest value in frequency for each pressure level,\n"
+          "temperature perturbation and species. Values below about 6e-5 of\n"
+          "that largest value lose relative precision, and the smallest value\n"
+          "that is not zero is about 6e-8 of it. Use *abs_lookupTestAccuracy*\n"
+          "on the full table to see the error added for your case.\n"
+          "\n"
+          "The table must be adapted before it is compressed.\n"),
+      AUTHORS("The ARTS Developers"),
+      OUT("abs_lookup"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("abs_lookup", "abs_lookup_is_adapted"),
+      GIN("precision"),
+      GIN_TYPE("String"),
+      GIN_DEFAULT("Float32"),
+      GIN_DESC("Storage precision: \"Double\", \"Float32\", or \"Float16\".")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("abs_lookupInit"),
@@ -1937,6 +2089,37 @@ void define_md_data_raw() {
       GIN_DEFAULT(),
       GIN_DESC()));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("abs_lookupReadMapped"),
+      DESCRIPTION(
+          "Maps a gas absorption lookup table from a file in native format.\n"
+          "\n"
+          "Reads a table written by *abs_lookupWriteMapped*. Only the grids\n"
+          "and reference profiles are read, the absorption cross-sections are\n"
+          "memory mapped. The file stores them with frequency as the slowest\n"
+          "running dimension, so only the parts of the file holding\n"
+          "frequencies that are actually extracted are ever read from disk.\n"
+          "Several ARTS processes on the same node mapping the same file share\n"
+          "one copy of it in memory.\n"
+          "\n"
+          "The table must still be adapted with *abs_lookupAdapt*. If the\n"
+          "species are kept and *f_grid* is a contiguous part of the\n"
+          "table's frequency grid, the adapted table stays mapped. Otherwise\n"
+          "the selected cross-sections are copied into memory.\n"
+          "\n"
+          "The file format is the machine's memory representation and can not\n"
+          "be exchanged between machines with different byte order.\n"),
+      AUTHORS("The ARTS Developers"),
+      OUT("abs_lookup"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN(),
+      GIN("filename"),
+      GIN_TYPE("String"),
+      GIN_DEFAULT(NODEF),
+      GIN_DESC("Name of the table file.")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("abs_lookupSetup"),
       DESCRIPTION(
@@ -2145,6 +2328,11 @@ void define_md_data_raw() {
           "\n"
           "For error units see *abs_lookupTestAccMC*\n"
           "\n"
+          "For a table with full precision, the method also reports the error\n"
+          "that storing it with reduced precision by *abs_lookupCompress*\n"
+          "would add, by comparing with a compressed copy at the reference\n"
+          "conditions of each pressure level.\n"
+          "\n"
           "Produces no workspace output, only output to the output streams.\n"),
       AUTHORS("Stefan Buehler"),
       OUT(),
@@ -2162,6 +2350,26 @@ void define_md_data_raw() {
       GIN_DEFAULT(),
       GIN_DESC()));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("abs_lookupWriteMapped"),
+      DESCRIPTION(
+          "Writes a gas absorption lookup table in native format.\n"
+          "\n"
+          "The file can be memory mapped with *abs_lookupReadMapped*. The\n"
+          "absorption cross-sections are stored with frequency as the slowest\n"
+          "running dimension. Any table can be written, also one that has been\n"
+          "read by *abs_lookupReadMapped*.\n"),
+      AUTHORS("The ARTS Developers"),
+      OUT(),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("abs_lookup"),
+      GIN("filename"),
+      GIN_TYPE("String"),
+      GIN_DEFAULT(NODEF),
+      GIN_DESC("Name of the table file.")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("abs_lookupTestAccMC"),
       DESCRIPTION(
@@ -2541,7 +2749,25 @@ void define_md_data_raw() {
       NAME("abs_xsec_per_speciesAddLines"),
       DESCRIPTION(
           "Calculates the line spectrum for both attenuation and phase\n"
-          "for each tag group and adds it to abs_xsec_per_species.\n"),
+          "for each tag group and adds it to abs_xsec_per_species.\n"
+          "\n"
+          "If *sparse_lim* is positive, lines further away than *sparse_lim*\n"
+          "from every frequency of *f_grid* are far lines.  *f_grid* must\n"
+          "then be strictly increasing.  Far lines are computed by the\n"
+          "Lorentz wing of their line shape, which differs from the Voigt\n"
+          "wing by a relative (GD / *sparse_lim*)^2 / 2, GD being the\n"
+          "Doppler width.  If a coarse grid with spacing *sparse_df* around\n"
+          "all of *f_grid* is smaller than *f_grid*, the far lines are\n"
+          "computed on that grid and linearly interpolated onto *f_grid*.\n"
+          "Otherwise, as for a few isolated channels, they are computed\n"
+          "on *f_grid*.  *sparse_df* must be smaller than *sparse_lim*.\n"
+          "\n"
+          "An upper bound of the relative interpolation error of the far\n"
+          "line wings is reported at verbosity level 2.  It also covers\n"
+          "mirrored lines and line mixing.  Lines with a cutoff have a kink\n"
+          "at the cutoff frequency.  The interpolation error there is\n"
+          "bounded separately, relative to the wing value at the cutoff,\n"
+          "and is reported as well.\n"),
       AUTHORS("Richard Larsson"),
       OUT("abs_xsec_per_species",
           "src_xsec_per_species",
@@ -2566,10 +2792,11 @@ void define_md_data_raw() {
          "isotopologue_ratios",
          "partition_functions",
          "lbl_checked"),
-      GIN(),
-      GIN_TYPE(),
-      GIN_DEFAULT(),
-      GIN_DESC()));
+      GIN("sparse_df", "sparse_lim"),
+      GIN_TYPE("Numeric", "Numeric"),
+      GIN_DEFAULT("0", "0"),
+      GIN_DESC("Spacing of the coarse frequency grid of far lines [Hz]",
+               "Distance to all of *f_grid* beyond which a line is far [Hz]")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("abs_xsec_per_speciesAddLineMixedLines"),
@@ -4915,13 +5142,13 @@ void define_md_data_raw() {
       IN(),
       GIN("var1", "var2", "maxabsdiff", "error_message"),
       GIN_TYPE(  // INPUT 1
-          "Numeric, Vector, Matrix, Tensor3, Tensor4, Tensor5, Tensor7,"
-          "ArrayOfVector, ArrayOfMatrix, ArrayOfTensor7, GriddedField3,"
-          "Sparse, SingleScatteringData",
+          "Numeric, Vector, Matrix, Tensor3, Tensor4, Tensor5, Tensor6,"
+          "Tensor7, ArrayOfVector, ArrayOfMatrix, ArrayOfTensor7,"
+          "GriddedField3, Sparse, SingleScatteringData",
           // INPUT 2
-          "Numeric, Vector, Matrix, Tensor3, Tensor4, Tensor5, Tensor7,"
-          "ArrayOfVector, ArrayOfMatrix, ArrayOfTensor7, GriddedField3,"
-          "Sparse, SingleScatteringData",
+          "Numeric, Vector, Matrix, Tensor3, Tensor4, Tensor5, Tensor6,"
+          "Tensor7, ArrayOfVector, ArrayOfMatrix, ArrayOfTensor7,"
+          "GriddedField3, Sparse, SingleScatteringData",
           // OTHER INPUT
           "Numeric",
           "String"),
@@ -5978,9 +6205,27 @@ void define_md_data_raw() {
           "transformed or interpolated from the raw data to the laboratory frame\n"
           "for all possible combinations of the angles contained in the angular\n"
           "grids which are set in *DOAngularGridsSet*. The resulting phase\n"
-          "matrices are stored in *pha_mat_sptDOITOpt*.\n"),
+          "matrices are stored in *pha_mat_sptDOITOpt*.\n"
+          "\n"
+          "The phase matrices summed over the scattering elements are stored\n"
+          "in *pha_mat_doit* for all cloudbox grid points, so that\n"
+          "*doit_scat_fieldCalc* does not calculate them in each iteration.\n"
+          "For 3D this is only done if *pha_mat_doit* needs at most\n"
+          "*pha_mat_doit_max_size* bytes, otherwise *pha_mat_doit* is empty.\n"
+          "\n"
+          "If *scat_kernel* is set, the phase matrices are further combined\n"
+          "with the weights of the angular integration into\n"
+          "*doit_scat_kernel*. *doit_scat_fieldCalc* then obtains the\n"
+          "scattering integral as a matrix-vector product in each iteration.\n"
+          "The kernel is only calculated if it needs at most\n"
+          "*scat_kernel_max_size* bytes, otherwise *doit_scat_kernel* is\n"
+          "empty and the scattering integral is calculated as without kernel.\n"),
       AUTHORS("Claudia Emde"),
-      OUT("pha_mat_sptDOITOpt", "scat_data_mono", "pha_mat_doit", "aa_grid"),
+      OUT("pha_mat_sptDOITOpt",
+          "scat_data_mono",
+          "pha_mat_doit",
+          "doit_scat_kernel",
+          "aa_grid"),
       GOUT(),
       GOUT_TYPE(),
       GOUT_DESC(),
@@ -5995,10 +6240,12 @@ void define_md_data_raw() {
          "cloudbox_limits",
          "pnd_field",
          "pha_mat_spt_agenda"),
-      GIN(),
-      GIN_TYPE(),
-      GIN_DEFAULT(),
-      GIN_DESC()));
+      GIN("pha_mat_doit_max_size", "scat_kernel", "scat_kernel_max_size"),
+      GIN_TYPE("Numeric", "Index", "Numeric"),
+      GIN_DEFAULT("1e9", "0", "1e9"),
+      GIN_DESC("Maximum size of *pha_mat_doit* for 3D [byte].",
+               "Flag whether to calculate *doit_scat_kernel*.",
+               "Maximum size of *doit_scat_kernel* [byte].")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("DoitWriteIterationFields"),
@@ -6189,7 +6436,10 @@ void define_md_data_raw() {
           "\n"
           "The scattering integral field is generated by integrating\n"
           "the product of phase matrix and Stokes vector over all incident\n"
-          "angles. For more information please refer to AUG.\n"),
+          "angles. For more information please refer to AUG.\n"
+          "\n"
+          "If *doit_scat_kernel* matches the present grids, the integral is\n"
+          "obtained from it instead, see *DoitScatteringDataPrepare*.\n"),
       AUTHORS("Sreerekha T.R.", "Claudia Emde"),
       OUT("doit_scat_field"),
       GOUT(),
@@ -6205,7 +6455,8 @@ void define_md_data_raw() {
          "za_grid",
          "aa_grid",
          "doit_za_grid_size",
-         "pha_mat_doit"),
+         "pha_mat_doit",
+         "doit_scat_kernel"),
       GIN(),
       GIN_TYPE(),
       GIN_DEFAULT(),
@@ -12683,6 +12934,12 @@ void define_md_data_raw() {
           "default for temperature and VMR interpolation, but the extrapolation\n"
           "limit can here be adjusted by the *extpolfac* argument.\n"
           "\n"
+          "Temperature and H2O VMR Jacobians are analytical, from the same\n"
+          "extraction. The temperature derivative is taken from the table if\n"
+          "it was calculated with it (see *abs_lookupCalc*), otherwise it is\n"
+          "the derivative of the temperature interpolation. Note that the latter\n"
+          "is zero for *abs_t_interp_order* 0.\n"
+          "\n"
           "See also: *propmat_clearskyAddOnTheFly*.\n"),
       AUTHORS("Stefan Buehler, Richard Larsson"),
       OUT("propmat_clearsky", "dpropmat_clearsky_dx"),
@@ -14434,6 +14691,26 @@ void define_md_data_raw() {
       GIN_DEFAULT(),
       GIN_DESC()));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("abs_linesWriteBinaryCatalog"),
+      DESCRIPTION("Writes *abs_lines* to a single binary catalog file with a\n"
+                  "frequency index of the bands.\n"
+                  "\n"
+                  "The catalog is read by *abs_linesReadBinaryCatalog* and\n"
+                  "*abs_lines_per_speciesReadBinaryCatalog*. An existing split catalog\n"
+                  "is converted by reading it, e.g. with *abs_linesReadSpeciesSplitCatalog*,\n"
+                  "and writing it again with this method.\n"),
+      AUTHORS("The ARTS Developers"),
+      OUT(),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("abs_lines"),
+      GIN("filename"),
+      GIN_TYPE("String"),
+      GIN_DEFAULT(NODEF),
+      GIN_DESC("Name of the binary catalog file")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("abs_linesWriteSplitXML"),
       DESCRIPTION("Writes a split catalog, AbsorptionLines by AbsorptionLines.\n"
@@ -20652,6 +20929,14 @@ void define_md_data_raw() {
           "of a series of spectra), all depending on the settings. Spectra\n"
           "and jacobians are calculated in parallel.\n"
           "\n"
+          "By default, either the measurement blocks or the pencil beams are\n"
+          "distributed over the threads, whichever gives more iterations.\n"
+          "This leaves threads idle when there are few measurement blocks and\n"
+          "each of them is expensive. With *tasking* set to 1, the measurement\n"
+          "blocks, the pencil beams of each block and the propagation path\n"
+          "points of *iyEmissionStandard* are all run as OpenMP tasks, so that\n"
+          "the work of all levels is balanced over the threads.\n"
+          "\n"
           "The frequency, polarisation etc. for each measurement value is\n"
           "given by *y_f*, *y_pol*, *y_pos* and *y_los*.\n"
           "\n"
@@ -20699,10 +20984,10 @@ void define_md_data_raw() {
          "jacobian_do",
          "jacobian_quantities",
          "iy_aux_vars"),
-      GIN(),
-      GIN_TYPE(),
-      GIN_DEFAULT(),
-      GIN_DESC()));
+      GIN("tasking"),
+      GIN_TYPE("Index"),
+      GIN_DEFAULT("0"),
+      GIN_DESC("Flag to run the nested loops as OpenMP tasks.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("yCalcAppend"),
@@ -20792,12 +21077,13 @@ void define_md_data_raw() {
          "jacobian_do",
          "jacobian_quantities",
          "iy_aux_vars"),
-      GIN("jacobian_quantities_copy", "append_instrument_wfs"),
-      GIN_TYPE("ArrayOfRetrievalQuantity", "Index"),
-      GIN_DEFAULT(NODEF, "0"),
+      GIN("jacobian_quantities_copy", "append_instrument_wfs", "tasking"),
+      GIN_TYPE("ArrayOfRetrievalQuantity", "Index", "Index"),
+      GIN_DEFAULT(NODEF, "0", "0"),
       GIN_DESC("Copy of *jacobian_quantities* of first measurement.",
                "Flag controlling if instrumental weighting functions are "
-               "appended or treated as different retrieval quantities.")));
+               "appended or treated as different retrieval quantities.",
+               "Flag to run the nested loops as OpenMP tasks, see *yCalc*.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("yActive"),
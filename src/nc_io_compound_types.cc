@@ -47,6 +47,7 @@
  \author Oliver Lemke
 */
 void nca_read_from_file(const int ncid, GasAbsLookup& gal, const Verbosity&) {
+  gal.ClearXsecStorage();
   nca_get_data_ArrayOfArrayOfSpeciesTag(ncid, "species", gal.species, true);
   if (!gal.species.nelem())
     throw runtime_error("No species found in lookup table file!");
@@ -144,7 +145,11 @@ void nca_write_to_file(const int ncid,
   int t_ref_varid = nca_def_Vector(ncid, "t_ref", gal.t_ref);
   int t_pert_varid = nca_def_Vector(ncid, "t_pert", gal.t_pert);
   int nls_pert_varid = nca_def_Vector(ncid, "nls_pert", gal.nls_pert);
-  int xsec_varid = nca_def_Tensor4(ncid, "xsec", gal.xsec);
+  // Mapped and compressed tables have their cross sections outside of xsec
+  const bool xsec_outside = gal.IsMapped() or gal.IsCompressed();
+  const Tensor4 xsec_copy = xsec_outside ? gal.XsecTensor() : Tensor4();
+  const Tensor4& xsec = xsec_outside ? xsec_copy : gal.xsec;
+  int xsec_varid = nca_def_Tensor4(ncid, "xsec", xsec);
 
   if ((retval = nc_enddef(ncid))) nca_error(retval, "nc_enddef");
 
@@ -166,7 +171,7 @@ void nca_write_to_file(const int ncid,
   nca_put_var_Vector(ncid, t_ref_varid, gal.t_ref);
   nca_put_var_Vector(ncid, t_pert_varid, gal.t_pert);
   nca_put_var_Vector(ncid, nls_pert_varid, gal.nls_pert);
-  nca_put_var_Tensor4(ncid, xsec_varid, gal.xsec);
+  nca_put_var_Tensor4(ncid, xsec_varid, xsec);
 }
 
 ////////////////////////////////////////////////////////////////////////////
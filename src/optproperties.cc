@@ -2048,8 +2048,10 @@ void ssd_tinterp_parameters(  //Output
       GridPosPoly dummy_gp;
       dummy_gp.idx.resize(this_T_interp_order + 1);
       dummy_gp.w.resize(this_T_interp_order + 1);
-      for (Index i = 0; i <= this_T_interp_order; ++i) dummy_gp.idx[i] = i;
-      dummy_gp.w = 0.;
+      for (Index i = 0; i <= this_T_interp_order; ++i) {
+        dummy_gp.idx[i] = i;
+        dummy_gp.w[i] = 0.;
+      }
       dummy_gp.w[0] = 1.;
       bool grid_unchecked = true;
 
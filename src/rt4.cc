@@ -562,7 +562,9 @@ void run_rt4(Workspace& ws,
     }
 
     if (!pfct_failed) {
+#ifndef FORTRAN_OPENMP
 #pragma omp critical(fortran_rt4)
+#endif
       {
         // Call RT4
         radtrano_(stokes_dim,
@@ -737,7 +739,9 @@ void run_rt4(Workspace& ws,
       Tensor3 down_rad_new(num_layers + 1, nummu_new, stokes_dim, 0.);
       //
       // run radtrano_
+#ifndef FORTRAN_OPENMP
 #pragma omp critical(fortran_rt4)
+#endif
       {
         // Call RT4
         radtrano_(stokes_dim,
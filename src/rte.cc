@@ -32,6 +32,7 @@
 #include "rte.h"
 #include <cmath>
 #include <stdexcept>
+#include <vector>
 #include "auto_md.h"
 #include "check_input.h"
 #include "legacy_continua.h"
@@ -1031,6 +1032,63 @@ void get_iy_of_background(Workspace& ws,
   }
 }
 
+//! Interpolates several atmospheric fields to a sequence of positions
+/*!
+  Does the same as calling interp_atmfield_by_itw for each field, but
+  in a single pass over the positions. The corners and weights of each
+  position are looked up once and then used for all fields, instead of
+  traversing the grid positions and weights once per field.
+
+  \param[out] x      Interpolated values, one vector per field.
+  \param atmosphere_dim As the WSV.
+  \param x_fields    The fields to interpolate.
+  \param gp_p        Pressure grid positions.
+  \param gp_lat      Latitude grid positions.
+  \param gp_lon      Longitude grid positions.
+  \param itw         Interpolation weights, from interp_atmfield_gp2itw.
+*/
+static void interp_atmfields_by_itw(
+    std::vector<VectorView>& x,
+    const Index& atmosphere_dim,
+    const std::vector<ConstTensor3View>& x_fields,
+    const ArrayOfGridPos& gp_p,
+    const ArrayOfGridPos& gp_lat,
+    const ArrayOfGridPos& gp_lon,
+    ConstMatrixView itw) {
+  const Index n = gp_p.nelem();
+  const Index nfields = x_fields.size();
+  assert(x.size() == x_fields.size());
+
+  // Number of corners: 2, 4 or 8
+  const Index ncorners = Index(1) << atmosphere_dim;
+  assert(itw.ncols() == ncorners);
+
+  Index ip[8], ilat[8], ilon[8];
+  Numeric w[8];
+
+  for (Index i = 0; i < n; i++) {
+    // Corners in the same order as the weights of interpweights
+    const Index p0 = gp_p[i].idx;
+    const Index lat0 = atmosphere_dim > 1 ? gp_lat[i].idx : 0;
+    const Index lon0 = atmosphere_dim > 2 ? gp_lon[i].idx : 0;
+    for (Index k = 0; k < ncorners; k++) {
+      ip[k] = p0 + (k >> (atmosphere_dim - 1));
+      ilat[k] = atmosphere_dim > 1 ? lat0 + ((k >> (atmosphere_dim - 2)) & 1)
+                                   : 0;
+      ilon[k] = atmosphere_dim > 2 ? lon0 + (k & 1) : 0;
+      w[k] = itw(i, k);
+    }
+
+    for (Index f = 0; f < nfields; f++) {
+      const ConstTensor3View& field = x_fields[f];
+      Numeric xi = 0;
+      for (Index k = 0; k < ncorners; k++)
+        xi += field.get(ip[k], ilat[k], ilon[k]) * w[k];
+      x[f][i] = xi;
+    }
+  }
+}
+
 void get_ppath_atmvars(Vector& ppath_p,
                        Vector& ppath_t,
                        EnergyLevelMap& ppath_nlte,
@@ -1056,98 +1114,55 @@ void get_ppath_atmvars(Vector& ppath_p,
   interpweights(itw_p, ppath.gp_p);
   itw2p(ppath_p, p_grid, ppath.gp_p, itw_p);
 
-  // Temperature:
-  ppath_t.resize(np);
+  // Interpolation weights, common to all fields
   Matrix itw_field;
   interp_atmfield_gp2itw(
       itw_field, atmosphere_dim, ppath.gp_p, ppath.gp_lat, ppath.gp_lon);
-  interp_atmfield_by_itw(ppath_t,
-                         atmosphere_dim,
-                         t_field,
-                         ppath.gp_p,
-                         ppath.gp_lat,
-                         ppath.gp_lon,
-                         itw_field);
 
-  // VMR fields:
+  // Temperature, VMR, wind and magnetic fields are interpolated together
   const Index ns = vmr_field.nbooks();
+  ppath_t.resize(np);
   ppath_vmr.resize(ns, np);
-  for (Index is = 0; is < ns; is++) {
-    interp_atmfield_by_itw(ppath_vmr(is, joker),
-                           atmosphere_dim,
-                           vmr_field(is, joker, joker, joker),
-                           ppath.gp_p,
-                           ppath.gp_lat,
-                           ppath.gp_lon,
-                           itw_field);
-  }
-
-  // NLTE temperatures
-  ppath_nlte = nlte_field.InterpToGridPos(atmosphere_dim, ppath.gp_p, ppath.gp_lat, ppath.gp_lon);
-
-  // Winds:
   ppath_wind.resize(3, np);
   ppath_wind = 0;
-  //
-  if (wind_u_field.npages() > 0) {
-    interp_atmfield_by_itw(ppath_wind(0, joker),
-                           atmosphere_dim,
-                           wind_u_field,
-                           ppath.gp_p,
-                           ppath.gp_lat,
-                           ppath.gp_lon,
-                           itw_field);
-  }
-  if (wind_v_field.npages() > 0) {
-    interp_atmfield_by_itw(ppath_wind(1, joker),
-                           atmosphere_dim,
-                           wind_v_field,
-                           ppath.gp_p,
-                           ppath.gp_lat,
-                           ppath.gp_lon,
-                           itw_field);
-  }
-  if (wind_w_field.npages() > 0) {
-    interp_atmfield_by_itw(ppath_wind(2, joker),
-                           atmosphere_dim,
-                           wind_w_field,
-                           ppath.gp_p,
-                           ppath.gp_lat,
-                           ppath.gp_lon,
-                           itw_field);
-  }
-
-  // Magnetic field:
   ppath_mag.resize(3, np);
   ppath_mag = 0;
+
+  std::vector<ConstTensor3View> fields;
+  std::vector<VectorView> ppath_fields;
+  fields.reserve(ns + 7);
+  ppath_fields.reserve(ns + 7);
   //
-  if (mag_u_field.npages() > 0) {
-    interp_atmfield_by_itw(ppath_mag(0, joker),
-                           atmosphere_dim,
-                           mag_u_field,
-                           ppath.gp_p,
-                           ppath.gp_lat,
-                           ppath.gp_lon,
-                           itw_field);
-  }
-  if (mag_v_field.npages() > 0) {
-    interp_atmfield_by_itw(ppath_mag(1, joker),
-                           atmosphere_dim,
-                           mag_v_field,
-                           ppath.gp_p,
-                           ppath.gp_lat,
-                           ppath.gp_lon,
-                           itw_field);
-  }
-  if (mag_w_field.npages() > 0) {
-    interp_atmfield_by_itw(ppath_mag(2, joker),
-                           atmosphere_dim,
-                           mag_w_field,
-                           ppath.gp_p,
-                           ppath.gp_lat,
-                           ppath.gp_lon,
-                           itw_field);
+  fields.push_back(t_field);
+  ppath_fields.push_back(ppath_t);
+  for (Index is = 0; is < ns; is++) {
+    fields.push_back(vmr_field(is, joker, joker, joker));
+    ppath_fields.push_back(ppath_vmr(is, joker));
+  }
+  const ConstTensor3View wind_mag_fields[] = {wind_u_field,
+                                              wind_v_field,
+                                              wind_w_field,
+                                              mag_u_field,
+                                              mag_v_field,
+                                              mag_w_field};
+  for (Index i = 0; i < 6; i++) {
+    if (wind_mag_fields[i].npages() > 0) {
+      fields.push_back(wind_mag_fields[i]);
+      ppath_fields.push_back(i < 3 ? ppath_wind(i, joker)
+                                   : ppath_mag(i - 3, joker));
+    }
   }
+
+  interp_atmfields_by_itw(ppath_fields,
+                          atmosphere_dim,
+                          fields,
+                          ppath.gp_p,
+                          ppath.gp_lat,
+                          ppath.gp_lon,
+                          itw_field);
+
+  // NLTE temperatures
+  ppath_nlte = nlte_field.InterpToGridPos(atmosphere_dim, ppath.gp_p, ppath.gp_lat, ppath.gp_lon);
 }
 
 void get_ppath_cloudvars(ArrayOfIndex& clear2cloudy,
@@ -2097,14 +2112,88 @@ void iyb_calc(Workspace& ws,
   ArrayOfArrayOfMatrix iy_aux_array(nlos);
 
   // We have to make a local copy of the Workspace and the agendas because
-  // only non-reference types can be declared firstprivate in OpenMP
-  Workspace l_ws(ws);
+  // only non-reference types can be declared firstprivate in OpenMP.
+  // The workspace copies are reused between calls, see WorkspaceCopy.
+  WorkspaceCopy l_ws(ws);
   Agenda l_iy_main_agenda(iy_main_agenda);
   Agenda l_geo_pos_agenda(geo_pos_agenda);
 
   String fail_msg;
   bool failed = false;
-  if (nlos >= arts_omp_get_max_threads() || nlos * 10 >= nf) {
+
+  // Calculations for one LOS, with the given workspace and agendas
+  auto los_calc = [&](Workspace& ws_los,
+                      const Agenda& iy_main_agenda_los,
+                      const Agenda& geo_pos_agenda_los,
+                      const Index ilos) {
+    Ppath ppath;
+    iyb_calc_body(failed,
+                  fail_msg,
+                  iy_aux_array,
+                  ws_los,
+                  ppath,
+                  iyb,
+                  diyb_dx,
+                  mblock_index,
+                  atmosphere_dim,
+                  nlte_field,
+                  cloudbox_on,
+                  stokes_dim,
+                  sensor_pos,
+                  sensor_los,
+                  transmitter_pos,
+                  mblock_dlos_grid,
+                  iy_unit,
+                  iy_main_agenda_los,
+                  j_analytical_do,
+                  jacobian_quantities,
+                  jacobian_indices,
+                  f_grid,
+                  iy_aux_vars,
+                  ilos,
+                  nf);
+
+    // Skip remaining calculations if an error occurred
+    if (failed) return;
+
+    Vector geo_pos;
+    try {
+      geo_pos_agendaExecute(ws_los, geo_pos, ppath, geo_pos_agenda_los);
+      if (geo_pos.nelem()) {
+        if (geo_pos.nelem() != 5)
+          throw runtime_error(
+              "Wrong size of *geo_pos* obtained from *geo_pos_agenda*.\n"
+              "The length of *geo_pos* must be zero or five.");
+
+        geo_pos_matrix(ilos, joker) = geo_pos;
+      }
+    } catch (const std::exception& e) {
+#pragma omp critical(iyb_calc_fail)
+      {
+        fail_msg = e.what();
+        failed = true;
+      }
+    }
+  };
+
+  if (arts_omp_tasking()) {
+    out3 << "  Running los loop as tasks (" << nlos << " iterations, " << nf
+         << " frequencies)\n";
+
+    arts_omp_task_chunks(nlos, 1, [&](const long first, const long last) {
+      WorkspaceCopy l_task_ws(l_ws);
+      Agenda l_task_iy_main_agenda(l_iy_main_agenda);
+      Agenda l_task_geo_pos_agenda(l_geo_pos_agenda);
+
+      for (Index ilos = first; ilos < last; ilos++) {
+        // Skip remaining iterations if an error occurred
+        if (failed) continue;
+
+        los_calc(
+            l_task_ws, l_task_iy_main_agenda, l_task_geo_pos_agenda, ilos);
+      }
+    });
+  } else if (nlos >= arts_omp_get_max_threads() || nlos * 10 >= nf) {
     out3 << "  Parallelizing los loop (" << nlos << " iterations, " << nf
          << " frequencies)\n";
 
@@ -2115,55 +2204,7 @@ void iyb_calc(Workspace& ws,
       // Skip remaining iterations if an error occurred
       if (failed) continue;
 
-      Ppath ppath;
-      iyb_calc_body(failed,
-                    fail_msg,
-                    iy_aux_array,
-                    l_ws,
-                    ppath,
-                    iyb,
-                    diyb_dx,
-                    mblock_index,
-                    atmosphere_dim,
-                    nlte_field,
-                    cloudbox_on,
-                    stokes_dim,
-                    sensor_pos,
-                    sensor_los,
-                    transmitter_pos,
-                    mblock_dlos_grid,
-                    iy_unit,
-                    l_iy_main_agenda,
-                    j_analytical_do,
-                    jacobian_quantities,
-                    jacobian_indices,
-                    f_grid,
-                    iy_aux_vars,
-                    ilos,
-                    nf);
-
-      // Skip remaining iterations if an error occurred
-      if (failed) continue;
-
-      // Note that this code is found in two places inside the function
-      Vector geo_pos;
-      try {
-        geo_pos_agendaExecute(l_ws, geo_pos, ppath, l_geo_pos_agenda);
-        if (geo_pos.nelem()) {
-          if (geo_pos.nelem() != 5)
-            throw runtime_error(
-                "Wrong size of *geo_pos* obtained from *geo_pos_agenda*.\n"
-                "The length of *geo_pos* must be zero or five.");
-
-          geo_pos_matrix(ilos, joker) = geo_pos;
-        }
-      } catch (const std::exception& e) {
-#pragma omp critical(iyb_calc_fail)
-        {
-          fail_msg = e.what();
-          failed = true;
-        }
-      }
+      los_calc(l_ws, l_iy_main_agenda, l_geo_pos_agenda, ilos);
     }
   } else {
     out3 << "  Not parallelizing los loop (" << nlos << " iterations, " << nf
@@ -2173,55 +2214,7 @@ void iyb_calc(Workspace& ws,
       // Skip remaining iterations if an error occurred
       if (failed) continue;
 
-      Ppath ppath;
-      iyb_calc_body(failed,
-                    fail_msg,
-                    iy_aux_array,
-                    l_ws,
-                    ppath,
-                    iyb,
-                    diyb_dx,
-                    mblock_index,
-                    atmosphere_dim,
-                    nlte_field,
-                    cloudbox_on,
-                    stokes_dim,
-                    sensor_pos,
-                    sensor_los,
-                    transmitter_pos,
-                    mblock_dlos_grid,
-                    iy_unit,
-                    l_iy_main_agenda,
-                    j_analytical_do,
-                    jacobian_quantities,
-                    jacobian_indices,
-                    f_grid,
-                    iy_aux_vars,
-                    ilos,
-                    nf);
-
-      // Skip remaining iterations if an error occurred
-      if (failed) continue;
-
-      // Note that this code is found in two places inside the function
-      Vector geo_pos;
-      try {
-        geo_pos_agendaExecute(l_ws, geo_pos, ppath, l_geo_pos_agenda);
-        if (geo_pos.nelem()) {
-          if (geo_pos.nelem() != 5)
-            throw runtime_error(
-                "Wrong size of *geo_pos* obtained from *geo_pos_agenda*.\n"
-                "The length of *geo_pos* must be zero or five.");
-
-          geo_pos_matrix(ilos, joker) = geo_pos;
-        }
-      } catch (const std::exception& e) {
-#pragma omp critical(iyb_calc_fail)
-        {
-          fail_msg = e.what();
-          failed = true;
-        }
-      }
+      los_calc(l_ws, l_iy_main_agenda, l_geo_pos_agenda, ilos);
     }
   }
 
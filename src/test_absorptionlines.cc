@@ -0,0 +1,161 @@
+/* Copyright (C) 2020, The ARTS Developers.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/*!
+  \file   test_absorptionlines.cc
+
+  \brief  Tests for reading absorption line catalogs.
+
+  The program exits with a non-zero status if a test fails.
+*/
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include "absorptionlines.h"
+#include "arts.h"
+
+using std::cout;
+
+//! Fails the test program with a message
+void fail(const String& msg) {
+  cout << "Error: " << msg << "\n";
+  exit(1);
+}
+
+//! Frequency of line i of the test catalog
+Numeric test_catalog_f0(const Index i) { return 1e9 + Numeric(i) * 1e6; }
+
+//! ARTSCAT-5 records sorted by frequency, with comments and a closing tag
+String test_catalog(const Index nlines) {
+  std::ostringstream os;
+  os << std::setprecision(15);
+  for (Index i = 0; i < nlines; i++) {
+    if (i % 97 == 0) os << "This line is not a record\n";
+    os << "@ O2-66 " << test_catalog_f0(i) << ' ' << 1e-20 * Numeric(1 + i % 7)
+       << " 296 " << 1e-21 * Numeric(i) << " 1e-5 3 3\n";
+  }
+  os << "</ArrayOfLineRecord>\n";
+  return os.str();
+}
+
+//! Reads the catalog one line at a time, the way the readers did before
+std::vector<Absorption::SingleLineExternal> serial_read(const String& text,
+                                                        const Numeric fmin,
+                                                        const Numeric fmax) {
+  std::istringstream is(text);
+  std::vector<Absorption::SingleLineExternal> v;
+  for (;;) {
+    auto sle = Absorption::ReadFromArtscat5Stream(is);
+    if (sle.bad or sle.line.F0() > fmax) break;
+    if (sle.line.F0() >= fmin) v.push_back(std::move(sle));
+  }
+  return v;
+}
+
+//! Compares the parallel reader to the serial one for a frequency window
+/*!
+  The small chunk size splits the catalog into many blocks of a few chunks,
+  so that the window starts and ends inside a chunk.
+*/
+void test_parallel_read(const String& text,
+                        const Numeric fmin,
+                        const Numeric fmax) {
+  const auto ref = serial_read(text, fmin, fmax);
+
+  std::istringstream is(text);
+  const auto v = Absorption::parallel_read_external_lines(
+      is, Absorption::ReadFromArtscat5Stream, fmin, fmax,
+      "</ArrayOfLineRecord>", 1000);
+
+  std::ostringstream window;
+  window << "[" << fmin << ", " << fmax << "]";
+
+  if (v.size() != ref.size()) {
+    std::ostringstream os;
+    os << "Read " << v.size() << " lines in " << window.str()
+       << ", expected " << ref.size();
+    fail(os.str());
+  }
+
+  for (size_t i = 0; i < v.size(); i++) {
+    if (v[i].line.F0() != ref[i].line.F0() or
+        v[i].line.I0() != ref[i].line.I0() or
+        v[i].line.E0() != ref[i].line.E0() or
+        v[i].quantumidentity.Species() != ref[i].quantumidentity.Species() or
+        v[i].quantumidentity.Isotopologue() !=
+            ref[i].quantumidentity.Isotopologue()) {
+      std::ostringstream os;
+      os << "Line " << i << " in " << window.str()
+         << " differs from the serial reader";
+      fail(os.str());
+    }
+  }
+}
+
+//! Parallel and serial reading must give the same lines
+void test_parallel_read_windows() {
+  const Index nlines = 3000;
+  const String text = test_catalog(nlines);
+
+  test_parallel_read(text, 0, 1e99);
+  test_parallel_read(text, test_catalog_f0(1234) - 0.5e6,
+                     test_catalog_f0(2345) + 0.5e6);
+  test_parallel_read(text, test_catalog_f0(10), test_catalog_f0(11));
+  test_parallel_read(text, test_catalog_f0(nlines - 1), 1e99);
+  test_parallel_read(text, test_catalog_f0(nlines), 1e99);
+  test_parallel_read(text, 0, test_catalog_f0(0) - 1);
+
+  cout << "Parallel reading of " << nlines << " lines ok\n";
+}
+
+//! A catalog without its closing tag is an error, unless reading stops before
+void test_parallel_read_missing_end_tag() {
+  const Index nlines = 300;
+  String text = test_catalog(nlines);
+  text.erase(text.find("</ArrayOfLineRecord>"));
+
+  bool threw = false;
+  try {
+    std::istringstream is(text);
+    Absorption::parallel_read_external_lines(
+        is, Absorption::ReadFromArtscat5Stream, 0, 1e99,
+        "</ArrayOfLineRecord>", 1000);
+  } catch (const std::runtime_error&) {
+    threw = true;
+  }
+  if (not threw) fail("A catalog without closing tag was accepted");
+
+  std::istringstream is(text);
+  const auto v = Absorption::parallel_read_external_lines(
+      is, Absorption::ReadFromArtscat5Stream, 0, test_catalog_f0(100),
+      "</ArrayOfLineRecord>", 1000);
+  if (v.size() != 101) fail("Reading did not stop at fmax");
+
+  cout << "Missing closing tag ok\n";
+}
+
+int main() {
+  define_species_data();
+  define_species_map();
+
+  test_parallel_read_windows();
+  test_parallel_read_missing_end_tag();
+
+  return 0;
+}
@@ -0,0 +1,212 @@
+/* Copyright (C) 2020, The ARTS Developers.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/*!
+  \file   test_agenda.cc
+
+  \brief  Tests for the execution of agendas.
+
+  Checks the output of a small g0_agenda and the runtime checks of the
+  method inputs. The program exits with a non-zero status if a test fails.
+
+  With a number as argument, the agenda is executed that many times and
+  the time per execution is printed.
+*/
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include "agenda_class.h"
+#include "agenda_record.h"
+#include "arts.h"
+#include "auto_md.h"
+#include "global_data.h"
+#include "methods.h"
+#include "workspace_ng.h"
+
+using std::cout;
+
+//! Fails the test program with a message
+void fail(const String& msg) {
+  cout << "Error: " << msg << "\n";
+  exit(1);
+}
+
+//! A method call of an agenda
+MRecord method(const String& name,
+               const ArrayOfString& out,
+               const ArrayOfString& in) {
+  ArrayOfIndex out_ids, in_ids;
+  for (const auto& v : out) out_ids.push_back(get_wsv_id(v));
+  for (const auto& v : in) in_ids.push_back(get_wsv_id(v));
+  return MRecord(
+      global_data::MdMap.find(name)->second, out_ids, in_ids, TokVal(), Agenda());
+}
+
+//! A checked g0_agenda with the given methods
+Agenda g0_agenda(Workspace& ws,
+                 const Array<MRecord>& methods,
+                 const Verbosity& verbosity) {
+  Agenda a;
+  a.set_name("g0_agenda");
+  a.set_methods(methods);
+  a.check(ws, verbosity);
+  return a;
+}
+
+//! Executes the agenda and returns the error message, empty on success
+String try_execute(Workspace& ws, Numeric& g0, const Agenda& a) {
+  try {
+    g0_agendaExecute(ws, g0, 45., 0., a);
+  } catch (const std::runtime_error& e) {
+    return e.what();
+  }
+  return "";
+}
+
+//! Compares the output of g0_agenda to calling g0Earth directly
+void test_output(Workspace& ws, const Verbosity& verbosity) {
+  cout << "g0_agenda output\n";
+
+  const Agenda a =
+      g0_agenda(ws,
+                {method("g0Earth", {"g0"}, {"lat"}),
+                 method("Ignore_sg_Numeric", {}, {"lon"})},
+                verbosity);
+
+  const Index id_verbosity = get_wsv_id("verbosity");
+  const Index depth = ws.depth(id_verbosity);
+
+  for (Numeric lat = -90; lat <= 90; lat += 15) {
+    Numeric g0 = 0, g0_ref = 0;
+    g0_agendaExecute(ws, g0, lat, 0., a);
+    g0Earth(g0_ref, lat, verbosity);
+    if (g0 != g0_ref) {
+      std::ostringstream os;
+      os << "g0_agenda gives " << g0 << " at latitude " << lat
+         << ", g0Earth gives " << g0_ref;
+      fail(os.str());
+    }
+  }
+
+  if (ws.depth(id_verbosity) != depth)
+    fail("The verbosity stack changed by executing g0_agenda");
+}
+
+//! Checks that uninitialized method inputs are found at runtime
+void test_input_checks(Workspace& ws, const Verbosity& verbosity) {
+  cout << "g0_agenda input checks\n";
+
+  if (ws.is_initialized(get_wsv_id("rtp_temperature")))
+    fail("rtp_temperature is initialized before the test");
+
+  const MRecord g0 = method("g0Earth", {"g0"}, {"lat"});
+  const MRecord ignore_lon = method("Ignore_sg_Numeric", {}, {"lon"});
+  const MRecord ignore_t =
+      method("Ignore_sg_Numeric", {}, {"rtp_temperature"});
+  const MRecord set_t =
+      method("Copy_sg_Numeric", {"rtp_temperature"}, {"lat"});
+  const MRecord delete_t = method("Delete_sg_Numeric", {}, {"rtp_temperature"});
+
+  Numeric g0_out;
+
+  // An input that is never set
+  String msg = try_execute(
+      ws, g0_out, g0_agenda(ws, {g0, ignore_lon, ignore_t}, verbosity));
+  if (msg.find("needs input variable: rtp_temperature") == std::string::npos)
+    fail("Missing input is not detected, message: \"" + msg + "\"");
+
+  // An input set by an earlier method of the agenda
+  msg = try_execute(
+      ws, g0_out, g0_agenda(ws, {g0, set_t, ignore_lon, ignore_t}, verbosity));
+  if (msg.length()) fail("Input set by the agenda is rejected: " + msg);
+
+  // The same input, set too late
+  msg = try_execute(
+      ws, g0_out, g0_agenda(ws, {g0, ignore_lon, ignore_t, set_t}, verbosity));
+  if (msg.find("needs input variable: rtp_temperature") == std::string::npos)
+    fail("Input set after use is not detected, message: \"" + msg + "\"");
+
+  // Agendas with Delete are fully checked
+  msg = try_execute(
+      ws,
+      g0_out,
+      g0_agenda(ws, {g0, set_t, delete_t, ignore_lon, ignore_t}, verbosity));
+  if (msg.find("needs input variable: rtp_temperature") == std::string::npos)
+    fail("Deleted input is not detected, message: \"" + msg + "\"");
+
+  // Delete in an agenda only deletes its local copy
+  const Index t_id = get_wsv_id("rtp_temperature");
+  *((Numeric*)ws[t_id]) = 250;
+  msg = try_execute(
+      ws, g0_out, g0_agenda(ws, {g0, delete_t, ignore_lon}, verbosity));
+  if (msg.length()) fail("Agenda with Delete fails: " + msg);
+  if (not ws.is_initialized(t_id) or *((Numeric*)ws[t_id]) != 250)
+    fail("Delete in the agenda deleted the variable outside of it");
+}
+
+//! Measures the time per execution of a small g0_agenda
+void time_execution(Workspace& ws, const Verbosity& verbosity, Index nloop) {
+  const Agenda a =
+      g0_agenda(ws,
+                {method("g0Earth", {"g0"}, {"lat"}),
+                 method("Ignore_sg_Numeric", {}, {"lon"})},
+                verbosity);
+
+  Numeric g0 = 0.;
+  Numeric sum = 0.;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (Index i = 0; i < nloop; i++) {
+    g0_agendaExecute(ws, g0, Numeric(i % 90), 0., a);
+    sum += g0;
+  }
+  const auto end = std::chrono::steady_clock::now();
+
+  const double ns =
+      std::chrono::duration<double, std::nano>(end - start).count();
+  cout << "Executed g0_agenda " << nloop << " times\n"
+       << "Time per execution: " << ns / (double)nloop << " ns\n"
+       << "Mean g0: " << sum / (double)nloop << '\n';
+}
+
+int main(int argc, char* argv[]) {
+  define_wsv_group_names();
+  Workspace::define_wsv_data();
+  Workspace::define_wsv_map();
+  define_md_data_raw();
+  expand_md_data_raw_to_md_data();
+  define_md_map();
+  define_md_raw_map();
+  define_agenda_data();
+  define_agenda_map();
+  define_species_data();
+  define_species_map();
+
+  Workspace ws;
+  ws.initialize();
+
+  const Verbosity verbosity(0, 0, 0);
+  *((Verbosity*)ws[get_wsv_id("verbosity")]) = verbosity;
+
+  test_output(ws, verbosity);
+  test_input_checks(ws, verbosity);
+
+  if (argc > 1) time_execution(ws, verbosity, atol(argv[1]));
+
+  return 0;
+}
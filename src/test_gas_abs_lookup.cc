@@ -0,0 +1,329 @@
+/* Copyright (C) 2020, The ARTS Developers.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/*!
+  \file   test_gas_abs_lookup.cc
+
+  \brief  Tests for the gas absorption lookup table.
+
+  The program exits with a non-zero status if a test fails.
+*/
+
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include "arts.h"
+#include "gas_abs_lookup.h"
+#include "messages.h"
+
+using std::cout;
+
+//! Fails the test program with a message
+void fail(const String& msg) {
+  cout << "Error: " << msg << "\n";
+  exit(1);
+}
+
+//! Value of a half precision bit pattern, computed from its definition
+Numeric half_value(const std::uint16_t h) {
+  const Numeric sign = (h & 0x8000) ? -1 : 1;
+  const int exp = (h >> 10) & 0x1f;
+  const int mant = h & 0x3ff;
+  if (exp == 0x1f)
+    return mant ? std::numeric_limits<Numeric>::quiet_NaN()
+                : sign * std::numeric_limits<Numeric>::infinity();
+  if (exp == 0) return sign * std::ldexp(Numeric(mant), -24);
+  return sign * std::ldexp(Numeric(1024 + mant), exp - 25);
+}
+
+//! Converts all half precision numbers to double and back
+void test_half_all_values() {
+  cout << "Half precision conversion of all bit patterns\n";
+
+  for (Index i = 0; i < 0x10000; i++) {
+    const std::uint16_t h = std::uint16_t(i);
+    const Numeric x = numeric_from_half(h);
+    const Numeric ref = half_value(h);
+    const std::uint16_t h2 = half_from_numeric(x);
+
+    std::ostringstream os;
+    os << std::hex << "0x" << i << std::dec << " (" << ref << "): ";
+
+    if (std::isnan(ref)) {
+      // NaN keeps its sign and stays NaN
+      if (not std::isnan(x) or std::signbit(x) != bool(h & 0x8000))
+        fail(os.str() + "is not converted to NaN");
+      if ((h2 & 0x7c00) != 0x7c00 or not(h2 & 0x3ff) or
+          (h2 & 0x8000) != (h & 0x8000))
+        fail(os.str() + "NaN is not converted back to NaN");
+      continue;
+    }
+
+    if (x != ref or std::signbit(x) != std::signbit(ref)) {
+      os << "converted to " << x;
+      fail(os.str());
+    }
+    if (h2 != h) {
+      os << "converted back to 0x" << std::hex << h2;
+      fail(os.str());
+    }
+  }
+}
+
+//! Rounding of double precision values to half precision
+void test_half_rounding() {
+  cout << "Half precision rounding\n";
+
+  const Numeric inf = std::numeric_limits<Numeric>::infinity();
+  const struct {
+    Numeric x;
+    std::uint16_t h;
+  } cases[] = {
+      {0., 0x0000},
+      {-0., 0x8000},
+      {1., 0x3c00},
+      {-2., 0xc000},
+      {0.1, 0x2e66},
+      // Ties go to even, also when the double is just above the tie
+      {1 + std::ldexp(1., -11), 0x3c00},
+      {1 + 3 * std::ldexp(1., -11), 0x3c02},
+      {1 + std::ldexp(1., -11) + std::ldexp(1., -40), 0x3c01},
+      // Largest finite value, and overflow to infinity
+      {65504., 0x7bff},
+      {65519.99, 0x7bff},
+      {65520., 0x7c00},
+      {1e10, 0x7c00},
+      {-1e300, 0xfc00},
+      {inf, 0x7c00},
+      {-inf, 0xfc00},
+      // Smallest normal value and the subnormals below it
+      {std::ldexp(1., -14), 0x0400},
+      {std::ldexp(1., -14) - std::ldexp(1., -24), 0x03ff},
+      {std::ldexp(1., -14) - std::ldexp(1., -26), 0x0400},
+      {std::ldexp(1., -24), 0x0001},
+      {-std::ldexp(1., -24), 0x8001},
+      {3 * std::ldexp(1., -25), 0x0002},
+      {5 * std::ldexp(1., -25), 0x0002},
+      {std::ldexp(1., -24) * 0.75, 0x0001},
+      // Underflow to zero, half of the smallest subnormal is a tie
+      {std::ldexp(1., -25), 0x0000},
+      {std::ldexp(1., -25) * (1 + 1e-15), 0x0001},
+      {std::ldexp(1., -26), 0x0000},
+      {-1e-30, 0x8000},
+      {std::numeric_limits<Numeric>::denorm_min(), 0x0000},
+  };
+
+  for (const auto& c : cases) {
+    const std::uint16_t h = half_from_numeric(c.x);
+    if (h != c.h) {
+      std::ostringstream os;
+      os << std::setprecision(17) << c.x << " is converted to 0x" << std::hex
+         << h << ", expected 0x" << c.h;
+      fail(os.str());
+    }
+  }
+
+  const std::uint16_t h = half_from_numeric(std::nan(""));
+  if ((h & 0x7c00) != 0x7c00 or not(h & 0x3ff))
+    fail("NaN is not converted to NaN");
+}
+
+//! The relative error of normal values is at most half a unit in the
+//! last place, 2^-11
+void test_half_precision() {
+  cout << "Half precision relative error\n";
+
+  Numeric max_err = 0;
+  for (Numeric x = std::ldexp(1., -14); x < 65504; x *= 1.0001) {
+    const Numeric err = std::abs(numeric_from_half(half_from_numeric(x)) - x) / x;
+    max_err = std::max(max_err, err);
+  }
+
+  cout << "max relative error: " << max_err << "\n";
+  if (max_err > std::ldexp(1., -11))
+    fail("Relative error of normal half precision values exceeds 2^-11");
+}
+
+//! A small table with cross sections that are quadratic in temperature
+/*!
+  H2O is a nonlinear species, with cross sections that are linear in the
+  fractional VMR, and O2 is linear. The temperature derivative of the
+  cross sections is stored. Temperature interpolation of order 2 and
+  linear H2O interpolation are then exact.
+*/
+GasAbsLookup quadratic_table() {
+  GasAbsLookup table;
+
+  table.Species().resize(2);
+  table.Species()[0] = ArrayOfSpeciesTag(1, SpeciesTag("H2O"));
+  table.Species()[1] = ArrayOfSpeciesTag(1, SpeciesTag("O2"));
+  table.NonLinearSpecies() = ArrayOfIndex(1, 0);
+  table.Fgrid() = {100e9, 110e9, 120e9};
+  table.Pgrid() = {1e5, 1e4, 1e3};
+  table.VMRs() = Matrix(2, 3);
+  table.VMRs()(0, joker) = 0.01;
+  table.VMRs()(1, joker) = 0.21;
+  table.Tref() = {260, 255, 250};
+  table.Tpert() = {-20, -10, 0, 10, 20};
+  table.NLSPert() = {0, 1, 2};
+
+  // The species dimension holds the three H2O perturbations, then O2
+  const Index n_t = table.Tpert().nelem();
+  const Index n_s = 4;
+  const Index n_f = table.Fgrid().nelem();
+  const Index n_p = table.Pgrid().nelem();
+  table.Xsec().resize(n_t, n_s, n_f, n_p);
+  table.dXsecdT().resize(n_t, n_s, n_f, n_p);
+  for (Index it = 0; it < n_t; it++)
+    for (Index is = 0; is < n_s; is++)
+      for (Index iv = 0; iv < n_f; iv++)
+        for (Index ip = 0; ip < n_p; ip++) {
+          const Numeric T = table.Tref()[ip] + table.Tpert()[it];
+          const Numeric frac = is < 3 ? table.NLSPert()[is] : 1;
+          const Numeric c0 = 1e-24 * (1 + 0.5 * frac + 0.1 * Numeric(iv + ip));
+          const Numeric c1 = -2e-27 * (1 + 0.2 * Numeric(is + iv));
+          const Numeric c2 = 5e-30 * (1 + 0.1 * Numeric(ip));
+          table.Xsec()(it, is, iv, ip) = c0 + c1 * T + c2 * T * T;
+          table.dXsecdT()(it, is, iv, ip) = c1 + 2 * c2 * T;
+        }
+
+  table.Adapt(table.Species(), table.Fgrid(), Verbosity());
+  return table;
+}
+
+//! Compares the temperature derivative from Extract to finite differences
+/*!
+  With the stored derivative, and with the derivative of the temperature
+  interpolation, at pressures on and between the table levels.
+*/
+void test_extract_temperature_derivative() {
+  cout << "Temperature derivative of extracted absorption\n";
+
+  GasAbsLookup table = quadratic_table();
+  const Vector vmrs{0.015, 0.2};
+  const Numeric dT = 1e-3;
+
+  for (bool stored : {true, false}) {
+    if (not stored) table.dXsecdT().resize(0, 0, 0, 0);
+    if (table.HasTemperatureDerivative() != stored)
+      fail("Wrong HasTemperatureDerivative");
+
+    for (Numeric p : {1e5, 3e4, 2e3}) {
+      for (Numeric T : {243., 255., 266.5}) {
+        Matrix sga, dsga_dT, dsga_dnls, sga_lo, sga_hi;
+        table.Extract(sga, dsga_dT, dsga_dnls, true, false,
+                      1, 2, 1, 0, p, T, vmrs, table.Fgrid(), 0.5);
+        table.Extract(
+            sga_lo, 1, 2, 1, 0, p, T - dT, vmrs, table.Fgrid(), 0.5);
+        table.Extract(
+            sga_hi, 1, 2, 1, 0, p, T + dT, vmrs, table.Fgrid(), 0.5);
+
+        for (Index is = 0; is < sga.nrows(); is++)
+          for (Index iv = 0; iv < sga.ncols(); iv++) {
+            const Numeric fd = (sga_hi(is, iv) - sga_lo(is, iv)) / (2 * dT);
+            if (not(std::abs(dsga_dT(is, iv) - fd) <= 1e-8 * std::abs(fd))) {
+              std::ostringstream os;
+              os << std::setprecision(17)
+                 << (stored ? "Stored" : "Interpolated")
+                 << " derivative at p = " << p << ", T = " << T
+                 << ", species " << is << ", frequency " << iv << " is "
+                 << dsga_dT(is, iv) << ", finite difference " << fd;
+              fail(os.str());
+            }
+          }
+      }
+    }
+  }
+}
+
+//! Compares the extraction of many points to single point extractions
+void test_extract_many_points() {
+  cout << "Extraction of many points\n";
+
+  const GasAbsLookup table = quadratic_table();
+
+  const Vector p{3e4, 1e5, 2e3, 1e4, 5e4, 1e3};
+  const Vector T{255., 262., 243., 266.5, 250., 240.};
+  Matrix vmrs(2, p.nelem());
+  for (Index ip = 0; ip < p.nelem(); ip++) {
+    vmrs(0, ip) = 0.005 + 0.003 * Numeric(ip);
+    vmrs(1, ip) = 0.21 - 0.01 * Numeric(ip);
+  }
+
+  for (Index p_order : {0, 1, 2}) {
+    for (Index t_order : {1, 2}) {
+      Tensor3 sga;
+      table.Extract(
+          sga, p_order, t_order, 1, 0, p, T, vmrs, table.GetFgrid(), 0.5);
+      if (sga.npages() != p.nelem() or sga.nrows() != 2 or
+          sga.ncols() != table.GetFgrid().nelem())
+        fail("Wrong size of the absorption of many points");
+
+      for (Index ip = 0; ip < p.nelem(); ip++) {
+        Matrix sga_point;
+        table.Extract(sga_point,
+                      p_order,
+                      t_order,
+                      1,
+                      0,
+                      p[ip],
+                      T[ip],
+                      vmrs(joker, ip),
+                      table.GetFgrid(),
+                      0.5);
+        for (Index is = 0; is < sga.nrows(); is++)
+          for (Index iv = 0; iv < sga.ncols(); iv++)
+            if (sga(ip, is, iv) != sga_point(is, iv)) {
+              std::ostringstream os;
+              os << std::setprecision(17) << "Point " << ip
+                 << " with interpolation orders " << p_order << " and "
+                 << t_order << ", species " << is << ", frequency " << iv
+                 << ": " << sga(ip, is, iv) << " instead of "
+                 << sga_point(is, iv);
+              fail(os.str());
+            }
+      }
+    }
+  }
+
+  // A point outside of the table is an error, also among valid points
+  Vector T_bad = T;
+  T_bad[2] = 400;
+  Tensor3 sga;
+  try {
+    table.Extract(sga, 1, 2, 1, 0, p, T_bad, vmrs, table.GetFgrid(), 0.5);
+  } catch (const std::runtime_error& e) {
+    if (String(e.what()).find("Point 2:") == std::string::npos)
+      fail(String("Wrong error message for a bad point: ") + e.what());
+    return;
+  }
+  fail("A point outside of the table is not detected");
+}
+
+int main() {
+  define_species_data();
+  define_species_map();
+
+  test_half_all_values();
+  test_half_rounding();
+  test_half_precision();
+  test_extract_temperature_derivative();
+  test_extract_many_points();
+  return 0;
+}
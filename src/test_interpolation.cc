@@ -560,4 +560,42 @@ void test08() {
   }
 }
 
-int main() { test08(); }
+void test09() {
+  cout << "Derivative of the higher order polynomials.\n"
+       << "For a cubic field the derivative is exact from order 3.\n";
+
+  Vector og(1, 6, +1);    // 1, 2, 3, 4, 5, 6
+  Vector ng(1, 11, 0.5);  // 1.0, 1.5, 2.0 ... 6.0
+
+  // Original field, x^3:
+  Vector of(og.nelem());
+  for (Index i = 0; i < og.nelem(); ++i) of[i] = og[i] * og[i] * og[i];
+
+  for (Index order = 0; order < 5; ++order) {
+    ArrayOfGridPosPoly gp(1), dgp(1);
+
+    cout << "order " << order << ": ";
+    Numeric max_error = 0;
+    for (Index i = 0; i < ng.nelem(); ++i) {
+      gridpos_poly(gp[0], og, ng[i], order);
+      gridpos_poly_derivative(dgp[0], gp[0], og, ng[i]);
+
+      // The weights of the derivative add up to zero, so we can not use
+      // interp here, that checks the sum:
+      Numeric df = 0;
+      for (Index j = 0; j < order + 1; ++j) df += dgp[0].w[j] * of[dgp[0].idx[j]];
+
+      cout << setw(8) << df << " ";
+      if (order >= 3)
+        max_error = max(max_error, abs(df - 3 * ng[i] * ng[i]));
+    }
+    cout << "\n";
+
+    if (max_error > 1e-9) {
+      cout << "Error: derivative deviates by " << max_error << "\n";
+      exit(1);
+    }
+  }
+}
+
+int main() { test09(); }
@@ -0,0 +1,281 @@
+/* Copyright (C) 2020, The ARTS Developers.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/*!
+  \file   test_linefunctions.cc
+
+  \brief  Tests for the line-by-line functions.
+
+  The program exits with a non-zero status if a test fails.
+*/
+
+#include <Faddeeva/Faddeeva.hh>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include "absorptionlines.h"
+#include "linefunctions.h"
+
+using std::cout;
+
+//! Fails the test program with a message
+void fail(const String& msg) {
+  cout << "Error: " << msg << "\n";
+  exit(1);
+}
+
+//! Compares w_fast to Faddeeva::w along lines of constant Im(z)
+/*!
+  The grid covers the Weideman region |Re(z)| + Im(z) < 8, the continued
+  fraction regions of depth 8 and 3, the boundaries between them, and the
+  lower half-plane used by mirrored lines.
+*/
+void test_w_fast() {
+  cout << "w_fast against Faddeeva::w\n";
+
+  const Vector ys{1e-12, 1e-6, 1e-3, 0.1, 0.5, 1, 2,  3.5, 5,  7.5, 7.99,
+                  8,     8.01, 9,    12,  25,  49, 50, 51,  80, 200};
+  const Index nx = 2401;
+
+  Numeric max_abs_rel = 0, max_re_err = 0;
+
+  auto compare = [&](Numeric y, const Vector& xs) {
+    Eigen::VectorXcd z(xs.nelem()), W(xs.nelem());
+    for (Index i = 0; i < xs.nelem(); i++) z[i] = Complex(xs[i], y);
+    Linefunctions::w_fast(W, z);
+
+    for (Index i = 0; i < xs.nelem(); i++) {
+      const Complex ref = Faddeeva::w(z[i]);
+      if (not std::isfinite(std::abs(ref))) {
+        // exp(-z^2) overflows in the lower half-plane
+        if (std::isnan(W[i].real()) or std::isnan(W[i].imag()) or
+            std::isfinite(std::abs(W[i]))) {
+          std::ostringstream os;
+          os << "w_fast" << z[i] << " = " << W[i] << " does not overflow like "
+             << "Faddeeva::w = " << ref;
+          fail(os.str());
+        }
+        continue;
+      }
+
+      const Numeric abs_rel = std::abs(std::abs(W[i]) - std::abs(ref)) / std::abs(ref);
+      const Numeric re_err = std::abs(W[i].real() - ref.real());
+      if (not(abs_rel < 1e-10) or not(re_err < 1e-12 * std::max(1.0, std::abs(ref)))) {
+        std::ostringstream os;
+        os.precision(17);
+        os << "w_fast" << z[i] << " = " << W[i] << ", Faddeeva::w gives " << ref
+           << "\n  relative error of |w|: " << abs_rel
+           << ", absolute error of Re(w): " << re_err;
+        fail(os.str());
+      }
+      max_abs_rel = std::max(max_abs_rel, abs_rel);
+      if (std::abs(ref) <= 1) max_re_err = std::max(max_re_err, re_err);
+    }
+  };
+
+  for (const Numeric y : ys) {
+    // Regular grid and the points on and next to the region boundaries
+    Vector xs(nx + 18);
+    for (Index i = 0; i < nx; i++) xs[i] = -60 + 0.05 * Numeric(i);
+    Index j = nx;
+    for (const Numeric b : {8.0, 50.0}) {
+      for (const Numeric d : {-1e-9, 0.0, 1e-9}) {
+        xs[j++] = b - y + d;
+        xs[j++] = -(b - y + d);
+      }
+    }
+    for (const Numeric x : {1e3, -1e3, 1e7, -1e7, 1e150, -1e150}) xs[j++] = x;
+
+    compare(y, xs);
+    compare(-y, xs);
+  }
+
+  cout << "max relative error of |w|: " << max_abs_rel << "\n"
+       << "max absolute error of Re(w): " << max_re_err << "\n";
+
+  // Far outside the Weideman region of the lower half-plane, exp(-z^2)
+  // overflows.  w_fast must agree with Faddeeva::w, and may not produce NaN
+  // from intermediate overflow where the exponential term underflows
+  Eigen::VectorXcd z(6), W(6);
+  z << Complex(0, -30), Complex(1, -40), Complex(-2, -300), Complex(1e200, -1),
+      Complex(-1e200, -1e-3), Complex(1e300, -1e100);
+  Linefunctions::w_fast(W, z);
+  for (Index i = 0; i < 3; i++) {
+    const Complex ref = Faddeeva::w(z[i]);
+    if (std::isnan(W[i].real()) or std::isnan(W[i].imag()) or
+        std::isinf(W[i].real()) != std::isinf(ref.real()) or
+        std::isinf(W[i].imag()) != std::isinf(ref.imag())) {
+      std::ostringstream os;
+      os << "w_fast" << z[i] << " = " << W[i] << " does not overflow like "
+         << "Faddeeva::w = " << ref;
+      fail(os.str());
+    }
+  }
+  for (Index i = 3; i < 6; i++) {
+    if (not std::isfinite(W[i].real()) or not std::isfinite(W[i].imag())) {
+      std::ostringstream os;
+      os << "w_fast" << z[i] << " = " << W[i] << " is not finite";
+      fail(os.str());
+    }
+  }
+}
+
+//! Line shape parameters of a test band
+/*!
+  Every line and broadener gets a different mix of temperature models, so
+  all models are used for every variable and broadener.  LM_AER is only
+  used for Y and G, as in the line catalogs.
+*/
+Absorption::Lines shape_parameter_band(Numeric linemixinglimit) {
+  using LineShape::TemperatureModel;
+  const std::vector<TemperatureModel> types{TemperatureModel::None,
+                                            TemperatureModel::T0,
+                                            TemperatureModel::T1,
+                                            TemperatureModel::T2,
+                                            TemperatureModel::T3,
+                                            TemperatureModel::T4,
+                                            TemperatureModel::T5,
+                                            TemperatureModel::DPL,
+                                            TemperatureModel::LM_AER};
+
+  const Index nlines = 7;
+  const Index nbroadeners = 4;
+
+  std::vector<Absorption::SingleLine> lines;
+  for (Index k = 0; k < nlines; k++) {
+    std::vector<LineShape::SingleSpeciesModel> ssms;
+    for (Index j = 0; j < nbroadeners; j++) {
+      LineShape::SingleSpeciesModel ssm;
+      for (Index iv = 0; iv < LineShape::nVars; iv++) {
+        const auto var = LineShape::Variable(iv);
+        const bool lm_aer =
+            var == LineShape::Variable::Y or var == LineShape::Variable::G;
+        const Index ntypes = Index(types.size()) - (lm_aer ? 0 : 1);
+
+        auto& mp = ssm.Data()[iv];
+        mp.type = types[(k + 3 * j + iv) % ntypes];
+        mp.X0 = 2e4 * (1 + 0.1 * Numeric(k) + 0.03 * Numeric(j + iv));
+        mp.X1 = 0.7 + 0.05 * Numeric(j) - 0.02 * Numeric(k);
+        mp.X2 = 0.1 * Numeric(iv + 1) - 0.3;
+        mp.X3 = 1.1 - 0.1 * Numeric(j);
+      }
+      ssms.push_back(ssm);
+    }
+    lines.push_back(Absorption::SingleLine(1e11 + 1e9 * Numeric(k),
+                                           1e-20,
+                                           1e-21,
+                                           1,
+                                           3,
+                                           1e-6,
+                                           Zeeman::Model(),
+                                           LineShape::Model(ssms)));
+  }
+
+  return Absorption::Lines(false,
+                           false,
+                           Absorption::CutoffType::None,
+                           Absorption::MirroringType::None,
+                           Absorption::PopulationType::ByLTE,
+                           Absorption::NormalizationType::None,
+                           LineShape::Type::VP,
+                           296,
+                           -1,
+                           linemixinglimit,
+                           QuantumIdentifier(),
+                           {},
+                           ArrayOfSpeciesTag(nbroadeners),
+                           lines);
+}
+
+//! Fails if two line shape parameters differ by more than rounding
+void compare_output(const LineShape::Output& x,
+                    const LineShape::Output& ref,
+                    const String& what) {
+  const std::vector<std::pair<String, Numeric LineShape::Output::*>> members{
+      {"G0", &LineShape::Output::G0},
+      {"D0", &LineShape::Output::D0},
+      {"G2", &LineShape::Output::G2},
+      {"D2", &LineShape::Output::D2},
+      {"FVC", &LineShape::Output::FVC},
+      {"ETA", &LineShape::Output::ETA},
+      {"Y", &LineShape::Output::Y},
+      {"G", &LineShape::Output::G},
+      {"DV", &LineShape::Output::DV}};
+
+  for (const auto& m : members) {
+    const Numeric a = x.*m.second;
+    const Numeric b = ref.*m.second;
+    if (not(std::abs(a - b) <= 1e-12 * std::max(std::abs(a), std::abs(b)))) {
+      std::ostringstream os;
+      os << what << ", " << m.first << ": " << a << " instead of " << b;
+      fail(os.str());
+    }
+  }
+}
+
+//! Compares PackedLines::SetShapeParameters to the per-line evaluation
+/*!
+  The table must agree with Lines::ShapeParameters and
+  Lines::ShapeParameters_dT for all temperature models, on all three
+  branches of LM_AER, and with line mixing both on and off.
+*/
+void test_shape_parameters() {
+  cout << "Packed line shape parameters\n";
+
+  const Vector vmrs{0.21, 0.78, 0.01, 0.004};
+
+  for (Numeric linemixinglimit : {-1., 1e4}) {
+    const Absorption::Lines band = shape_parameter_band(linemixinglimit);
+    const Absorption::PackedLines packed(band);
+    Absorption::ShapeParameterTable table;
+
+    for (Numeric T : {220., 270., 296., 310.}) {
+      for (Numeric P : {1e3, 5e4}) {
+        std::ostringstream os;
+        os << "T = " << T << ", P = " << P
+           << ", line mixing limit = " << linemixinglimit;
+
+        packed.SetShapeParameters(table, T, P, vmrs, false);
+        if (Index(table.X.size()) != band.NumLines() or table.dXdT.size())
+          fail(os.str() + ": wrong table size without derivatives");
+        for (Index k = 0; k < band.NumLines(); k++)
+          compare_output(table.X[k],
+                         band.ShapeParameters(k, T, P, vmrs),
+                         os.str() + ", line " + std::to_string(k));
+
+        packed.SetShapeParameters(table, T, P, vmrs, true);
+        if (Index(table.X.size()) != band.NumLines() or
+            Index(table.dXdT.size()) != band.NumLines())
+          fail(os.str() + ": wrong table size with derivatives");
+        for (Index k = 0; k < band.NumLines(); k++) {
+          compare_output(table.X[k],
+                         band.ShapeParameters(k, T, P, vmrs),
+                         os.str() + ", line " + std::to_string(k));
+          compare_output(table.dXdT[k],
+                         band.ShapeParameters_dT(k, T, P, vmrs),
+                         os.str() + ", dT of line " + std::to_string(k));
+        }
+      }
+    }
+  }
+}
+
+int main() {
+  test_w_fast();
+  test_shape_parameters();
+  return 0;
+}
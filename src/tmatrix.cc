@@ -1035,7 +1035,8 @@ void calcSingleScatteringDataProperties(SingleScatteringData& ssd,
       ostringstream os;
       os << "Calculation of SingleScatteringData properties failed for\n\n";
       bool anyfailed = false;
-#pragma omp critical(tmatrix_ssp)
+      // tmd_ does not depend on a previous call, so only the call itself
+      // has to be serialized (in tmatrix_random_orientation).
       for (Index f_index = 0; f_index < nf; ++f_index)
         for (Index T_index = 0; T_index < nT; ++T_index) {
           bool thisfailed = false;
@@ -1117,6 +1118,9 @@ void calcSingleScatteringDataProperties(SingleScatteringData& ssd,
 
       Tensor5 csca_data(nf, nT, nza, 1, 2);
 
+      // ampl_ uses the T-matrix that tmatrix_ leaves in the common blocks.
+      // The common blocks hold several hundred MB and can not be made
+      // threadprivate, so the whole sequence is serialized.
 #pragma omp critical(tmatrix_ssp)
       for (Index f_index = 0; f_index < nf; ++f_index) {
         const Numeric lam_f = lam[f_index];
@@ -1565,6 +1565,32 @@ void Workspace::define_wsv_data() {
           "        N_za, N_aa, N_i ]\n"),
       GROUP("Tensor6")));
 
+  wsv_data.push_back(WsvRecord(
+      NAME("doit_scat_kernel"),
+      DESCRIPTION(
+          "Scattering kernel of the DOIT scattering integral.\n"
+          "\n"
+          "The phase matrices of *pha_mat_doit* multiplied with the weights\n"
+          "of the angular integration, so that *doit_scat_fieldCalc* obtains\n"
+          "the scattered field of a cloudbox grid point as a matrix-vector\n"
+          "product with the radiation field. The kernel does not change\n"
+          "during the iterations of one frequency.\n"
+          "\n"
+          "For 1D the kernel is applied to the radiation field of all zenith\n"
+          "angles. For 3D it is applied to the radiation field of the\n"
+          "propagation direction, the incoming directions are already\n"
+          "integrated over.\n"
+          "\n"
+          "The variable is empty if no kernel has been calculated.\n"
+          "\n"
+          "Usage: Output of *DoitScatteringDataPrepare*.\n"
+          "\n"
+          "Size: [cloudbox grid points, N_za * N_aa * N_i, N_za * N_i] (1D)\n"
+          "      [cloudbox grid points, N_za * N_aa * N_i, N_i] (3D)\n"
+          "\n"
+          "The grid points are ordered as for *pha_mat_doit*.\n"),
+      GROUP("Tensor3")));
+
   wsv_data.push_back(
       WsvRecord(NAME("doit_za_grid_opt"),
                 DESCRIPTION("Optimized zenith angle grid.\n"
@@ -2925,7 +2951,11 @@ void Workspace::define_wsv_data() {
           "Unit:        m^2\n"  //FIXME: really m2? not 1/m?
           "\n"
           "Dimensions: [T,za_grid, aa_grid, za_grid, aa_grid, \n"
-          " stokes_dim, stokes_dim]\n"),
+          " stokes_dim, stokes_dim]\n"
+          "\n"
+          "For 3D the first dimension holds all cloudbox grid points, with the\n"
+          "longitude running fastest and the pressure slowest. It is empty if\n"
+          "that is too large, see *DoitScatteringDataPrepare*.\n"),
       GROUP("Tensor7")));
 
   wsv_data.push_back(WsvRecord(
@@ -23,6 +23,8 @@
  */
 
 #include "workspace_ng.h"
+#include <memory>
+#include <vector>
 #include "auto_workspace.h"
 #include "wsv_aux.h"
 
@@ -96,6 +98,46 @@ Workspace::Workspace(const Workspace &workspace) : ws(workspace.ws.nelem()) {
   }
 }
 
+void Workspace::copy_top_from(const Workspace &workspace) {
+#ifndef NDEBUG
+  context = workspace.context;
+#endif
+  if (ws.nelem() < workspace.ws.nelem()) ws.resize(workspace.ws.nelem());
+
+  for (Index i = 0; i < ws.nelem(); i++) {
+    // Keep a single level, freeing what this workspace allocated
+    while (ws[i].size() > 1) {
+      WsvStruct *wsvs = ws[i].top();
+      if (wsvs->auto_allocated && wsvs->wsv) {
+        wsmh.deallocate(wsv_data[i].Group(), wsvs->wsv);
+      }
+      delete wsvs;
+      ws[i].pop();
+    }
+
+    WsvStruct *wsvs;
+    if (ws[i].size()) {
+      wsvs = ws[i].top();
+      if (wsvs->auto_allocated && wsvs->wsv) {
+        wsmh.deallocate(wsv_data[i].Group(), wsvs->wsv);
+      }
+    } else {
+      wsvs = new WsvStruct;
+      ws[i].push(wsvs);
+    }
+
+    wsvs->auto_allocated = false;
+    if (i < workspace.ws.nelem() && workspace.ws[i].size() &&
+        workspace.ws[i].top()->wsv) {
+      wsvs->wsv = workspace.ws[i].top()->wsv;
+      wsvs->initialized = workspace.ws[i].top()->initialized;
+    } else {
+      wsvs->wsv = NULL;
+      wsvs->initialized = false;
+    }
+  }
+}
+
 Workspace::~Workspace() {
 #ifndef NDEBUG
 #pragma omp critical(ws_destruct)
@@ -154,6 +196,34 @@ void Workspace::push_uninitialized(Index i, void *wsv) {
   ws[i].push(wsvs);
 }
 
+namespace {
+/** Workspaces used by WorkspaceCopy on the current thread. */
+struct WorkspacePool {
+  std::vector<std::unique_ptr<Workspace> > workspaces;
+  size_t in_use = 0;
+};
+
+thread_local WorkspacePool workspace_pool;
+}  // namespace
+
+WorkspaceCopy::WorkspaceCopy(const WorkspaceCopy &other) : mpooled(true) {
+  WorkspacePool &pool = workspace_pool;
+  if (pool.in_use == pool.workspaces.size())
+    pool.workspaces.push_back(std::unique_ptr<Workspace>(new Workspace));
+
+  mworkspace = pool.workspaces[pool.in_use++].get();
+  mworkspace->copy_top_from(*other.mworkspace);
+}
+
+WorkspaceCopy::~WorkspaceCopy() {
+  if (mpooled) {
+    assert(workspace_pool.in_use > 0 &&
+           workspace_pool.workspaces[workspace_pool.in_use - 1].get() ==
+               mworkspace);
+    workspace_pool.in_use--;
+  }
+}
+
 void *Workspace::operator[](Index i) {
   if (!ws[i].size()) push(i, NULL);
 
@@ -78,6 +78,16 @@ class Workspace {
   /** Destruct the workspace and free all WSVs. */
   virtual ~Workspace();
 
+  /** Make this workspace a copy of another workspace.
+   *
+   * Same result as the copy constructor, but the WSV stacks of this
+   * workspace are reused, so that repeated copies into the same workspace
+   * do not allocate. WSVs that were allocated by this workspace are freed.
+   *
+   * @param[in] workspace The workspace to be copied
+   */
+  void copy_top_from(const Workspace &workspace);
+
   /** Define workspace variables. */
   static void define_wsv_data();
 
@@ -165,6 +175,43 @@ class Workspace {
   void *operator[](Index i);
 };
 
+/** Copy of a workspace for OpenMP firstprivate clauses.
+ *
+ * Replaces a Workspace in firstprivate clauses. The object created in the
+ * serial part only refers to the given workspace. Its copies, made by
+ * OpenMP for each thread, are copies of that workspace, as if it had been
+ * copied directly. But they are taken from a pool of workspaces kept by
+ * each thread, so the WSV stacks are only allocated on the first use of a
+ * thread, and not again in every call of the parallelized method.
+ *
+ * The copies must be destroyed in the reverse order of creation on each
+ * thread, which is always the case for firstprivate copies.
+ */
+class WorkspaceCopy {
+ public:
+  /** Refer to a workspace
+   *
+   * @param[in] workspace The workspace to be copied by the copies of this
+   */
+  explicit WorkspaceCopy(Workspace &workspace)
+      : mworkspace(&workspace), mpooled(false) {}
+
+  /** Copy the workspace into a workspace from the pool of the thread */
+  WorkspaceCopy(const WorkspaceCopy &other);
+
+  WorkspaceCopy &operator=(const WorkspaceCopy &) = delete;
+
+  /** Return the workspace to the pool of the thread */
+  ~WorkspaceCopy();
+
+  /** The copied workspace, or the referred one for the original object */
+  operator Workspace &() { return *mworkspace; }
+
+ private:
+  Workspace *mworkspace;
+  bool mpooled;
+};
+
 /** Print WSV name to output stream.
  *
  * Looks up the name of the WSV with index i and
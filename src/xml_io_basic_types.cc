@@ -27,12 +27,72 @@
 
 */
 
+#include <type_traits>
 #include "arts.h"
 #include "file.h"
 #include "xml_io.h"
 #include "xml_io_private.h"
 #include "xml_io_types.h"
 
+////////////////////////////////////////////////////////////////////////////
+//   Helper functions for binary data
+////////////////////////////////////////////////////////////////////////////
+
+//! Reads a block of binary values into contiguous memory
+/*!
+  The binary file holds the elements in row-major order, which is the
+  memory layout of a freshly resized matpack object. The block is
+  therefore read with a single read call instead of element by element.
+
+  \param pbifs  Pointer to binary input stream
+  \param x      Matpack object holding the contiguous data
+  \param n      Number of elements
+  \param tag    XML tag, for error messages
+*/
+template <class T>
+static void xml_read_binary_block(bifstream* pbifs,
+                                  T& x,
+                                  const Index n,
+                                  ArtsXMLTag& tag) {
+  if (!n) return;
+
+  Numeric* data = x.get_c_array();
+
+  if (std::is_same<Numeric, double>::value) {
+    pbifs->readDoubleArray(reinterpret_cast<double*>(data), n);
+  } else {
+    for (Index i = 0; i < n && !pbifs->fail(); i++) *pbifs >> data[i];
+  }
+
+  if (pbifs->fail()) {
+    ostringstream os;
+    os << " near "
+       << "\n  Binary block of " << n << " elements";
+    xml_data_parse_error(tag, os.str());
+  }
+}
+
+//! Writes a block of contiguous memory as binary values
+/*!
+  \param pbofs  Pointer to binary output stream
+  \param x      Matpack object holding the contiguous data
+  \param n      Number of elements
+*/
+template <class T>
+static void xml_write_binary_block(bofstream* pbofs,
+                                   const T& x,
+                                   const Index n) {
+  if (!n) return;
+
+  const Numeric* data = x.get_c_array();
+
+  if (std::is_same<Numeric, double>::value) {
+    pbofs->writeDoubleArray(reinterpret_cast<const double*>(data), n);
+  } else {
+    for (Index i = 0; i < n; i++) *pbofs << data[i];
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////
 //   Overloaded functions for reading/writing data from/to XML stream
 ////////////////////////////////////////////////////////////////////////////
@@ -122,17 +182,11 @@ void xml_read_from_stream(istream& is_xml,
   tag.get_attribute_value("ncols", ncols);
   matrix.resize(nrows, ncols);
 
-  for (Index r = 0; r < nrows; r++) {
-    for (Index c = 0; c < ncols; c++) {
-      if (pbifs) {
-        *pbifs >> matrix(r, c);
-        if (pbifs->fail()) {
-          ostringstream os;
-          os << " near "
-             << "\n  Row   : " << r << "\n  Column: " << c;
-          xml_data_parse_error(tag, os.str());
-        }
-      } else {
+  if (pbifs) {
+    xml_read_binary_block(pbifs, matrix, nrows * ncols, tag);
+  } else {
+    for (Index r = 0; r < nrows; r++) {
+      for (Index c = 0; c < ncols; c++) {
         is_xml >> double_imanip() >> matrix(r, c);
         if (is_xml.fail()) {
           ostringstream os;
@@ -174,20 +228,19 @@ void xml_write_to_stream(ostream& os_xml,
   xml_set_stream_precision(os_xml);
 
   // Write the elements:
-  for (Index r = 0; r < matrix.nrows(); ++r) {
-    if (pbofs)
-      *pbofs << matrix(r, 0);
-    else
+  if (pbofs) {
+    xml_write_binary_block(
+        pbofs, matrix, matrix.nrows() * matrix.ncols());
+  } else {
+    for (Index r = 0; r < matrix.nrows(); ++r) {
       os_xml << matrix(r, 0);
 
-    for (Index c = 1; c < matrix.ncols(); ++c) {
-      if (pbofs)
-        *pbofs << matrix(r, c);
-      else
+      for (Index c = 1; c < matrix.ncols(); ++c) {
         os_xml << " " << matrix(r, c);
-    }
+      }
 
-    if (!pbofs) os_xml << '\n';
+      os_xml << '\n';
+    }
   }
 
   close_tag.set_name("/Matrix");
@@ -637,19 +690,13 @@ void xml_read_from_stream(istream& is_xml,
   tag.get_attribute_value("ncols", ncols);
   tensor.resize(npages, nrows, ncols);
 
-  for (Index p = 0; p < npages; p++) {
-    for (Index r = 0; r < nrows; r++) {
-      for (Index c = 0; c < ncols; c++) {
-        if (pbifs) {
-          *pbifs >> tensor(p, r, c);
-          if (pbifs->fail()) {
-            ostringstream os;
-            os << " near "
-               << "\n  Page  : " << p << "\n  Row   : " << r
-               << "\n  Column: " << c;
-            xml_data_parse_error(tag, os.str());
-          }
-        } else {
+  if (pbifs) {
+    xml_read_binary_block(
+        pbifs, tensor, npages * nrows * ncols, tag);
+  } else {
+    for (Index p = 0; p < npages; p++) {
+      for (Index r = 0; r < nrows; r++) {
+        for (Index c = 0; c < ncols; c++) {
           is_xml >> double_imanip() >> tensor(p, r, c);
           if (is_xml.fail()) {
             ostringstream os;
@@ -694,19 +741,19 @@ void xml_write_to_stream(ostream& os_xml,
   xml_set_stream_precision(os_xml);
 
   // Write the elements:
-  for (Index p = 0; p < tensor.npages(); ++p) {
-    for (Index r = 0; r < tensor.nrows(); ++r) {
-      if (pbofs)
-        *pbofs << tensor(p, r, 0);
-      else
+  if (pbofs) {
+    xml_write_binary_block(pbofs,
+                           tensor,
+                           tensor.npages() * tensor.nrows() * tensor.ncols());
+  } else {
+    for (Index p = 0; p < tensor.npages(); ++p) {
+      for (Index r = 0; r < tensor.nrows(); ++r) {
         os_xml << tensor(p, r, 0);
-      for (Index c = 1; c < tensor.ncols(); ++c) {
-        if (pbofs)
-          *pbofs << tensor(p, r, c);
-        else
+        for (Index c = 1; c < tensor.ncols(); ++c) {
           os_xml << " " << tensor(p, r, c);
+        }
+        os_xml << '\n';
       }
-      if (!pbofs) os_xml << '\n';
     }
   }
 
@@ -740,20 +787,14 @@ void xml_read_from_stream(istream& is_xml,
   tag.get_attribute_value("ncols", ncols);
   tensor.resize(nbooks, npages, nrows, ncols);
 
-  for (Index b = 0; b < nbooks; b++) {
-    for (Index p = 0; p < npages; p++) {
-      for (Index r = 0; r < nrows; r++) {
-        for (Index c = 0; c < ncols; c++) {
-          if (pbifs) {
-            *pbifs >> tensor(b, p, r, c);
-            if (pbifs->fail()) {
-              ostringstream os;
-              os << " near "
-                 << "\n  Book  : " << b << "\n  Page  : " << p
-                 << "\n  Row   : " << r << "\n  Column: " << c;
-              xml_data_parse_error(tag, os.str());
-            }
-          } else {
+  if (pbifs) {
+    xml_read_binary_block(
+        pbifs, tensor, nbooks * npages * nrows * ncols, tag);
+  } else {
+    for (Index b = 0; b < nbooks; b++) {
+      for (Index p = 0; p < npages; p++) {
+        for (Index r = 0; r < nrows; r++) {
+          for (Index c = 0; c < ncols; c++) {
             is_xml >> double_imanip() >> tensor(b, p, r, c);
             if (is_xml.fail()) {
               ostringstream os;
@@ -800,20 +841,21 @@ void xml_write_to_stream(ostream& os_xml,
   xml_set_stream_precision(os_xml);
 
   // Write the elements:
-  for (Index b = 0; b < tensor.nbooks(); ++b) {
-    for (Index p = 0; p < tensor.npages(); ++p) {
-      for (Index r = 0; r < tensor.nrows(); ++r) {
-        if (pbofs)
-          *pbofs << tensor(b, p, r, 0);
-        else
+  if (pbofs) {
+    xml_write_binary_block(pbofs,
+                           tensor,
+                           tensor.nbooks() * tensor.npages() * tensor.nrows() *
+                               tensor.ncols());
+  } else {
+    for (Index b = 0; b < tensor.nbooks(); ++b) {
+      for (Index p = 0; p < tensor.npages(); ++p) {
+        for (Index r = 0; r < tensor.nrows(); ++r) {
           os_xml << tensor(b, p, r, 0);
-        for (Index c = 1; c < tensor.ncols(); ++c) {
-          if (pbofs)
-            *pbofs << tensor(b, p, r, c);
-          else
+          for (Index c = 1; c < tensor.ncols(); ++c) {
             os_xml << " " << tensor(b, p, r, c);
+          }
+          os_xml << '\n';
         }
-        if (!pbofs) os_xml << '\n';
       }
     }
   }
@@ -849,22 +891,17 @@ void xml_read_from_stream(istream& is_xml,
   tag.get_attribute_value("ncols", ncols);
   tensor.resize(nshelves, nbooks, npages, nrows, ncols);
 
-  for (Index s = 0; s < nshelves; s++) {
-    for (Index b = 0; b < nbooks; b++) {
-      for (Index p = 0; p < npages; p++) {
-        for (Index r = 0; r < nrows; r++) {
-          for (Index c = 0; c < ncols; c++) {
-            if (pbifs) {
-              *pbifs >> tensor(s, b, p, r, c);
-              if (pbifs->fail()) {
-                ostringstream os;
-                os << " near "
-                   << "\n  Shelf : " << s << "\n  Book  : " << b
-                   << "\n  Page  : " << p << "\n  Row   : " << r
-                   << "\n  Column: " << c;
-                xml_data_parse_error(tag, os.str());
-              }
-            } else {
+  if (pbifs) {
+    xml_read_binary_block(pbifs,
+                          tensor,
+                          nshelves * nbooks * npages * nrows * ncols,
+                          tag);
+  } else {
+    for (Index s = 0; s < nshelves; s++) {
+      for (Index b = 0; b < nbooks; b++) {
+        for (Index p = 0; p < npages; p++) {
+          for (Index r = 0; r < nrows; r++) {
+            for (Index c = 0; c < ncols; c++) {
               is_xml >> double_imanip() >> tensor(s, b, p, r, c);
               if (is_xml.fail()) {
                 ostringstream os;
@@ -914,21 +951,23 @@ void xml_write_to_stream(ostream& os_xml,
   xml_set_stream_precision(os_xml);
 
   // Write the elements:
-  for (Index s = 0; s < tensor.nshelves(); ++s) {
-    for (Index b = 0; b < tensor.nbooks(); ++b) {
-      for (Index p = 0; p < tensor.npages(); ++p) {
-        for (Index r = 0; r < tensor.nrows(); ++r) {
-          if (pbofs)
-            *pbofs << tensor(s, b, p, r, 0);
-          else
+  if (pbofs) {
+    xml_write_binary_block(pbofs,
+                           tensor,
+                           tensor.nshelves() * tensor.nbooks() *
+                               tensor.npages() * tensor.nrows() *
+                               tensor.ncols());
+  } else {
+    for (Index s = 0; s < tensor.nshelves(); ++s) {
+      for (Index b = 0; b < tensor.nbooks(); ++b) {
+        for (Index p = 0; p < tensor.npages(); ++p) {
+          for (Index r = 0; r < tensor.nrows(); ++r) {
             os_xml << tensor(s, b, p, r, 0);
-          for (Index c = 1; c < tensor.ncols(); ++c) {
-            if (pbofs)
-              *pbofs << tensor(s, b, p, r, c);
-            else
+            for (Index c = 1; c < tensor.ncols(); ++c) {
               os_xml << " " << tensor(s, b, p, r, c);
+            }
+            os_xml << '\n';
           }
-          if (!pbofs) os_xml << '\n';
         }
       }
     }
@@ -966,23 +1005,19 @@ void xml_read_from_stream(istream& is_xml,
   tag.get_attribute_value("ncols", ncols);
   tensor.resize(nvitrines, nshelves, nbooks, npages, nrows, ncols);
 
-  for (Index v = 0; v < nvitrines; v++) {
-    for (Index s = 0; s < nshelves; s++) {
-      for (Index b = 0; b < nbooks; b++) {
-        for (Index p = 0; p < npages; p++) {
-          for (Index r = 0; r < nrows; r++) {
-            for (Index c = 0; c < ncols; c++) {
-              if (pbifs) {
-                *pbifs >> tensor(v, s, b, p, r, c);
-                if (pbifs->fail()) {
-                  ostringstream os;
-                  os << " near "
-                     << "\n  Vitrine: " << v << "\n  Shelf  : " << s
-                     << "\n  Book   : " << b << "\n  Page   : " << p
-                     << "\n  Row    : " << r << "\n  Column : " << c;
-                  xml_data_parse_error(tag, os.str());
-                }
-              } else {
+  if (pbifs) {
+    xml_read_binary_block(pbifs,
+                          tensor,
+                          nvitrines * nshelves * nbooks * npages * nrows *
+                              ncols,
+                          tag);
+  } else {
+    for (Index v = 0; v < nvitrines; v++) {
+      for (Index s = 0; s < nshelves; s++) {
+        for (Index b = 0; b < nbooks; b++) {
+          for (Index p = 0; p < npages; p++) {
+            for (Index r = 0; r < nrows; r++) {
+              for (Index c = 0; c < ncols; c++) {
                 is_xml >> double_imanip() >> tensor(v, s, b, p, r, c);
                 if (is_xml.fail()) {
                   ostringstream os;
@@ -1034,22 +1069,24 @@ void xml_write_to_stream(ostream& os_xml,
   xml_set_stream_precision(os_xml);
 
   // Write the elements:
-  for (Index v = 0; v < tensor.nvitrines(); ++v) {
-    for (Index s = 0; s < tensor.nshelves(); ++s) {
-      for (Index b = 0; b < tensor.nbooks(); ++b) {
-        for (Index p = 0; p < tensor.npages(); ++p) {
-          for (Index r = 0; r < tensor.nrows(); ++r) {
-            if (pbofs)
-              *pbofs << tensor(v, s, b, p, r, 0);
-            else
+  if (pbofs) {
+    xml_write_binary_block(pbofs,
+                           tensor,
+                           tensor.nvitrines() * tensor.nshelves() *
+                               tensor.nbooks() * tensor.npages() *
+                               tensor.nrows() * tensor.ncols());
+  } else {
+    for (Index v = 0; v < tensor.nvitrines(); ++v) {
+      for (Index s = 0; s < tensor.nshelves(); ++s) {
+        for (Index b = 0; b < tensor.nbooks(); ++b) {
+          for (Index p = 0; p < tensor.npages(); ++p) {
+            for (Index r = 0; r < tensor.nrows(); ++r) {
               os_xml << tensor(v, s, b, p, r, 0);
-            for (Index c = 1; c < tensor.ncols(); ++c) {
-              if (pbofs)
-                *pbofs << tensor(v, s, b, p, r, c);
-              else
+              for (Index c = 1; c < tensor.ncols(); ++c) {
                 os_xml << " " << tensor(v, s, b, p, r, c);
+              }
+              os_xml << '\n';
             }
-            if (!pbofs) os_xml << '\n';
           }
         }
       }
@@ -1089,25 +1126,20 @@ void xml_read_from_stream(istream& is_xml,
   tag.get_attribute_value("ncols", ncols);
   tensor.resize(nlibraries, nvitrines, nshelves, nbooks, npages, nrows, ncols);
 
-  for (Index l = 0; l < nlibraries; l++) {
-    for (Index v = 0; v < nvitrines; v++) {
-      for (Index s = 0; s < nshelves; s++) {
-        for (Index b = 0; b < nbooks; b++) {
-          for (Index p = 0; p < npages; p++) {
-            for (Index r = 0; r < nrows; r++) {
-              for (Index c = 0; c < ncols; c++) {
-                if (pbifs) {
-                  *pbifs >> tensor(l, v, s, b, p, r, c);
-                  if (pbifs->fail()) {
-                    ostringstream os;
-                    os << " near "
-                       << "\n  Library: " << l << "\n  Vitrine: " << v
-                       << "\n  Shelf  : " << s << "\n  Book   : " << b
-                       << "\n  Page   : " << p << "\n  Row    : " << r
-                       << "\n  Column : " << c;
-                    xml_data_parse_error(tag, os.str());
-                  }
-                } else {
+  if (pbifs) {
+    xml_read_binary_block(pbifs,
+                          tensor,
+                          nlibraries * nvitrines * nshelves * nbooks * npages *
+                              nrows * ncols,
+                          tag);
+  } else {
+    for (Index l = 0; l < nlibraries; l++) {
+      for (Index v = 0; v < nvitrines; v++) {
+        for (Index s = 0; s < nshelves; s++) {
+          for (Index b = 0; b < nbooks; b++) {
+            for (Index p = 0; p < npages; p++) {
+              for (Index r = 0; r < nrows; r++) {
+                for (Index c = 0; c < ncols; c++) {
                   is_xml >> double_imanip() >> tensor(l, v, s, b, p, r, c);
                   if (is_xml.fail()) {
                     ostringstream os;
@@ -1162,23 +1194,26 @@ void xml_write_to_stream(ostream& os_xml,
   xml_set_stream_precision(os_xml);
 
   // Write the elements:
-  for (Index l = 0; l < tensor.nlibraries(); ++l) {
-    for (Index v = 0; v < tensor.nvitrines(); ++v) {
-      for (Index s = 0; s < tensor.nshelves(); ++s) {
-        for (Index b = 0; b < tensor.nbooks(); ++b) {
-          for (Index p = 0; p < tensor.npages(); ++p) {
-            for (Index r = 0; r < tensor.nrows(); ++r) {
-              if (pbofs)
-                *pbofs << tensor(l, v, s, b, p, r, 0);
-              else
+  if (pbofs) {
+    xml_write_binary_block(pbofs,
+                           tensor,
+                           tensor.nlibraries() * tensor.nvitrines() *
+                               tensor.nshelves() * tensor.nbooks() *
+                               tensor.npages() * tensor.nrows() *
+                               tensor.ncols());
+  } else {
+    for (Index l = 0; l < tensor.nlibraries(); ++l) {
+      for (Index v = 0; v < tensor.nvitrines(); ++v) {
+        for (Index s = 0; s < tensor.nshelves(); ++s) {
+          for (Index b = 0; b < tensor.nbooks(); ++b) {
+            for (Index p = 0; p < tensor.npages(); ++p) {
+              for (Index r = 0; r < tensor.nrows(); ++r) {
                 os_xml << tensor(l, v, s, b, p, r, 0);
-              for (Index c = 1; c < tensor.ncols(); ++c) {
-                if (pbofs)
-                  *pbofs << tensor(l, v, s, b, p, r, c);
-                else
+                for (Index c = 1; c < tensor.ncols(); ++c) {
                   os_xml << " " << tensor(l, v, s, b, p, r, c);
+                }
+                os_xml << '\n';
               }
-              if (!pbofs) os_xml << '\n';
             }
           }
         }
@@ -1211,16 +1246,10 @@ void xml_parse_from_stream(istream& is_xml,
   tag.get_attribute_value("nelem", nelem);
   vector.resize(nelem);
 
-  for (Index n = 0; n < nelem; n++) {
-    if (pbifs) {
-      *pbifs >> vector[n];
-      if (pbifs->fail()) {
-        ostringstream os;
-        os << " near "
-           << "\n  Element: " << n;
-        xml_data_parse_error(tag, os.str());
-      }
-    } else {
+  if (pbifs) {
+    xml_read_binary_block(pbifs, vector, nelem, tag);
+  } else {
+    for (Index n = 0; n < nelem; n++) {
       is_xml >> double_imanip() >> vector[n];
       if (is_xml.fail()) {
         ostringstream os;
@@ -1282,11 +1311,10 @@ void xml_write_to_stream(ostream& os_xml,
 
   xml_set_stream_precision(os_xml);
 
-  for (Index i = 0; i < n; ++i)
-    if (pbofs)
-      *pbofs << vector[i];
-    else
-      os_xml << vector[i] << '\n';
+  if (pbofs)
+    xml_write_binary_block(pbofs, vector, n);
+  else
+    for (Index i = 0; i < n; ++i) os_xml << vector[i] << '\n';
 
   close_tag.set_name("/Vector");
   close_tag.write_to_stream(os_xml);
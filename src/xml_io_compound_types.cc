@@ -362,6 +362,12 @@ void xml_read_from_stream(istream& is_xml,
   tag.read_from_stream(is_xml);
   tag.check_name("GasAbsLookup");
 
+  // Tables with the temperature derivative of the cross sections are
+  // marked in the open tag, the derivative follows the cross sections:
+  String with_dT;
+  tag.get_attribute_value("temperature_derivative", with_dT);
+
+  gal.ClearXsecStorage();
   xml_read_from_stream(is_xml, gal.species, pbifs, verbosity);
   xml_read_from_stream(is_xml, gal.nonlinear_species, pbifs, verbosity);
   xml_read_from_stream(is_xml, gal.f_grid, pbifs, verbosity);
@@ -371,6 +377,10 @@ void xml_read_from_stream(istream& is_xml,
   xml_read_from_stream(is_xml, gal.t_pert, pbifs, verbosity);
   xml_read_from_stream(is_xml, gal.nls_pert, pbifs, verbosity);
   xml_read_from_stream(is_xml, gal.xsec, pbifs, verbosity);
+  if (with_dT == "true")
+    xml_read_from_stream(is_xml, gal.dxsec_dT, pbifs, verbosity);
+  else
+    gal.dxsec_dT.resize(0, 0, 0, 0);
 
   tag.read_from_stream(is_xml);
   tag.check_name("/GasAbsLookup");
@@ -393,6 +403,8 @@ void xml_write_to_stream(ostream& os_xml,
 
   open_tag.set_name("GasAbsLookup");
   if (name.length()) open_tag.add_attribute("name", name);
+  if (gal.HasTemperatureDerivative())
+    open_tag.add_attribute("temperature_derivative", String("true"));
   open_tag.write_to_stream(os_xml);
 
   xml_write_to_stream(os_xml, gal.species, pbofs, "", verbosity);
@@ -411,8 +423,20 @@ void xml_write_to_stream(ostream& os_xml,
                       pbofs,
                       "NonlinearSpeciesVmrPerturbations",
                       verbosity);
-  xml_write_to_stream(
-      os_xml, gal.xsec, pbofs, "AbsorptionCrossSections", verbosity);
+  // Mapped and compressed tables have their cross sections outside of xsec
+  const bool xsec_outside = gal.IsMapped() or gal.IsCompressed();
+  const Tensor4 xsec_copy = xsec_outside ? gal.XsecTensor() : Tensor4();
+  xml_write_to_stream(os_xml,
+                      xsec_outside ? xsec_copy : gal.xsec,
+                      pbofs,
+                      "AbsorptionCrossSections",
+                      verbosity);
+  if (gal.HasTemperatureDerivative())
+    xml_write_to_stream(os_xml,
+                        gal.dxsec_dT,
+                        pbofs,
+                        "TemperatureDerivativeOfAbsorptionCrossSections",
+                        verbosity);
 
   close_tag.set_name("/GasAbsLookup");
   close_tag.write_to_stream(os_xml);
@@ -169,8 +169,9 @@ void zeeman_on_the_fly(
   const Numeric dnumdens_dt_dmvr =
       dnumber_density_dt(rtp_pressure, rtp_temperature);
 
-  // Main compute vectors
-  Linefunctions::InternalData scratch(nf, nq), sum(nf, nq);
+  // Main compute vectors, the sums are indexed by Zeeman::Polarization
+  Linefunctions::InternalData scratch(nf, nq);
+  std::array<Linefunctions::InternalData, 3> sums{{{nf, nq}, {nf, nq}, {nf, nq}}};
 
   // Magnetic field internals and derivatives...
   const auto X =
@@ -199,61 +200,94 @@ void zeeman_on_the_fly(
   }
   const auto eB = MapToEigen(B);
   const auto edBdT = MapToEigen(dBdT);
+  
+  // Packed line data and line shape parameters are shared by all polarizations
+  const bool do_temperature = do_temperature_jacobian(jacobian_quantities);
+  std::vector<std::vector<Absorption::PackedLines>> packed_lines(ns);
+  std::vector<std::vector<Absorption::ShapeParameterTable>> shape_tables(ns);
+  
+  // The Zeeman components only depend on the quantum numbers and Zeeman
+  // models of the lines, so they are kept between calls and only recomputed
+  // when a band no longer matches its table
+  thread_local std::vector<std::vector<Absorption::ZeemanComponentTable>> zeeman_tables;
+  zeeman_tables.resize(ns);
+  
+  for (Index ispecies = 0; ispecies < ns; ispecies++) {
+    if (abs_species[ispecies].nelem() and is_zeeman(abs_species[ispecies])) {
+      zeeman_tables[ispecies].resize(abs_lines_per_species[ispecies].nelem());
+      for (auto& band : abs_lines_per_species[ispecies]) {
+        auto& table = zeeman_tables[ispecies][packed_lines[ispecies].size()];
+        if (not table.Matches(band)) table = Absorption::ZeemanComponentTable(band);
+        packed_lines[ispecies].emplace_back(band);
+        shape_tables[ispecies].emplace_back();
+        packed_lines[ispecies].back().SetShapeParameters(shape_tables[ispecies].back(),
+                                                         rtp_temperature,
+                                                         rtp_pressure,
+                                                         band.BroadeningSpeciesVMR(rtp_vmr, abs_species),
+                                                         do_temperature);
+      }
+    }
+  }
 
-  for (auto polar : {Zeeman::Polarization::SigmaMinus,
-                     Zeeman::Polarization::Pi,
-                     Zeeman::Polarization::SigmaPlus}) {
-    auto& pol = Zeeman::SelectPolarization(polarization_scale_data, polar);
-    auto& dpol_dtheta =
-        Zeeman::SelectPolarization(polarization_scale_dtheta_data, polar);
-    auto& dpol_deta =
-        Zeeman::SelectPolarization(polarization_scale_deta_data, polar);
-
-    for (Index ispecies = 0; ispecies < ns; ispecies++) {
+  for (Index ispecies = 0; ispecies < ns; ispecies++) {
+    
+    // Skip it if there are no species or there is no Zeeman
+    if (not abs_species[ispecies].nelem() or not is_zeeman(abs_species[ispecies]) or not abs_lines_per_species[ispecies].nelem())
+      continue;
+    
+    for (Index iband = 0; iband < abs_lines_per_species[ispecies].nelem(); iband++) {
+      const auto& band = abs_lines_per_species[ispecies][iband];
       
-      // Skip it if there are no species or there is no Zeeman
-      if (not abs_species[ispecies].nelem() or not is_zeeman(abs_species[ispecies]) or not abs_lines_per_species[ispecies].nelem())
-        continue;
+      // Constants for these lines
+      const Numeric QT0 = single_partition_function(band.T0(),
+                                                    partition_functions.getParamType(band.QuantumIdentity()),
+                                                    partition_functions.getParam(band.QuantumIdentity()));
+      const Numeric QT = single_partition_function(rtp_temperature,
+                                                   partition_functions.getParamType(band.QuantumIdentity()),
+                                                   partition_functions.getParam(band.QuantumIdentity()));
+      const Numeric dQTdT = dsingle_partition_function_dT(QT, rtp_temperature, temperature_perturbation(jacobian_quantities),
+                                                          partition_functions.getParamType(band.QuantumIdentity()),
+                                                          partition_functions.getParam(band.QuantumIdentity()));
+      const Numeric DC = Linefunctions::DopplerConstant(rtp_temperature, band.SpeciesMass());
+      const Numeric dDCdT = Linefunctions::dDopplerConstant_dT(rtp_temperature, DC);
+      const Vector line_shape_vmr = band.BroadeningSpeciesVMR(rtp_vmr, abs_species);
+      const Numeric numdens = rtp_vmr[ispecies] * dnumdens_dmvr;
+      const Numeric dnumdens_dT = rtp_vmr[ispecies] * dnumdens_dt_dmvr;
+      const Numeric isotop_ratio = isotopologue_ratios.getIsotopologueRatio(band.QuantumIdentity());
+        
+      // All polarizations in one pass over the lines
+      Linefunctions::set_zeeman_cross_section_of_band(
+        scratch,
+        sums,
+        f_grid,
+        band,
+        packed_lines[ispecies][iband],
+        jacobian_quantities,
+        jacobian_quantities_positions,
+        line_shape_vmr,
+        rtp_nlte,  // This must be turned into a map of some kind...
+        rtp_pressure,
+        rtp_temperature,
+        isotop_ratio,
+        X.H,
+        DC,
+        dDCdT,
+        QT,
+        dQTdT,
+        QT0,
+        false,
+        zeeman_tables[ispecies][iband],
+        &shape_tables[ispecies][iband]);
       
-      for (auto& band : abs_lines_per_species[ispecies]) {
-        // Constants for these lines
-        const Numeric QT0 = single_partition_function(band.T0(),
-                                                      partition_functions.getParamType(band.QuantumIdentity()),
-                                                      partition_functions.getParam(band.QuantumIdentity()));
-        const Numeric QT = single_partition_function(rtp_temperature,
-                                                     partition_functions.getParamType(band.QuantumIdentity()),
-                                                     partition_functions.getParam(band.QuantumIdentity()));
-        const Numeric dQTdT = dsingle_partition_function_dT(QT, rtp_temperature, temperature_perturbation(jacobian_quantities),
-                                                            partition_functions.getParamType(band.QuantumIdentity()),
-                                                            partition_functions.getParam(band.QuantumIdentity()));
-        const Numeric DC = Linefunctions::DopplerConstant(rtp_temperature, band.SpeciesMass());
-        const Numeric dDCdT = Linefunctions::dDopplerConstant_dT(rtp_temperature, DC);
-        const Vector line_shape_vmr = band.BroadeningSpeciesVMR(rtp_vmr, abs_species);
-        const Numeric numdens = rtp_vmr[ispecies] * dnumdens_dmvr;
-        const Numeric dnumdens_dT = rtp_vmr[ispecies] * dnumdens_dt_dmvr;
-        const Numeric isotop_ratio = isotopologue_ratios.getIsotopologueRatio(band.QuantumIdentity());
-          
-        Linefunctions::set_cross_section_of_band(
-          scratch,
-          sum,
-          f_grid,
-          band,
-          jacobian_quantities,
-          jacobian_quantities_positions,
-          line_shape_vmr,
-          rtp_nlte,  // This must be turned into a map of some kind...
-          rtp_pressure,
-          rtp_temperature,
-          isotop_ratio,
-          X.H,
-          DC,
-          dDCdT,
-          QT,
-          dQTdT,
-          QT0,
-          false,
-          true,
-          polar);
+      for (auto polar : {Zeeman::Polarization::SigmaMinus,
+                         Zeeman::Polarization::Pi,
+                         Zeeman::Polarization::SigmaPlus}) {
+        const auto& sum = sums[Index(polar)];
+        auto& pol = Zeeman::SelectPolarization(polarization_scale_data, polar);
+        auto& dpol_dtheta =
+            Zeeman::SelectPolarization(polarization_scale_dtheta_data, polar);
+        auto& dpol_deta =
+            Zeeman::SelectPolarization(polarization_scale_deta_data, polar);
         
         auto pol_real = pol.attenuation();
         auto pol_imag = pol.dispersion();